@@ -30,6 +30,10 @@ ifeq (${ENABLE_PMF},1)
 BL1_SOURCES		+=	lib/pmf/pmf_main.c
 endif
 
+ifeq (${BOOT_PROFILE},1)
+BL1_SOURCES		+=	common/boot_prof.c
+endif
+
 ifeq ($($(ARCH)-ld-id),gnu-gcc)
         BL1_LDFLAGS	+=	-Wl,--sort-section=alignment
 else ifneq ($(filter llvm-lld gnu-ld,$($(ARCH)-ld-id)),)
@@ -13,6 +13,7 @@
 #include <arch_helpers.h>
 #include <bl1/bl1.h>
 #include <common/bl_common.h>
+#include <common/boot_prof.h>
 #include <common/build_message.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
@@ -44,6 +45,8 @@ uint64_t bl1_apiakey[2];
  ******************************************************************************/
 void bl1_setup(void)
 {
+	boot_prof_stage_entry();
+
 	/* Enable early console if EARLY_CONSOLE flag is enabled */
 	plat_setup_early_console();
 
@@ -61,12 +64,14 @@ void bl1_setup(void)
  ******************************************************************************/
 void bl1_main(void)
 {
-	unsigned int image_id;
+	unsigned int image_id, prof;
 
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL1_ENTRY, PMF_CACHE_MAINT);
 #endif
 
+	boot_prof_init();
+
 	/* Announce our arrival */
 	NOTICE(FIRMWARE_WELCOME_STR);
 	NOTICE("BL1: %s\n", build_version_string);
@@ -108,6 +113,7 @@ void bl1_main(void)
 	/* Perform remaining generic architectural setup from EL3 */
 	bl1_arch_setup();
 
+	prof = boot_prof_begin(BOOT_PROF_AUTH_INIT, 0U);
 	crypto_mod_init();
 
 	/* Initialize authentication module */
@@ -115,9 +121,12 @@ void bl1_main(void)
 
 	/* Initialize the measured boot */
 	bl1_plat_mboot_init();
+	boot_prof_end(prof);
 
 	/* Perform platform setup in BL1. */
+	prof = boot_prof_begin(BOOT_PROF_PLAT_SETUP, 0U);
 	bl1_platform_setup();
+	boot_prof_end(prof);
 
 	/* Get the image id of next image to load and run. */
 	image_id = bl1_plat_get_next_image_id();
@@ -132,12 +141,16 @@ void bl1_main(void)
 		NOTICE("BL1-FWU: *******FWU Process Started*******\n");
 
 	/* Teardown the measured boot driver */
+	prof = boot_prof_begin(BOOT_PROF_AUTH_FINISH, 0U);
 	bl1_plat_mboot_finish();
 
 	crypto_mod_finish();
+	boot_prof_end(prof);
 
 	bl1_prepare_next_image(image_id);
 
+	boot_prof_stage_exit();
+
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL1_EXIT, PMF_CACHE_MAINT);
 #endif
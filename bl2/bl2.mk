@@ -8,7 +8,6 @@ BL2_SOURCES		+=	bl2/bl2_image_load_v2.c			\
 				bl2/bl2_main.c				\
 				bl2/${ARCH}/bl2_arch_setup.c		\
 				lib/locks/exclusive/${ARCH}/spinlock.S	\
-				plat/common/${ARCH}/platform_up_stack.S	\
 				${MBEDTLS_SOURCES}
 
 ifeq (${ARCH},aarch64)
@@ -49,3 +48,15 @@ endif
 ifeq (${ENABLE_PMF},1)
 BL2_SOURCES		+=	lib/pmf/pmf_main.c
 endif
+
+ifeq (${BOOT_PROFILE},1)
+BL2_SOURCES		+=	common/boot_prof.c
+endif
+
+ifeq (${BL2_CONCURRENT_LOAD},1)
+# Each CPU loading images needs its own stack
+BL2_SOURCES		+=	bl2/bl2_load_queue.c			\
+				plat/common/${ARCH}/platform_mp_stack.S
+else
+BL2_SOURCES		+=	plat/common/${ARCH}/platform_up_stack.S
+endif
@@ -1,16 +1,18 @@
 /*
- * Copyright (c) 2016-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2025, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <arch.h>
 #include <arch_helpers.h>
 #include "bl2_private.h"
 #include <common/bl_common.h>
+#include <common/boot_prof.h>
 #include <common/debug.h>
 #include <common/desc_image_load.h>
 #include <drivers/auth/auth_mod.h>
@@ -18,9 +20,70 @@
 
 #include <platform_def.h>
 
+/*******************************************************************************
+ * Load and authenticate the image of a node of the load list, unless it is to
+ * be skipped. This may run on any CPU for the images loaded concurrently.
+ ******************************************************************************/
+int bl2_load_image(const bl_load_info_node_t *node_info)
+{
+	if ((node_info->image_info->h.attr & IMAGE_ATTRIB_SKIP_LOADING) != 0U) {
+		INFO("BL2: Skip loading image id %u\n", node_info->image_id);
+		return 0;
+	}
+
+	INFO("BL2: Loading image id %u\n", node_info->image_id);
+
+	return load_auth_image(node_info->image_id, node_info->image_info);
+}
+
+/*******************************************************************************
+ * Check the result of the loading of the image of a node of the load list, and
+ * let the platform handle the image information. The images loaded
+ * concurrently are measured here, in list order.
+ ******************************************************************************/
+void bl2_image_loaded(const bl_load_info_node_t *node_info, int err)
+{
+	unsigned int attr = node_info->image_info->h.attr;
+	unsigned int prof;
+
+	if (err != 0) {
+		ERROR("BL2: Failed to load image id %u (%i)\n",
+		      node_info->image_id, err);
+		plat_error_handler(err);
+	}
+
+	if ((BL2_CONCURRENT_LOAD != 0) &&
+	    ((attr & IMAGE_ATTRIB_CONCURRENT) != 0U) &&
+	    ((attr & IMAGE_ATTRIB_SKIP_LOADING) == 0U)) {
+		prof = boot_prof_begin(BOOT_PROF_IMAGE_MEASURE,
+				       node_info->image_id);
+		err = plat_mboot_measure_image(node_info->image_id,
+					       node_info->image_info);
+		boot_prof_end(prof);
+		if (err != 0) {
+			ERROR("BL2: Failed to measure image id %u (%i)\n",
+			      node_info->image_id, err);
+			plat_error_handler(err);
+		}
+	}
+
+	/* Allow platform to handle image information. */
+	err = bl2_plat_handle_post_image_load(node_info->image_id);
+	if (err != 0) {
+		ERROR("BL2: Failure in post image load handling (%i)\n", err);
+		plat_error_handler(err);
+	}
+}
+
 /*******************************************************************************
  * This function loads SCP_BL2/BL3x images and returns the ep_info for
  * the next executable image.
+ *
+ * With BL2_CONCURRENT_LOAD, the consecutive images with the
+ * IMAGE_ATTRIB_CONCURRENT attribute are queued once their pre-load handling is
+ * done, and loaded by all the CPUs working on the queue. The queue is flushed,
+ * which completes the post-load handling of the queued images in list order,
+ * before any image without the attribute.
  ******************************************************************************/
 struct entry_point_info *bl2_load_images(void)
 {
@@ -28,6 +91,7 @@ struct entry_point_info *bl2_load_images(void)
 	bl_load_info_t *bl2_load_info;
 	const bl_load_info_node_t *bl2_node_info;
 	int plat_setup_done = 0;
+	bool concurrent;
 	int err;
 
 	/*
@@ -41,6 +105,19 @@ struct entry_point_info *bl2_load_images(void)
 	bl2_node_info = bl2_load_info->head;
 
 	while (bl2_node_info != NULL) {
+		concurrent = (BL2_CONCURRENT_LOAD != 0) &&
+			     ((bl2_node_info->image_info->h.attr &
+			       IMAGE_ATTRIB_CONCURRENT) != 0U);
+
+		/*
+		 * Complete the images queued before, which the platform setup
+		 * or an image loaded on its own may depend on.
+		 */
+		if (!concurrent || ((bl2_node_info->image_info->h.attr &
+				     IMAGE_ATTRIB_PLAT_SETUP) != 0U)) {
+			bl2_load_queue_flush();
+		}
+
 		/*
 		 * Perform platform setup before loading the image,
 		 * if indicated in the image attributes AND if NOT
@@ -63,31 +140,20 @@ struct entry_point_info *bl2_load_images(void)
 			plat_error_handler(err);
 		}
 
-		if ((bl2_node_info->image_info->h.attr &
-		    IMAGE_ATTRIB_SKIP_LOADING) == 0U) {
-			INFO("BL2: Loading image id %u\n", bl2_node_info->image_id);
-			err = load_auth_image(bl2_node_info->image_id,
-				bl2_node_info->image_info);
-			if (err != 0) {
-				ERROR("BL2: Failed to load image id %u (%i)\n",
-				      bl2_node_info->image_id, err);
-				plat_error_handler(err);
-			}
+		if (concurrent) {
+			bl2_load_queue_add(bl2_node_info);
 		} else {
-			INFO("BL2: Skip loading image id %u\n", bl2_node_info->image_id);
-		}
-
-		/* Allow platform to handle image information. */
-		err = bl2_plat_handle_post_image_load(bl2_node_info->image_id);
-		if (err != 0) {
-			ERROR("BL2: Failure in post image load handling (%i)\n", err);
-			plat_error_handler(err);
+			err = bl2_load_image(bl2_node_info);
+			bl2_image_loaded(bl2_node_info, err);
 		}
 
 		/* Go to next image */
 		bl2_node_info = bl2_node_info->next_load_info;
 	}
 
+	bl2_load_queue_flush();
+	bl2_load_queue_close();
+
 	/*
 	 * Get information to pass to the next image.
 	 */
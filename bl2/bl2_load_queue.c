@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include "bl2_private.h"
+#include <common/bl_common.h>
+#include <common/debug.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+/* Maximum number of images queued for concurrent loading */
+#ifndef PLAT_BL2_LOAD_QUEUE_SIZE
+#define PLAT_BL2_LOAD_QUEUE_SIZE	U(8)
+#endif
+
+struct bl2_load_job {
+	const bl_load_info_node_t *node_info;
+	int err;
+	u_register_t mpidr;
+	uint64_t start;
+	uint64_t end;
+};
+
+/*
+ * Images queued since the last flush. The CPUs claim them in list order, so
+ * that the loading of an image never starts after the ones queued after it,
+ * and each CPU loads its image with the IO and authentication services
+ * serialised by load_auth_image().
+ */
+static struct {
+	struct bl2_load_job jobs[PLAT_BL2_LOAD_QUEUE_SIZE];
+	unsigned int count;
+	unsigned int next;
+	unsigned int done;
+	uint64_t run_start;
+	uint64_t run_wait;
+	/* CPUs started by the platform, and the ones done with the queue */
+	bool workers_started;
+	unsigned int workers;
+	unsigned int workers_left;
+	bool closed;
+	/* Totals of the flushed images, in ticks */
+	unsigned int images;
+	uint64_t wall_ticks;
+	uint64_t work_ticks;
+} bl2_load_queue;
+
+static spinlock_t bl2_load_lock;
+
+static unsigned long long ticks_to_us(uint64_t ticks)
+{
+	uint64_t freq = read_cntfrq_el0();
+
+	if (freq == 0U) {
+		return 0ULL;
+	}
+
+	return (unsigned long long)((ticks * 1000000U) / freq);
+}
+
+/* Load the queued images until there is none left to claim */
+static void bl2_load_work(void)
+{
+	struct bl2_load_job *job;
+
+	spin_lock(&bl2_load_lock);
+
+	while (bl2_load_queue.next < bl2_load_queue.count) {
+		job = &bl2_load_queue.jobs[bl2_load_queue.next];
+		bl2_load_queue.next++;
+		spin_unlock(&bl2_load_lock);
+
+		job->mpidr = read_mpidr_el1();
+		job->start = read_cntpct_el0();
+		job->err = bl2_load_image(job->node_info);
+		job->end = read_cntpct_el0();
+
+		spin_lock(&bl2_load_lock);
+		bl2_load_queue.done++;
+	}
+
+	spin_unlock(&bl2_load_lock);
+}
+
+/*
+ * Queue the image of a node of the load list, once its pre-load handling is
+ * done. The CPUs started by plat_bl2_start_load_workers() start loading it
+ * right away.
+ */
+void bl2_load_queue_add(const bl_load_info_node_t *node_info)
+{
+	assert(node_info != NULL);
+	assert(!bl2_load_queue.closed);
+
+	if (bl2_load_queue.count == PLAT_BL2_LOAD_QUEUE_SIZE) {
+		bl2_load_queue_flush();
+	}
+
+	if (!bl2_load_queue.workers_started) {
+		bl2_load_queue.workers_started = true;
+		bl2_load_queue.workers = plat_bl2_start_load_workers();
+	}
+
+	spin_lock(&bl2_load_lock);
+
+	if (bl2_load_queue.count == 0U) {
+		/* No image is being loaded, so the wait time is stable */
+		bl2_load_queue.run_start = read_cntpct_el0();
+		bl2_load_queue.run_wait = bl_load_lock_wait_ticks();
+	}
+
+	bl2_load_queue.jobs[bl2_load_queue.count].node_info = node_info;
+	bl2_load_queue.count++;
+
+	spin_unlock(&bl2_load_lock);
+
+	/* Wake up the CPUs waiting for images to load */
+	dsbish();
+	sev();
+}
+
+/*
+ * Load the queued images along with the other CPUs, wait for all of them to
+ * be loaded, then complete their post-load handling in list order.
+ */
+void bl2_load_queue_flush(void)
+{
+	const struct bl2_load_job *job;
+	uint64_t work = 0U;
+	unsigned int i, done;
+
+	if (bl2_load_queue.count == 0U) {
+		return;
+	}
+
+	bl2_load_work();
+
+	/* Wait for the other CPUs to load their last image */
+	do {
+		spin_lock(&bl2_load_lock);
+		done = bl2_load_queue.done;
+		spin_unlock(&bl2_load_lock);
+	} while (done != bl2_load_queue.count);
+
+	bl2_load_queue.wall_ticks += read_cntpct_el0() -
+				     bl2_load_queue.run_start;
+
+	for (i = 0U; i < bl2_load_queue.count; i++) {
+		job = &bl2_load_queue.jobs[i];
+		work += job->end - job->start;
+
+		INFO("BL2: Image id %u loaded in %llu us on CPU 0x%lx\n",
+		     job->node_info->image_id,
+		     ticks_to_us(job->end - job->start),
+		     (unsigned long)job->mpidr);
+	}
+
+	/* The time spent waiting for the IO and authentication services */
+	work -= bl_load_lock_wait_ticks() - bl2_load_queue.run_wait;
+	bl2_load_queue.work_ticks += work;
+	bl2_load_queue.images += bl2_load_queue.count;
+
+	for (i = 0U; i < bl2_load_queue.count; i++) {
+		job = &bl2_load_queue.jobs[i];
+		bl2_image_loaded(job->node_info, job->err);
+	}
+
+	spin_lock(&bl2_load_lock);
+	bl2_load_queue.count = 0U;
+	bl2_load_queue.next = 0U;
+	bl2_load_queue.done = 0U;
+	spin_unlock(&bl2_load_lock);
+}
+
+/*
+ * Release the CPUs working on the queue, once every image is loaded, and
+ * report the time saved by loading the images concurrently.
+ */
+void bl2_load_queue_close(void)
+{
+	uint64_t saved = 0U;
+	unsigned int left;
+
+	assert(bl2_load_queue.count == 0U);
+
+	if (!bl2_load_queue.workers_started) {
+		return;
+	}
+
+	spin_lock(&bl2_load_lock);
+	bl2_load_queue.closed = true;
+	spin_unlock(&bl2_load_lock);
+
+	dsbish();
+	sev();
+
+	/* BL2 must not be left before the other CPUs are done with it */
+	do {
+		spin_lock(&bl2_load_lock);
+		left = bl2_load_queue.workers_left;
+		spin_unlock(&bl2_load_lock);
+	} while (left != bl2_load_queue.workers);
+
+	if (bl2_load_queue.work_ticks > bl2_load_queue.wall_ticks) {
+		saved = bl2_load_queue.work_ticks - bl2_load_queue.wall_ticks;
+	}
+
+	INFO("BL2: Loaded %u images with %u CPUs in %llu us, %llu us saved\n",
+	     bl2_load_queue.images, bl2_load_queue.workers + 1U,
+	     ticks_to_us(bl2_load_queue.wall_ticks), ticks_to_us(saved));
+}
+
+/*
+ * Work on the images queued for loading until BL2 is done loading images.
+ * This must be called by the CPUs started by plat_bl2_start_load_workers(),
+ * with the MMU and data cache enabled, using the translation tables of the
+ * primary CPU.
+ */
+void bl2_load_images_secondary(void)
+{
+	bool closed;
+
+	do {
+		bl2_load_work();
+
+		spin_lock(&bl2_load_lock);
+		closed = bl2_load_queue.closed;
+		if (closed) {
+			bl2_load_queue.workers_left++;
+		}
+		spin_unlock(&bl2_load_lock);
+
+		if (!closed) {
+			wfe();
+		}
+	} while (!closed);
+}
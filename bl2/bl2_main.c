@@ -11,6 +11,7 @@
 #include <bl1/bl1.h>
 #include <bl2/bl2.h>
 #include <common/bl_common.h>
+#include <common/boot_prof.h>
 #include <common/build_message.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
@@ -42,6 +43,8 @@
 void bl2_el3_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 		   u_register_t arg3)
 {
+	boot_prof_stage_entry();
+
 	/* Enable early console if EARLY_CONSOLE flag is enabled */
 	plat_setup_early_console();
 
@@ -59,6 +62,8 @@ void bl2_el3_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 void bl2_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 	       u_register_t arg3)
 {
+	boot_prof_stage_entry();
+
 	/* Enable early console if EARLY_CONSOLE flag is enabled */
 	plat_setup_early_console();
 
@@ -78,11 +83,14 @@ void bl2_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 void bl2_main(void)
 {
 	entry_point_info_t *next_bl_ep_info;
+	unsigned int prof;
 
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_ENTRY, PMF_CACHE_MAINT);
 #endif
 
+	boot_prof_init();
+
 	NOTICE("BL2: %s\n", build_version_string);
 	NOTICE("BL2: %s\n", build_message);
 
@@ -93,6 +101,7 @@ void bl2_main(void)
 	fwu_init();
 #endif /* PSA_FWU_SUPPORT */
 
+	prof = boot_prof_begin(BOOT_PROF_AUTH_INIT, 0U);
 	crypto_mod_init();
 
 	/* Initialize authentication module */
@@ -100,17 +109,26 @@ void bl2_main(void)
 
 	/* Initialize the Measured Boot backend */
 	bl2_plat_mboot_init();
+	boot_prof_end(prof);
 
 	/* Initialize boot source */
+	prof = boot_prof_begin(BOOT_PROF_PRELOAD, 0U);
 	bl2_plat_preload_setup();
+	boot_prof_end(prof);
 
 	/* Load the subsequent bootloader images. */
+	prof = boot_prof_begin(BOOT_PROF_LOAD_IMAGES, 0U);
 	next_bl_ep_info = bl2_load_images();
+	boot_prof_end(prof);
 
 	/* Teardown the Measured Boot backend */
+	prof = boot_prof_begin(BOOT_PROF_AUTH_FINISH, 0U);
 	bl2_plat_mboot_finish();
 
 	crypto_mod_finish();
+	boot_prof_end(prof);
+
+	boot_prof_stage_exit();
 
 #if !BL2_RUNS_AT_EL3
 #ifndef __aarch64__
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2025, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -20,5 +20,25 @@ struct entry_point_info;
 void bl2_arch_setup(void);
 struct entry_point_info *bl2_load_images(void);
 void bl2_run_next_image(const struct entry_point_info *bl_ep_info);
+int bl2_load_image(const bl_load_info_node_t *node_info);
+void bl2_image_loaded(const bl_load_info_node_t *node_info, int err);
+
+#if BL2_CONCURRENT_LOAD
+void bl2_load_queue_add(const bl_load_info_node_t *node_info);
+void bl2_load_queue_flush(void);
+void bl2_load_queue_close(void);
+#else
+static inline void bl2_load_queue_add(const bl_load_info_node_t *node_info)
+{
+}
+
+static inline void bl2_load_queue_flush(void)
+{
+}
+
+static inline void bl2_load_queue_close(void)
+{
+}
+#endif /* BL2_CONCURRENT_LOAD */
 
 #endif /* BL2_PRIVATE_H */
@@ -57,6 +57,25 @@ VENDOR_EL3_SRCS		+=	services/el3/ven_el3_svc.c
 ifeq (${ENABLE_PMF}, 1)
 BL31_SOURCES		+=	lib/pmf/pmf_main.c				\
 				${VENDOR_EL3_SRCS}
+ifeq (${PMF_RING}, 1)
+BL31_SOURCES		+=	lib/pmf/pmf_ring.c
+# The drain buffer is mapped when the Normal world sets it up
+BL31_CPPFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC
+endif
+endif
+
+ifeq (${BOOT_PROFILE},1)
+BL31_SOURCES		+=	common/boot_prof.c
+endif
+
+# The PSCI_STAT_HIST dump maps the Normal world buffer it is copied to
+ifeq (${PSCI_STAT_HIST},1)
+BL31_CPPFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC
+endif
+
+ifeq (${SPINLOCK_STATS},1)
+BL31_SOURCES		+=	lib/locks/exclusive/spinlock_stats.c		\
+				${VENDOR_EL3_SRCS}
 endif
 
 include lib/debugfs/debugfs.mk
@@ -208,6 +227,7 @@ $(eval $(call assert_booleans,\
     $(sort \
 	CRASH_REPORTING \
 	EL3_EXCEPTION_HANDLING \
+	SDEI_DISPATCH_STATS \
 	SDEI_SUPPORT \
 	USE_DSU_DRIVER \
 )))
@@ -216,6 +236,7 @@ $(eval $(call add_defines,\
     $(sort \
 	CRASH_REPORTING \
 	EL3_EXCEPTION_HANDLING \
+	SDEI_DISPATCH_STATS \
 	SDEI_SUPPORT \
 	USE_DSU_DRIVER \
 )))
@@ -13,10 +13,12 @@
 #include <bl31/bl31.h>
 #include <bl31/ehf.h>
 #include <common/bl_common.h>
+#include <common/boot_prof.h>
 #include <common/build_message.h>
 #include <common/debug.h>
 #include <common/feat_detect.h>
 #include <common/runtime_svc.h>
+#include <common/tf_log_ring.h>
 #include <drivers/arm/dsu.h>
 #include <drivers/arm/gic.h>
 #include <drivers/console.h>
@@ -26,6 +28,7 @@
 #include <lib/pmf/pmf.h>
 #include <lib/runtime_instr.h>
 #include <plat/common/platform.h>
+#include <services/bl31_lfa.h>
 #include <services/std_svc.h>
 
 #if ENABLE_RUNTIME_INSTRUMENTATION
@@ -97,6 +100,8 @@ static void __init bl31_lib_init(void)
 void bl31_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 		u_register_t arg3)
 {
+	boot_prof_stage_entry();
+
 	/* Enable early console if EARLY_CONSOLE flag is enabled */
 	plat_setup_early_console();
 
@@ -120,6 +125,10 @@ void bl31_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
  ******************************************************************************/
 void bl31_main(void)
 {
+	unsigned int prof;
+
+	boot_prof_init();
+
 	/* Init registers that never change for the lifetime of TF-A */
 	cm_manage_extensions_el3(plat_my_core_pos());
 
@@ -145,7 +154,9 @@ void bl31_main(void)
 #endif
 
 	/* Perform platform setup in BL31 */
+	prof = boot_prof_begin(BOOT_PROF_PLAT_SETUP, 0U);
 	bl31_platform_setup();
+	boot_prof_end(prof);
 
 #if USE_DSU_DRIVER
 	dsu_driver_init(&plat_dsu_data);
@@ -154,13 +165,20 @@ void bl31_main(void)
 #if USE_GIC_DRIVER
 	/*
 	 * Initialize the GIC driver as well as per-cpu and global interfaces.
-	 * Platform has had an opportunity to initialise specifics.
+	 * Platform has had an opportunity to initialise specifics. A live
+	 * activated image inherits the GIC configuration of the previous one
+	 * and only initialises the driver state.
 	 */
 	unsigned int core_pos = plat_my_core_pos();
 
-	gic_init(core_pos);
-	gic_pcpu_init(core_pos);
-	gic_cpuif_enable(core_pos);
+	if (lfa_bl31_activation_in_progress()) {
+		gic_attach(core_pos);
+		gic_pcpu_attach(core_pos);
+	} else {
+		gic_init(core_pos);
+		gic_pcpu_init(core_pos);
+		gic_cpuif_enable(core_pos);
+	}
 #endif /* USE_GIC_DRIVER */
 
 	/* Initialise helper libraries */
@@ -175,6 +193,21 @@ void bl31_main(void)
 	INFO("BL31: Initializing runtime services\n");
 	runtime_svc_init();
 
+#if LFA_SUPPORT
+	/*
+	 * If this image has been live activated, BL32, RMM and BL33 are already
+	 * running. Resume the contexts migrated from the previous image instead
+	 * of preparing the entry into the next image.
+	 */
+	if (lfa_bl31_activation_in_progress()) {
+		lfa_bl31_primary_finish();
+		bl31_plat_runtime_setup();
+		console_flush();
+		console_switch_state(CONSOLE_FLAG_RUNTIME);
+		return;
+	}
+#endif /* LFA_SUPPORT */
+
 	/*
 	 * All the cold boot actions on the primary cpu are done. We now need to
 	 * decide which is the next image and how to execute it.
@@ -236,6 +269,16 @@ void bl31_main(void)
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL31_EXIT, PMF_CACHE_MAINT);
 #endif
 
+	/* Report the timeline of all the boot images */
+	boot_prof_stage_exit();
+	boot_prof_report();
+
+#if LOG_RING_BUFFER
+	/* Account for the boot output before reporting the log ring cost */
+	tf_log_ring_drain();
+	tf_log_ring_report();
+#endif
+
 	console_flush();
 	console_switch_state(CONSOLE_FLAG_RUNTIME);
 }
@@ -1,21 +1,24 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2025, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arch.h>
 #include <arch_features.h>
 #include <arch_helpers.h>
 #include <common/bl_common.h>
+#include <common/boot_prof.h>
 #include <common/build_message.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
 #include <drivers/io/io_storage.h>
+#include <lib/spinlock.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
 #include <plat/common/platform.h>
@@ -48,6 +51,76 @@ static int dyn_is_auth_disabled(void)
 }
 #endif /* TRUSTED_BOARD_BOOT */
 
+#if BL2_CONCURRENT_LOAD && defined(IMAGE_BL2)
+/*
+ * BL2 may load several images at once on different CPUs, see
+ * bl2_load_images(). Neither the IO layer nor the authentication framework
+ * (with the crypto library and the measured boot backend) is reentrant, so
+ * each of them is used by one CPU at a time. A chain of trust is authenticated
+ * as a whole under bl_auth_lock, see load_auth_image_internal(), so the reads
+ * of an image only overlap with the authentication of another one when it is
+ * not authenticated.
+ */
+typedef struct bl_load_lock {
+	spinlock_t lock;
+	/* Time spent waiting for the lock, in ticks */
+	uint64_t wait_ticks;
+} bl_load_lock_t;
+
+static bl_load_lock_t bl_io_lock;
+static bl_load_lock_t bl_auth_lock;
+
+static void bl_load_lock(bl_load_lock_t *lock)
+{
+	uint64_t start = read_cntpct_el0();
+
+	spin_lock(&lock->lock);
+	lock->wait_ticks += read_cntpct_el0() - start;
+}
+
+static void bl_load_unlock(bl_load_lock_t *lock)
+{
+	spin_unlock(&lock->lock);
+}
+
+/*
+ * Return the time the CPUs spent waiting for one another to load images. It
+ * must be called while no image is being loaded.
+ */
+uint64_t bl_load_lock_wait_ticks(void)
+{
+	return bl_io_lock.wait_ticks + bl_auth_lock.wait_ticks;
+}
+
+/*
+ * The images loaded concurrently are measured by bl2_image_loaded(), in list
+ * order rather than in the order their loading completes, so that the event
+ * log and the PCRs do not change from one boot to the next.
+ */
+static bool bl_measure_deferred(const image_info_t *image_data)
+{
+	return (image_data->h.attr & IMAGE_ATTRIB_CONCURRENT) != 0U;
+}
+#else
+typedef int bl_load_lock_t;
+
+static bl_load_lock_t bl_io_lock __unused;
+static bl_load_lock_t bl_auth_lock __unused;
+
+static inline void bl_load_lock(bl_load_lock_t *lock __unused)
+{
+}
+
+static inline void bl_load_unlock(bl_load_lock_t *lock __unused)
+{
+}
+
+static inline bool bl_measure_deferred(const image_info_t *image_data __unused)
+{
+	return false;
+}
+#endif /* BL2_CONCURRENT_LOAD && defined(IMAGE_BL2) */
+
 uintptr_t page_align(uintptr_t value, unsigned dir)
 {
 	/* Round up the limit to the next page boundary */
@@ -68,7 +141,7 @@ uintptr_t page_align(uintptr_t value, unsigned dir)
  *
  * Returns 0 on success, a negative error code otherwise.
  ******************************************************************************/
-static int load_image(unsigned int image_id, image_info_t *image_data)
+static int load_image_unlocked(unsigned int image_id, image_info_t *image_data)
 {
 	uintptr_t dev_handle;
 	uintptr_t image_handle;
@@ -144,6 +217,20 @@ exit:
 	return io_result;
 }
 
+static int load_image(unsigned int image_id, image_info_t *image_data)
+{
+	unsigned int prof;
+	int rc;
+
+	bl_load_lock(&bl_io_lock);
+	prof = boot_prof_begin(BOOT_PROF_IMAGE_LOAD, image_id);
+	rc = load_image_unlocked(image_id, image_data);
+	boot_prof_end(prof);
+	bl_load_unlock(&bl_io_lock);
+
+	return rc;
+}
+
 #if TRUSTED_BOARD_BOOT
 /*
  * This function uses recursion to authenticate the parent images up to the root
@@ -153,7 +240,7 @@ static int load_auth_image_recursive(unsigned int image_id,
 				    image_info_t *image_data)
 {
 	int rc;
-	unsigned int parent_id;
+	unsigned int parent_id, prof;
 
 	/* Use recursion to authenticate parent images */
 	rc = auth_mod_get_parent_id(image_id, &parent_id);
@@ -171,9 +258,11 @@ static int load_auth_image_recursive(unsigned int image_id,
 	}
 
 	/* Authenticate it */
+	prof = boot_prof_begin(BOOT_PROF_IMAGE_AUTH, image_id);
 	rc = auth_mod_verify_img(image_id,
 				 (void *)image_data->image_base,
 				 image_data->image_size);
+	boot_prof_end(prof);
 	if (rc != 0) {
 		/* Authentication error, zero memory and flush it right away. */
 		zero_normalmem((void *)image_data->image_base,
@@ -191,8 +280,20 @@ static int load_auth_image_internal(unsigned int image_id,
 				    image_info_t *image_data)
 {
 #if TRUSTED_BOARD_BOOT
+	int rc;
+
 	if (dyn_is_auth_disabled() == 0) {
-		return load_auth_image_recursive(image_id, image_data);
+		/*
+		 * The parameters a certificate passes to its children, such as
+		 * a content certificate key, may be held in buffers shared by
+		 * several chains of trust. Authenticate the whole chain before
+		 * another CPU may overwrite them.
+		 */
+		bl_load_lock(&bl_auth_lock);
+		rc = load_auth_image_recursive(image_id, image_data);
+		bl_load_unlock(&bl_auth_lock);
+
+		return rc;
 	}
 #endif
 
@@ -208,7 +309,8 @@ static int load_auth_image_internal(unsigned int image_id,
  ******************************************************************************/
 int load_auth_image(unsigned int image_id, image_info_t *image_data)
 {
-	int err;
+	unsigned int prof;
+	int err, rc;
 
 	if ((plat_try_img_ops == NULL) || (plat_try_img_ops->next_instance == NULL)) {
 		err = load_auth_image_internal(image_id, image_data);
@@ -216,7 +318,10 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 		do {
 			err = load_auth_image_internal(image_id, image_data);
 			if (err != 0) {
-				if (plat_try_img_ops->next_instance(image_id) != 0) {
+				bl_load_lock(&bl_io_lock);
+				rc = plat_try_img_ops->next_instance(image_id);
+				bl_load_unlock(&bl_io_lock);
+				if (rc != 0) {
 					return err;
 				}
 			}
@@ -229,17 +334,24 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 		 * authentication in case of Trusted-Boot flow) then measure
 		 * it (if MEASURED_BOOT flag is enabled).
 		 */
-		err = plat_mboot_measure_image(image_id, image_data);
-		if (err != 0) {
-			return err;
+		if (!bl_measure_deferred(image_data)) {
+			prof = boot_prof_begin(BOOT_PROF_IMAGE_MEASURE,
+					       image_id);
+			err = plat_mboot_measure_image(image_id, image_data);
+			boot_prof_end(prof);
+			if (err != 0) {
+				return err;
+			}
 		}
 
 		/*
 		 * Flush the image to main memory so that it can be executed
 		 * later by any CPU, regardless of cache and MMU state.
 		 */
+		prof = boot_prof_begin(BOOT_PROF_IMAGE_FLUSH, image_id);
 		flush_dcache_range(image_data->image_base,
 				   image_data->image_size);
+		boot_prof_end(prof);
 	}
 
 	return err;
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/boot_prof.h>
+#include <common/debug.h>
+#include <lib/cassert.h>
+#include <lib/spinlock.h>
+
+#include <platform_def.h>
+
+#if !defined(PLAT_BOOT_PROF_BASE) || !defined(PLAT_BOOT_PROF_SIZE)
+#error "BOOT_PROFILE requires PLAT_BOOT_PROF_BASE and PLAT_BOOT_PROF_SIZE"
+#endif
+
+CASSERT(((PLAT_BOOT_PROF_BASE % sizeof(uint64_t)) == 0U) &&
+	(PLAT_BOOT_PROF_SIZE >= (sizeof(struct boot_prof_header) +
+				 sizeof(struct boot_prof_record))),
+	assert_boot_prof_region_invalid);
+
+#define BOOT_PROF_MAX_RECORDS						\
+	((PLAT_BOOT_PROF_SIZE - sizeof(struct boot_prof_header)) /	\
+	 sizeof(struct boot_prof_record))
+
+#if defined(IMAGE_BL1)
+#define BOOT_PROF_STAGE_ID	BOOT_PROF_STAGE_BL1
+#elif defined(IMAGE_BL2)
+#define BOOT_PROF_STAGE_ID	BOOT_PROF_STAGE_BL2
+#else
+#define BOOT_PROF_STAGE_ID	BOOT_PROF_STAGE_BL31
+#endif
+
+/*
+ * The image entered from reset starts a new profile, as the region may hold
+ * the one of a previous boot. The other images append to the profile left by
+ * the previous image, or start a new one if they cannot find it.
+ */
+#if defined(IMAGE_BL1) || (defined(IMAGE_BL2) && RESET_TO_BL2) || \
+	(defined(IMAGE_BL31) && RESET_TO_BL31)
+#define BOOT_PROF_FIRST_IMAGE	true
+#else
+#define BOOT_PROF_FIRST_IMAGE	false
+#endif
+
+/*
+ * Phases recorded before boot_prof_init(), while the region may not be mapped
+ * yet, are kept in the image. Their handles are flagged with
+ * BOOT_PROF_EARLY_FLAG and are still valid once the records are copied.
+ */
+#define BOOT_PROF_EARLY_COUNT	U(4)
+#define BOOT_PROF_EARLY_FLAG	U(0x80000000)
+
+static struct boot_prof_record early_records[BOOT_PROF_EARLY_COUNT];
+static unsigned int early_count;
+static unsigned int early_base;
+
+static unsigned int stage_handle = BOOT_PROF_INVALID;
+
+/* Set once the region is attached. BL2 may record phases from several CPUs */
+static struct boot_prof_header *prof;
+static spinlock_t prof_lock;
+
+static struct boot_prof_record *boot_prof_records(void)
+{
+	return (struct boot_prof_record *)(PLAT_BOOT_PROF_BASE +
+					   sizeof(struct boot_prof_header));
+}
+
+/*
+ * The region may be mapped as Device memory, so the records are written a
+ * field at a time rather than with memcpy().
+ */
+static void boot_prof_record_set(struct boot_prof_record *rec,
+				 unsigned int stage, unsigned int phase,
+				 unsigned int arg, uint64_t start,
+				 uint32_t ticks)
+{
+	rec->start = start;
+	rec->ticks = ticks;
+	rec->phase = (uint8_t)phase;
+	rec->stage = (uint8_t)stage;
+	rec->arg = (uint16_t)arg;
+}
+
+static unsigned int boot_prof_alloc(void)
+{
+	unsigned int handle = BOOT_PROF_INVALID;
+
+	spin_lock(&prof_lock);
+	if (prof->count < prof->max) {
+		handle = prof->count;
+		prof->count = handle + 1U;
+	} else {
+		prof->dropped++;
+	}
+	spin_unlock(&prof_lock);
+
+	return handle;
+}
+
+static struct boot_prof_record *boot_prof_record_get(unsigned int handle)
+{
+	if (handle == BOOT_PROF_INVALID) {
+		return NULL;
+	}
+
+	if ((handle & BOOT_PROF_EARLY_FLAG) != 0U) {
+		handle &= ~BOOT_PROF_EARLY_FLAG;
+		if (prof == NULL) {
+			return &early_records[handle];
+		}
+		handle += early_base;
+	}
+
+	/* An early record may have been dropped when it was copied */
+	if ((prof == NULL) || (handle >= prof->count)) {
+		return NULL;
+	}
+
+	return &boot_prof_records()[handle];
+}
+
+unsigned int boot_prof_begin(unsigned int phase, unsigned int arg)
+{
+	uint64_t start = read_cntpct_el0();
+	unsigned int handle;
+
+	if (prof == NULL) {
+		if (early_count == BOOT_PROF_EARLY_COUNT) {
+			return BOOT_PROF_INVALID;
+		}
+
+		handle = early_count++;
+		boot_prof_record_set(&early_records[handle], BOOT_PROF_STAGE_ID,
+				     phase, arg, start, BOOT_PROF_IN_PROGRESS);
+
+		return handle | BOOT_PROF_EARLY_FLAG;
+	}
+
+	handle = boot_prof_alloc();
+	if (handle != BOOT_PROF_INVALID) {
+		boot_prof_record_set(&boot_prof_records()[handle],
+				     BOOT_PROF_STAGE_ID, phase, arg, start,
+				     BOOT_PROF_IN_PROGRESS);
+	}
+
+	return handle;
+}
+
+void boot_prof_end(unsigned int handle)
+{
+	uint64_t ticks = read_cntpct_el0();
+	struct boot_prof_record *rec = boot_prof_record_get(handle);
+
+	if (rec == NULL) {
+		return;
+	}
+
+	ticks -= rec->start;
+	if (ticks >= BOOT_PROF_IN_PROGRESS) {
+		ticks = BOOT_PROF_IN_PROGRESS - 1U;
+	}
+
+	rec->ticks = (uint32_t)ticks;
+}
+
+void boot_prof_init(void)
+{
+	struct boot_prof_header *hdr =
+		(struct boot_prof_header *)PLAT_BOOT_PROF_BASE;
+	const struct boot_prof_record *rec;
+	unsigned int i, handle;
+
+	assert(prof == NULL);
+
+	if (BOOT_PROF_FIRST_IMAGE || (hdr->magic != BOOT_PROF_MAGIC) ||
+	    (hdr->max != BOOT_PROF_MAX_RECORDS) ||
+	    (hdr->count > BOOT_PROF_MAX_RECORDS)) {
+		hdr->magic = 0U;
+		hdr->count = 0U;
+		hdr->max = BOOT_PROF_MAX_RECORDS;
+		hdr->dropped = 0U;
+		hdr->freq = read_cntfrq_el0();
+		hdr->magic = BOOT_PROF_MAGIC;
+	}
+
+	prof = hdr;
+	early_base = hdr->count;
+
+	/* Once the region is full, the following early records are dropped */
+	for (i = 0U; i < early_count; i++) {
+		rec = &early_records[i];
+		handle = boot_prof_alloc();
+		if (handle != BOOT_PROF_INVALID) {
+			boot_prof_record_set(&boot_prof_records()[handle],
+					     rec->stage, rec->phase, rec->arg,
+					     rec->start, rec->ticks);
+		}
+	}
+}
+
+void boot_prof_stage_entry(void)
+{
+	stage_handle = boot_prof_begin(BOOT_PROF_STAGE, 0U);
+}
+
+void boot_prof_stage_exit(void)
+{
+	boot_prof_end(stage_handle);
+
+	/* Make the profile visible to the next image if the region is cached */
+	if (prof != NULL) {
+		flush_dcache_range(PLAT_BOOT_PROF_BASE, PLAT_BOOT_PROF_SIZE);
+	}
+}
+
+#if defined(IMAGE_BL31)
+#define BOOT_PROF_LINE_SIZE	U(64)
+
+static const char *const boot_prof_phase_names[BOOT_PROF_PHASE_COUNT] = {
+	[BOOT_PROF_STAGE]		= "image",
+	[BOOT_PROF_CONSOLE_INIT]	= "console_init",
+	[BOOT_PROF_DDR_INIT]		= "ddr_init",
+	[BOOT_PROF_STORAGE_INIT]	= "storage_init",
+	[BOOT_PROF_AUTH_INIT]		= "auth_init",
+	[BOOT_PROF_PLAT_SETUP]		= "plat_setup",
+	[BOOT_PROF_PRELOAD]		= "preload",
+	[BOOT_PROF_LOAD_IMAGES]		= "load_images",
+	[BOOT_PROF_IMAGE_LOAD]		= "load",
+	[BOOT_PROF_IMAGE_AUTH]		= "auth",
+	[BOOT_PROF_IMAGE_DECOMPRESS]	= "decompress",
+	[BOOT_PROF_IMAGE_MEASURE]	= "measure",
+	[BOOT_PROF_IMAGE_FLUSH]		= "flush",
+	[BOOT_PROF_AUTH_FINISH]		= "auth_finish",
+};
+
+static const char *boot_prof_phase_name(unsigned int phase)
+{
+	if (phase < BOOT_PROF_PHASE_COUNT) {
+		return boot_prof_phase_names[phase];
+	}
+
+	return (phase >= BOOT_PROF_PLAT_BASE) ? "platform" : "unknown";
+}
+
+static unsigned long long boot_prof_ticks_to_us(uint64_t ticks)
+{
+	uint64_t freq = (prof->freq != 0U) ? prof->freq : read_cntfrq_el0();
+
+	/* Split the conversion so that counter values do not overflow */
+	return (unsigned long long)(((ticks / freq) * 1000000ULL) +
+				    (((ticks % freq) * 1000000ULL) / freq));
+}
+
+/*
+ * Format a line of the timeline: the column titles, then a record per line.
+ * The libc snprintf() does not pad strings, so they come last and the phases
+ * nested in the image one are indented.
+ */
+static int boot_prof_format(unsigned int line, char *buf, size_t size)
+{
+	const struct boot_prof_record *rec;
+	const char *stage, *indent;
+
+	if (line == 0U) {
+		return snprintf(buf, size,
+				" start(us)   time(us)   arg image phase\n");
+	}
+
+	rec = &boot_prof_records()[line - 1U];
+
+	switch (rec->stage) {
+	case BOOT_PROF_STAGE_BL1:
+		stage = "BL1 ";
+		break;
+	case BOOT_PROF_STAGE_BL2:
+		stage = "BL2 ";
+		break;
+	case BOOT_PROF_STAGE_BL31:
+		stage = "BL31";
+		break;
+	default:
+		stage = "?   ";
+		break;
+	}
+
+	indent = (rec->phase == BOOT_PROF_STAGE) ? "" : "  ";
+
+	if (rec->ticks == BOOT_PROF_IN_PROGRESS) {
+		return snprintf(buf, size, "%10llu          - %5u %s  %s%s\n",
+				boot_prof_ticks_to_us(rec->start),
+				(unsigned int)rec->arg, stage, indent,
+				boot_prof_phase_name(rec->phase));
+	}
+
+	return snprintf(buf, size, "%10llu %10llu %5u %s  %s%s\n",
+			boot_prof_ticks_to_us(rec->start),
+			boot_prof_ticks_to_us(rec->ticks),
+			(unsigned int)rec->arg, stage, indent,
+			boot_prof_phase_name(rec->phase));
+}
+
+void boot_prof_report(void)
+{
+	char line[BOOT_PROF_LINE_SIZE];
+	unsigned int i;
+
+	if (prof == NULL) {
+		return;
+	}
+
+	INFO("Boot profile: %u phases, %u dropped\n", prof->count,
+	     prof->dropped);
+
+	for (i = 0U; i <= prof->count; i++) {
+		if (boot_prof_format(i, line, sizeof(line)) < 0) {
+			break;
+		}
+		INFO("  %s", line);
+	}
+}
+
+size_t boot_prof_read(size_t offset, void *buf, size_t size)
+{
+	char line[BOOT_PROF_LINE_SIZE];
+	size_t pos = 0U, copied = 0U, len, from, chunk;
+	unsigned int i;
+	int rc;
+
+	if (prof == NULL) {
+		return 0U;
+	}
+
+	for (i = 0U; (i <= prof->count) && (copied < size); i++) {
+		rc = boot_prof_format(i, line, sizeof(line));
+		if (rc < 0) {
+			break;
+		}
+
+		len = MIN((size_t)rc, sizeof(line) - 1U);
+		if ((offset + copied) < (pos + len)) {
+			from = offset + copied - pos;
+			chunk = MIN(len - from, size - copied);
+			(void)memcpy((char *)buf + copied, &line[from], chunk);
+			copied += chunk;
+		}
+		pos += len;
+	}
+
+	return copied;
+}
+#endif /* IMAGE_BL31 */
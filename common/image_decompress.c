@@ -9,6 +9,7 @@
 
 #include <arch_helpers.h>
 #include <common/bl_common.h>
+#include <common/boot_prof.h>
 #include <common/debug.h>
 #include <common/image_decompress.h>
 
@@ -42,6 +43,7 @@ int image_decompress(struct image_info *info)
 {
 	uintptr_t compressed_image_base, image_base, work_base;
 	uint32_t compressed_image_size, work_size;
+	unsigned int prof;
 	int ret;
 
 	/*
@@ -63,9 +65,11 @@ int image_decompress(struct image_info *info)
 	work_base = compressed_image_base + compressed_image_size;
 	work_size = decompressor_buf_size - compressed_image_size;
 
+	prof = boot_prof_begin(BOOT_PROF_IMAGE_DECOMPRESS, 0U);
 	ret = decompressor(&compressed_image_base, compressed_image_size,
 			   &image_base, info->image_max_size,
 			   work_base, work_size);
+	boot_prof_end(prof);
 	if (ret) {
 		ERROR("Failed to decompress image (err=%d)\n", ret);
 		return ret;
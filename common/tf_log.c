@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2025, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 #include <stdio.h>
 
 #include <common/debug.h>
+#include <common/tf_log_ring.h>
 #include <plat/common/platform.h>
 
 /* Set the default maximum log level to the `LOG_LEVEL` build flag */
@@ -37,6 +38,22 @@ void tf_log(const char *fmt, ...)
 	if (log_level > max_log_level) {
 		return;
 	}
+
+#if LOG_RING_BUFFER
+	/*
+	 * Defer the console output of all but the most severe messages, which
+	 * are printed synchronously after any pending output.
+	 */
+	if (log_level > PLAT_LOG_RING_SYNC_LEVEL) {
+		va_start(args, fmt);
+		tf_log_ring_vprintf(log_level, fmt + 1, args);
+		va_end(args);
+		return;
+	}
+
+	tf_log_ring_drain();
+#endif
+
 	prefix_str = plat_log_get_prefix(log_level);
 
 	while (*prefix_str != '\0') {
@@ -61,6 +78,13 @@ void tf_log_newline(const char log_fmt[2])
 		return;
 	}
 
+#if LOG_RING_BUFFER
+	if (log_level > PLAT_LOG_RING_SYNC_LEVEL) {
+		tf_log_ring_putc('\n');
+		return;
+	}
+#endif
+
 	(void)putchar((int32_t)'\n');
 }
 
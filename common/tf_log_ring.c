@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/tf_log_ring.h>
+#include <drivers/console.h>
+#if defined(IMAGE_BL31)
+#include <lib/el3_runtime/pubsub_events.h>
+#endif
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+CASSERT(((PLAT_LOG_RING_SIZE & (PLAT_LOG_RING_SIZE - 1U)) == 0U) &&
+	(PLAT_LOG_RING_SIZE >= PLAT_LOG_RING_MSG_SIZE),
+	assert_log_ring_size_invalid);
+
+#define LOG_RING_MASK		(PLAT_LOG_RING_SIZE - 1U)
+
+/*
+ * The runtime images use a ring per CPU. Boot images mostly run on the
+ * primary CPU and use a single ring to limit their memory footprint.
+ */
+#if defined(IMAGE_BL31) || defined(IMAGE_BL32)
+#define LOG_RING_COUNT		PLATFORM_CORE_COUNT
+#else
+#define LOG_RING_COUNT		U(1)
+#endif
+
+/*
+ * Log ring of a CPU. The owning CPU is the only writer of 'head' and the
+ * content, while 'tail' and the drain statistics are only updated by the CPU
+ * holding the drain lock, so capturing a message never waits for the console.
+ * In the boot images, the CPUs sharing the ring hold the ring lock instead.
+ * When the ring is full, new messages are dropped rather than overwriting
+ * output which has not reached the console yet.
+ */
+struct log_ring {
+	char buf[PLAT_LOG_RING_SIZE];
+	volatile u_register_t head;
+	volatile u_register_t tail;
+
+	/* Updated by the owning CPU */
+	uint64_t messages;
+	uint64_t bytes;
+	uint64_t dropped;
+	uint64_t capture_ticks;
+
+	/* Updated under the drain lock */
+	uint64_t drained;
+	uint64_t drain_ticks;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct log_ring log_rings[LOG_RING_COUNT];
+
+/*
+ * The runtime images drain the rings of all the CPUs under a lock. The boot
+ * images share their single ring between the CPUs that BL2 may load images
+ * with, so its writers and drains are serialised by one lock.
+ */
+#if defined(IMAGE_BL31) || defined(IMAGE_BL32)
+static spinlock_t drain_lock;
+#else
+static spinlock_t ring_lock;
+#endif
+
+/*
+ * Exclusive accesses to non-cacheable memory may never succeed, so the locks
+ * are not taken until the data cache is enabled. Only the primary CPU runs
+ * before then, for example when an early platform setup error is printed.
+ */
+static bool log_ring_lock(spinlock_t *lock)
+{
+	if (!is_dcache_enabled()) {
+		return false;
+	}
+
+	spin_lock(lock);
+
+	return true;
+}
+
+static void log_ring_unlock(spinlock_t *lock, bool locked)
+{
+	if (locked) {
+		spin_unlock(lock);
+	}
+}
+
+static struct log_ring *log_ring_get(void)
+{
+	if (LOG_RING_COUNT == 1U) {
+		return &log_rings[0];
+	}
+
+	return &log_rings[plat_my_core_pos()];
+}
+
+static void log_ring_write(const char *data, size_t len, uint64_t start)
+{
+	struct log_ring *ring = log_ring_get();
+	u_register_t head;
+	size_t first;
+#if !(defined(IMAGE_BL31) || defined(IMAGE_BL32))
+	bool locked = log_ring_lock(&ring_lock);
+#endif
+
+	head = ring->head;
+	if (len > (PLAT_LOG_RING_SIZE - (head - ring->tail))) {
+		ring->dropped++;
+	} else {
+		first = PLAT_LOG_RING_SIZE - (head & LOG_RING_MASK);
+		if (first > len) {
+			first = len;
+		}
+
+		(void)memcpy(&ring->buf[head & LOG_RING_MASK], data, first);
+		(void)memcpy(&ring->buf[0], &data[first], len - first);
+
+		/* Make the content visible before publishing it */
+		dmbish();
+		ring->head = head + len;
+
+		ring->messages++;
+		ring->bytes += len;
+	}
+
+	ring->capture_ticks += read_cntpct_el0() - start;
+
+#if !(defined(IMAGE_BL31) || defined(IMAGE_BL32))
+	log_ring_unlock(&ring_lock, locked);
+#endif
+}
+
+void tf_log_ring_vprintf(uint32_t log_level, const char *fmt, va_list args)
+{
+	char msg[PLAT_LOG_RING_MSG_SIZE];
+	uint64_t start = read_cntpct_el0();
+	const char *prefix_str = plat_log_get_prefix(log_level);
+	size_t len = 0U;
+	int ret;
+
+	while ((*prefix_str != '\0') && (len < (sizeof(msg) - 1U))) {
+		msg[len] = *prefix_str;
+		prefix_str++;
+		len++;
+	}
+
+	ret = vsnprintf(&msg[len], sizeof(msg) - len, fmt, args);
+	if (ret > 0) {
+		if ((size_t)ret >= (sizeof(msg) - len)) {
+			/* Truncated, keep the line terminated */
+			len = sizeof(msg) - 1U;
+			msg[len - 1U] = '\n';
+		} else {
+			len += (size_t)ret;
+		}
+	}
+
+	log_ring_write(msg, len, start);
+}
+
+void tf_log_ring_putc(char c)
+{
+	log_ring_write(&c, 1U, read_cntpct_el0());
+}
+
+/*
+ * Every direct console write drains the rings first, so check for pending
+ * output without taking any lock.
+ */
+static bool log_ring_pending(void)
+{
+	unsigned int i;
+
+	for (i = 0U; i < LOG_RING_COUNT; i++) {
+		if (log_rings[i].head != log_rings[i].tail) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void tf_log_ring_drain(void)
+{
+	struct log_ring *ring;
+	u_register_t head, tail;
+	uint64_t start;
+	unsigned int i;
+	bool locked;
+
+	if (!log_ring_pending()) {
+		return;
+	}
+
+#if defined(IMAGE_BL31) || defined(IMAGE_BL32)
+	locked = log_ring_lock(&drain_lock);
+#else
+	locked = log_ring_lock(&ring_lock);
+#endif
+
+	for (i = 0U; i < LOG_RING_COUNT; i++) {
+		ring = &log_rings[i];
+		head = ring->head;
+		tail = ring->tail;
+		if (head == tail) {
+			continue;
+		}
+
+		/* Read the content only after the head it was published by */
+		dmbish();
+
+		start = read_cntpct_el0();
+		/* Not putchar(), which drains the rings itself */
+		for (; tail != head; tail++) {
+			(void)console_putc((int)ring->buf[tail & LOG_RING_MASK]);
+		}
+
+		/* Release the space only once it has been consumed */
+		dmbish();
+		ring->drained += head - ring->tail;
+		ring->tail = head;
+		ring->drain_ticks += read_cntpct_el0() - start;
+	}
+
+#if defined(IMAGE_BL31) || defined(IMAGE_BL32)
+	log_ring_unlock(&drain_lock, locked);
+#else
+	log_ring_unlock(&ring_lock, locked);
+#endif
+}
+
+size_t tf_log_ring_read(size_t offset, void *buf, size_t size)
+{
+	char *out = buf;
+	struct log_ring *ring;
+	u_register_t head, pos;
+	size_t copied = 0U, len;
+	unsigned int i;
+
+	for (i = 0U; (i < LOG_RING_COUNT) && (copied < size); i++) {
+		ring = &log_rings[i];
+		head = ring->head;
+		dmbish();
+
+		/* Everything written in the last PLAT_LOG_RING_SIZE bytes */
+		len = (head < PLAT_LOG_RING_SIZE) ? head : PLAT_LOG_RING_SIZE;
+		if (offset >= len) {
+			offset -= len;
+			continue;
+		}
+
+		for (pos = head - len + offset; (pos != head) && (copied < size);
+		     pos++) {
+			out[copied] = ring->buf[pos & LOG_RING_MASK];
+			copied++;
+		}
+
+		offset = 0U;
+	}
+
+	return copied;
+}
+
+void tf_log_ring_get_stats(struct tf_log_ring_stats *stats)
+{
+	const struct log_ring *ring;
+	unsigned int i;
+
+	assert(stats != NULL);
+
+	(void)memset(stats, 0, sizeof(*stats));
+
+	for (i = 0U; i < LOG_RING_COUNT; i++) {
+		ring = &log_rings[i];
+		stats->messages += ring->messages;
+		stats->bytes += ring->bytes;
+		stats->dropped += ring->dropped;
+		stats->drained += ring->drained;
+		stats->capture_ticks += ring->capture_ticks;
+		stats->drain_ticks += ring->drain_ticks;
+	}
+}
+
+static unsigned long long log_ring_ticks_to_us(uint64_t ticks)
+{
+	return (unsigned long long)((ticks * 1000000ULL) / read_cntfrq_el0());
+}
+
+/*
+ * Report the time spent capturing messages, against the time that the same
+ * output has spent waiting on the console once drained.
+ */
+void tf_log_ring_report(void)
+{
+	struct tf_log_ring_stats stats;
+
+	tf_log_ring_get_stats(&stats);
+
+	INFO("Log ring: %llu messages, %llu bytes, %llu dropped\n",
+	     (unsigned long long)stats.messages,
+	     (unsigned long long)stats.bytes,
+	     (unsigned long long)stats.dropped);
+	INFO("Log ring: capture %lluus, console %lluus for %llu bytes\n",
+	     log_ring_ticks_to_us(stats.capture_ticks),
+	     log_ring_ticks_to_us(stats.drain_ticks),
+	     (unsigned long long)stats.drained);
+}
+
+#if defined(IMAGE_BL31)
+/* A CPU entering a power down state is idle, drain the rings from there */
+static void *tf_log_ring_suspend_drain(const void *arg)
+{
+	tf_log_ring_drain();
+
+	return (void *)0;
+}
+
+SUBSCRIBE_TO_EVENT(psci_suspend_pwrdown_start, tf_log_ring_suspend_drain);
+#endif /* IMAGE_BL31 */
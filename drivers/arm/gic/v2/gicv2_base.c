@@ -44,6 +44,15 @@ void __init gic_init(unsigned int cpu_idx)
 	gicv2_distif_init();
 }
 
+/******************************************************************************
+ * ARM common helper to initialize the GICv2 only driver data without
+ * programming the Distributor, which was configured by a previous BL31 image
+ *****************************************************************************/
+void __init gic_attach(unsigned int cpu_idx)
+{
+	gicv2_driver_init(&arm_gic_data);
+}
+
 /******************************************************************************
  * ARM common helper to enable the GICv2 CPU interface
  *****************************************************************************/
@@ -69,6 +78,16 @@ void gic_pcpu_init(unsigned int cpu_idx)
 	gicv2_set_pe_target_mask(plat_my_core_pos());
 }
 
+/******************************************************************************
+ * ARM common helper to record the target mask of this CPU without programming
+ * the per cpu distributor interface, which was configured by a previous BL31
+ * image
+ *****************************************************************************/
+void gic_pcpu_attach(unsigned int cpu_idx)
+{
+	gicv2_set_pe_target_mask(plat_my_core_pos());
+}
+
 /******************************************************************************
  * Stubs for Redistributor power management. Although GICv2 doesn't have
  * Redistributor interface, these are provided for the sake of uniform GIC API
@@ -10,6 +10,8 @@ GICV3_SUPPORT_GIC600		?=	0
 GICV3_SUPPORT_GIC600AE_FMU	?=	0
 GICV3_IMPL_GIC600_MULTICHIP	?=	0
 GICV3_OVERRIDE_DISTIF_PWR_OPS	?=	0
+GICV3_SHADOW_STATE		?=	0
+GICV3_ZERO_RESET_CFG		?=	0
 GIC_ENABLE_V4_EXTN		?=	0
 GIC_EXT_INTID			?=	0
 GIC600_ERRATA_WA_2384374	?=	${GICV3_SUPPORT_GIC600}
@@ -45,6 +47,14 @@ $(eval $(call add_define,GICV3_SUPPORT_GIC600AE_FMU))
 $(eval $(call assert_boolean,GICV3_IMPL_GIC600_MULTICHIP))
 $(eval $(call add_define,GICV3_IMPL_GIC600_MULTICHIP))
 
+# Set incremental context save and restore
+$(eval $(call assert_boolean,GICV3_SHADOW_STATE))
+$(eval $(call add_define,GICV3_SHADOW_STATE))
+
+# Set Distributor configuration registers resetting to zero
+$(eval $(call assert_boolean,GICV3_ZERO_RESET_CFG))
+$(eval $(call add_define,GICV3_ZERO_RESET_CFG))
+
 # Set GICv4 extension
 $(eval $(call assert_boolean,GIC_ENABLE_V4_EXTN))
 $(eval $(call add_define,GIC_ENABLE_V4_EXTN))
@@ -11,6 +11,8 @@
 #include <common/interrupt_props.h>
 #include <drivers/arm/gic.h>
 #include <drivers/arm/gicv3.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <lib/utils.h>
 #include <plat/arm/common/plat_arm.h>
 #include <plat/common/platform.h>
@@ -119,12 +121,20 @@ void gic_cpuif_disable(unsigned int cpu_idx)
 	gicv3_cpuif_disable(cpu_idx);
 }
 
+/******************************************************************************
+ * ARM common helper to initialize the GIC driver data without programming the
+ * Distributor, which was configured by a previous BL31 image
+ *****************************************************************************/
+void __init gic_attach(unsigned int cpu_idx)
+{
+	gicv3_driver_init(&gic_data);
+}
+
 /******************************************************************************
  * ARM common helper function to iterate over all GICR frames and discover the
- * corresponding per-cpu redistributor frame as well as initialize the
- * corresponding interface in GICv3.
+ * corresponding per-cpu redistributor frame.
  *****************************************************************************/
-void gic_pcpu_init(unsigned int cpu_idx)
+static void gic_pcpu_probe(void)
 {
 	int result;
 	const uintptr_t *plat_gicr_frames = gicr_frames;
@@ -143,9 +153,28 @@ void gic_pcpu_init(unsigned int cpu_idx)
 		ERROR("No GICR base frame found for CPU 0x%lx\n", read_mpidr());
 		panic();
 	}
+}
+
+/******************************************************************************
+ * ARM common helper function to discover the per-cpu redistributor frame and
+ * initialize the corresponding interface in GICv3.
+ *****************************************************************************/
+void gic_pcpu_init(unsigned int cpu_idx)
+{
+	gic_pcpu_probe();
 	gicv3_rdistif_init(cpu_idx);
 }
 
+/******************************************************************************
+ * ARM common helper function to discover the per-cpu redistributor frame
+ * without programming the interface, which was configured by a previous BL31
+ * image.
+ *****************************************************************************/
+void gic_pcpu_attach(unsigned int cpu_idx)
+{
+	gic_pcpu_probe();
+}
+
 /******************************************************************************
  * ARM common helpers to power GIC redistributor interface
  *****************************************************************************/
@@ -165,6 +194,16 @@ void gic_save(void)
 	gicv3_dist_ctx_t * const dist_context =
 			(gicv3_dist_ctx_t *)LOAD_ADDR_OF(dist_ctx);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	/*
+	 * The data cache may already be disabled for the power down, so make
+	 * sure the timestamp update is reflected in memory.
+	 */
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_ENTER_GIC_SAVE,
+		PMF_CACHE_MAINT);
+#endif
+
 	/*
 	 * If an ITS is available, save its context before
 	 * the Redistributor using:
@@ -184,6 +223,12 @@ void gic_save(void)
 	/* Save the GIC Distributor context */
 	gicv3_distif_save(dist_context);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_EXIT_GIC_SAVE,
+		PMF_CACHE_MAINT);
+#endif
+
 	/*
 	 * From here, all the components of the GIC can be safely powered down
 	 * as long as there is an alternate way to handle wakeup interrupt
@@ -198,6 +243,12 @@ void gic_resume(void)
 	const gicv3_dist_ctx_t *dist_context =
 			(gicv3_dist_ctx_t *)LOAD_ADDR_OF(dist_ctx);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_ENTER_GIC_RESTORE,
+		PMF_NO_CACHE_MAINT);
+#endif
+
 	/* Restore the GIC Distributor context */
 	gicv3_distif_init_restore(dist_context);
 
@@ -217,4 +268,10 @@ void gic_resume(void)
 	 * restore the whole ITS state. The ITS must also be
 	 * re-enabled after this sequence has been executed.
 	 */
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		RT_INSTR_EXIT_GIC_RESTORE,
+		PMF_NO_CACHE_MAINT);
+#endif
 }
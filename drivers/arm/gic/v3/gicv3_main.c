@@ -44,20 +44,18 @@ static bool is_valid_interrupt(unsigned int id);
 #define RESTORE_GICR_REG(base, ctx, name, i)	\
 	gicr_write_##name((base), (i), (ctx)->gicr_##name[(i)])
 
-#define SAVE_GICR_REG(base, ctx, name, i)	\
-	(ctx)->gicr_##name[(i)] = gicr_read_##name((base), (i))
-
-/* Helper macros to save and restore GICD registers to and from the context */
-#define RESTORE_GICD_REGS(base, ctx, intr_num, reg, REG)		\
+/* As above, skipping the register if its saved value is zero and skip_zero */
+#define RESTORE_GICR_REG_NZ(base, ctx, name, i, skip_zero)		\
 	do {								\
-		for (unsigned int int_id = MIN_SPI_ID; int_id < (intr_num);\
-				int_id += (1U << REG##R_SHIFT)) {	\
-			gicd_write_##reg((base), int_id,		\
-				(ctx)->gicd_##reg[(int_id - MIN_SPI_ID) >> \
-							REG##R_SHIFT]);	\
+		if (!(skip_zero) || ((ctx)->gicr_##name[(i)] != 0U)) {	\
+			RESTORE_GICR_REG(base, ctx, name, i);		\
 		}							\
 	} while (false)
 
+#define SAVE_GICR_REG(base, ctx, name, i)	\
+	(ctx)->gicr_##name[(i)] = gicr_read_##name((base), (i))
+
+/* Helper macros to save GICD registers to the context */
 #define SAVE_GICD_REGS(base, ctx, intr_num, reg, REG)			\
 	do {								\
 		for (unsigned int int_id = MIN_SPI_ID; int_id < (intr_num);\
@@ -68,31 +66,70 @@ static bool is_valid_interrupt(unsigned int id);
 	} while (false)
 
 #if GIC_EXT_INTID
-#define RESTORE_GICD_EREGS(base, ctx, intr_num, reg, REG)		\
+#define SAVE_GICD_EREGS(base, ctx, intr_num, reg, REG)			\
 	do {								\
 		for (unsigned int int_id = MIN_ESPI_ID; int_id < (intr_num);\
 				int_id += (1U << REG##R_SHIFT)) {	\
-			gicd_write_##reg((base), int_id,		\
 			(ctx)->gicd_##reg[(int_id - (MIN_ESPI_ID -	\
 			round_up(TOTAL_SPI_INTR_NUM, 1U << REG##R_SHIFT)))\
-						>> REG##R_SHIFT]);	\
+			>> REG##R_SHIFT] = gicd_read_##reg((base), int_id);\
 		}							\
 	} while (false)
+#else
+#define SAVE_GICD_EREGS(base, ctx, intr_num, reg, REG)
+#endif /* GIC_EXT_INTID */
 
-#define SAVE_GICD_EREGS(base, ctx, intr_num, reg, REG)			\
+/*
+ * Helper macros to restore GICD registers from the context. Registers whose
+ * saved value is zero are skipped when 'skip_zero' is true, either because
+ * writing zero has no effect or because the platform guarantees that the
+ * register resets to zero (GICV3_ZERO_RESET_CFG).
+ */
+#define RESTORE_GICD_REGS(base, ctx, intr_num, reg, REG, skip_zero)	\
+	do {								\
+		for (unsigned int int_id = MIN_SPI_ID; int_id < (intr_num);\
+				int_id += (1U << REG##R_SHIFT)) {	\
+			unsigned int idx = (int_id - MIN_SPI_ID) >>	\
+							REG##R_SHIFT;	\
+			if (!(skip_zero) ||				\
+			    ((ctx)->gicd_##reg[idx] != 0U)) {		\
+				gicd_write_##reg((base), int_id,	\
+					(ctx)->gicd_##reg[idx]);	\
+			}						\
+		}							\
+	} while (false)
+
+#if GIC_EXT_INTID
+#define RESTORE_GICD_EREGS(base, ctx, intr_num, reg, REG, skip_zero)	\
 	do {								\
 		for (unsigned int int_id = MIN_ESPI_ID; int_id < (intr_num);\
 				int_id += (1U << REG##R_SHIFT)) {	\
-			(ctx)->gicd_##reg[(int_id - (MIN_ESPI_ID -	\
+			unsigned int idx = (int_id - (MIN_ESPI_ID -	\
 			round_up(TOTAL_SPI_INTR_NUM, 1U << REG##R_SHIFT)))\
-			>> REG##R_SHIFT] = gicd_read_##reg((base), int_id);\
+						>> REG##R_SHIFT;	\
+			if (!(skip_zero) ||				\
+			    ((ctx)->gicd_##reg[idx] != 0U)) {		\
+				gicd_write_##reg((base), int_id,	\
+					(ctx)->gicd_##reg[idx]);	\
+			}						\
 		}							\
 	} while (false)
 #else
-#define SAVE_GICD_EREGS(base, ctx, intr_num, reg, REG)
-#define RESTORE_GICD_EREGS(base, ctx, intr_num, reg, REG)
+#define RESTORE_GICD_EREGS(base, ctx, intr_num, reg, REG, skip_zero)
 #endif /* GIC_EXT_INTID */
 
+#if GICV3_SHADOW_STATE
+/*
+ * Distributor context which holds the current value of the Secure-only
+ * configuration registers (GICD_IGROUPR, GICD_IGRPMODR and GICD_NSACR), as
+ * last saved to or restored from. Non-secure software cannot write these
+ * registers, so they only change through this driver, which clears this
+ * reference whenever it reprograms them. Saving to the same context again
+ * then only needs to capture the registers Non-secure software can modify.
+ */
+static const gicv3_dist_ctx_t *gicd_shadow_ctx;
+#endif /* GICV3_SHADOW_STATE */
+
 /*******************************************************************************
  * This function initialises the ARM GICv3 driver in EL3 with provided platform
  * inputs.
@@ -207,6 +244,10 @@ void __init gicv3_distif_init(void)
 	gicd_set_ctlr(gicv3_driver_data->gicd_base,
 			CTLR_ARE_S_BIT | CTLR_ARE_NS_BIT, RWP_TRUE);
 
+#if GICV3_SHADOW_STATE
+	gicd_shadow_ctx = NULL;
+#endif
+
 	/* Set the default attribute of all (E)SPIs */
 	gicv3_spis_config_defaults(gicv3_driver_data->gicd_base);
 
@@ -637,6 +678,12 @@ void gicv3_rdistif_init_restore(unsigned int proc_num,
 {
 	uintptr_t gicr_base;
 	unsigned int i, ppi_regs_num, regs_num;
+	/* Writing zero to the set-enable/pending/active registers is a no-op */
+#if GICV3_SHADOW_STATE
+	bool skip_w1s = true;
+#else
+	bool skip_w1s = false;
+#endif
 
 	assert(gicv3_driver_data != NULL);
 	assert(proc_num < gicv3_driver_data->rdistif_num);
@@ -717,8 +764,10 @@ void gicv3_rdistif_init_restore(unsigned int proc_num,
 	 * 32 interrupt IDs per register
 	 */
 	for (i = 0U; i < ppi_regs_num; ++i) {
-		RESTORE_GICR_REG(gicr_base, rdist_ctx, ispendr, i);
-		RESTORE_GICR_REG(gicr_base, rdist_ctx, isactiver, i);
+		RESTORE_GICR_REG_NZ(gicr_base, rdist_ctx, ispendr, i,
+				    skip_w1s);
+		RESTORE_GICR_REG_NZ(gicr_base, rdist_ctx, isactiver, i,
+				    skip_w1s);
 	}
 
 	/*
@@ -729,7 +778,8 @@ void gicv3_rdistif_init_restore(unsigned int proc_num,
 
 	/* 32 interrupt IDs per GICR_ISENABLER register */
 	for (i = 0U; i < ppi_regs_num; ++i) {
-		RESTORE_GICR_REG(gicr_base, rdist_ctx, isenabler, i);
+		RESTORE_GICR_REG_NZ(gicr_base, rdist_ctx, isenabler, i,
+				    skip_w1s);
 	}
 
 	/*
@@ -758,6 +808,11 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
 #if GIC_EXT_INTID
 	unsigned int num_eints = gicv3_get_espi_limit(gicd_base);
 #endif
+#if GICV3_SHADOW_STATE
+	bool save_secure_cfg = (gicd_shadow_ctx != dist_ctx);
+#else
+	bool save_secure_cfg = true;
+#endif
 
 	/* Wait for pending write to complete */
 	gicd_wait_for_pending_write(gicd_base);
@@ -765,11 +820,28 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
 	/* Save the GICD_CTLR */
 	dist_ctx->gicd_ctlr = gicd_read_ctlr(gicd_base);
 
-	/* Save GICD_IGROUPR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, igroupr, IGROUP);
+	if (save_secure_cfg) {
+		/* Save GICD_IGROUPR for INTIDs 32 - 1019 */
+		SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, igroupr, IGROUP);
+
+		/* Save GICD_IGROUPRE for INTIDs 4096 - 5119 */
+		SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igroupr,
+				IGROUP);
+
+		/* Save GICD_IGRPMODR for INTIDs 32 - 1019 */
+		SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, igrpmodr,
+			       IGRPMOD);
+
+		/* Save GICD_IGRPMODRE for INTIDs 4096 - 5119 */
+		SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igrpmodr,
+				IGRPMOD);
 
-	/* Save GICD_IGROUPRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igroupr, IGROUP);
+		/* Save GICD_NSACR for INTIDs 32 - 1019 */
+		SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, nsacr, NSAC);
+
+		/* Save GICD_NSACRE for INTIDs 4096 - 5119 */
+		SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, nsacr, NSAC);
+	}
 
 	/* Save GICD_ISENABLER for INT_IDs 32 - 1019 */
 	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, isenabler, ISENABLE);
@@ -801,18 +873,6 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
 	/* Save GICD_ICFGRE for INTIDs 4096 - 5119 */
 	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, icfgr, ICFG);
 
-	/* Save GICD_IGRPMODR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, igrpmodr, IGRPMOD);
-
-	/* Save GICD_IGRPMODRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igrpmodr, IGRPMOD);
-
-	/* Save GICD_NSACR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, nsacr, NSAC);
-
-	/* Save GICD_NSACRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, nsacr, NSAC);
-
 	/* Save GICD_IROUTER for INTIDs 32 - 1019 */
 	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, irouter, IROUTE);
 
@@ -824,6 +884,10 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
 	 * GICD_CTLR.ARE_(S|NS) bits are set which is the case for our GICv3
 	 * driver.
 	 */
+
+#if GICV3_SHADOW_STATE
+	gicd_shadow_ctx = dist_ctx;
+#endif
 }
 
 /*****************************************************************************
@@ -832,6 +896,13 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
  * function must be invoked prior to Redistributor restore and CPU interface
  * enable. The pending and active interrupts are restored after the interrupts
  * are fully configured and enabled.
+ *
+ * With GICV3_SHADOW_STATE, zero words of the set-enable, set-pending and
+ * set-active registers are not written as this has no effect. If the
+ * implementation resets the configuration registers to zero, as selected by
+ * GICV3_ZERO_RESET_CFG, and the Distributor has lost its state, which shows as
+ * all the interrupt groups the context was saved with being disabled, the
+ * configuration registers whose saved value is zero are not written either.
  *****************************************************************************/
 void gicv3_distif_init_restore(const gicv3_dist_ctx_t * const dist_ctx)
 {
@@ -841,17 +912,27 @@ void gicv3_distif_init_restore(const gicv3_dist_ctx_t * const dist_ctx)
 	assert(dist_ctx != NULL);
 
 	uintptr_t gicd_base = gicv3_driver_data->gicd_base;
+	const unsigned int grp_enables = CTLR_ENABLE_G0_BIT |
+					 CTLR_ENABLE_G1S_BIT |
+					 CTLR_ENABLE_G1NS_BIT;
+#if GICV3_SHADOW_STATE
+	bool skip_w1s = true;
+#else
+	bool skip_w1s = false;
+#endif
+#if GICV3_SHADOW_STATE && GICV3_ZERO_RESET_CFG
+	bool skip_cfg = ((dist_ctx->gicd_ctlr & grp_enables) != 0U) &&
+			((gicd_read_ctlr(gicd_base) & grp_enables) == 0U);
+#else
+	bool skip_cfg = false;
+#endif
 
 	/*
 	 * Clear the "enable" bits for G0/G1S/G1NS interrupts before configuring
 	 * the ARE_S bit. The Distributor might generate a system error
 	 * otherwise.
 	 */
-	gicd_clr_ctlr(gicd_base,
-		      CTLR_ENABLE_G0_BIT |
-		      CTLR_ENABLE_G1S_BIT |
-		      CTLR_ENABLE_G1NS_BIT,
-		      RWP_TRUE);
+	gicd_clr_ctlr(gicd_base, grp_enables, RWP_TRUE);
 
 	/* Set the ARE_S and ARE_NS bit now that interrupts have been disabled */
 	gicd_set_ctlr(gicd_base, CTLR_ARE_S_BIT | CTLR_ARE_NS_BIT, RWP_TRUE);
@@ -861,40 +942,52 @@ void gicv3_distif_init_restore(const gicv3_dist_ctx_t * const dist_ctx)
 	unsigned int num_eints = gicv3_get_espi_limit(gicd_base);
 #endif
 	/* Restore GICD_IGROUPR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, igroupr, IGROUP);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, igroupr, IGROUP,
+			     skip_cfg);
 
 	/* Restore GICD_IGROUPRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igroupr, IGROUP);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igroupr, IGROUP,
+			      skip_cfg);
 
 	/* Restore GICD_IPRIORITYR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, ipriorityr, IPRIORITY);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, ipriorityr,
+			     IPRIORITY, skip_cfg);
 
 	/* Restore GICD_IPRIORITYRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, ipriorityr, IPRIORITY);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, ipriorityr,
+			      IPRIORITY, skip_cfg);
 
 	/* Restore GICD_ICFGR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, icfgr, ICFG);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, icfgr, ICFG,
+			     skip_cfg);
 
 	/* Restore GICD_ICFGRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, icfgr, ICFG);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, icfgr, ICFG,
+			      skip_cfg);
 
 	/* Restore GICD_IGRPMODR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, igrpmodr, IGRPMOD);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, igrpmodr, IGRPMOD,
+			     skip_cfg);
 
 	/* Restore GICD_IGRPMODRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igrpmodr, IGRPMOD);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igrpmodr,
+			      IGRPMOD, skip_cfg);
 
 	/* Restore GICD_NSACR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, nsacr, NSAC);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, nsacr, NSAC,
+			     skip_cfg);
 
 	/* Restore GICD_NSACRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, nsacr, NSAC);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, nsacr, NSAC,
+			      skip_cfg);
 
 	/* Restore GICD_IROUTER for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, irouter, IROUTE);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, irouter, IROUTE,
+			     skip_cfg);
 
 	/* Restore GICD_IROUTERE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, irouter, IROUTE);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, irouter, IROUTE,
+			      skip_cfg);
 
 	/*
 	 * Restore ISENABLER(E), ISPENDR(E) and ISACTIVER(E) after
@@ -902,26 +995,37 @@ void gicv3_distif_init_restore(const gicv3_dist_ctx_t * const dist_ctx)
 	 */
 
 	/* Restore GICD_ISENABLER for INT_IDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, isenabler, ISENABLE);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, isenabler,
+			     ISENABLE, skip_w1s);
 
 	/* Restore GICD_ISENABLERE for INT_IDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isenabler, ISENABLE);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isenabler,
+			      ISENABLE, skip_w1s);
 
 	/* Restore GICD_ISPENDR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, ispendr, ISPEND);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, ispendr, ISPEND,
+			     skip_w1s);
 
 	/* Restore GICD_ISPENDRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, ispendr, ISPEND);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, ispendr, ISPEND,
+			      skip_w1s);
 
 	/* Restore GICD_ISACTIVER for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, isactiver, ISACTIVE);
+	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, isactiver,
+			     ISACTIVE, skip_w1s);
 
 	/* Restore GICD_ISACTIVERE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isactiver, ISACTIVE);
+	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isactiver,
+			      ISACTIVE, skip_w1s);
 
 	/* Restore the GICD_CTLR */
 	gicd_write_ctlr(gicd_base, dist_ctx->gicd_ctlr);
 	gicd_wait_for_pending_write(gicd_base);
+
+#if GICV3_SHADOW_STATE
+	/* The Secure-only configuration now matches the restored context */
+	gicd_shadow_ctx = dist_ctx;
+#endif
 }
 
 /*******************************************************************************
@@ -1129,6 +1233,10 @@ void gicv3_set_interrupt_group(unsigned int id, unsigned int proc_num,
 		grpmod ? gicd_set_igrpmodr(gicd_base, id) :
 			 gicd_clr_igrpmodr(gicd_base, id);
 
+#if GICV3_SHADOW_STATE
+		gicd_shadow_ctx = NULL;
+#endif
+
 		spin_unlock(&gic_lock);
 	}
 }
@@ -20,6 +20,10 @@ void gic_pcpu_init(unsigned int cpu_idx)
 	gicv5_enable_ppis();
 }
 
+void gic_pcpu_attach(unsigned int cpu_idx)
+{
+}
+
 void gic_pcpu_off(unsigned int cpu_idx)
 {
 }
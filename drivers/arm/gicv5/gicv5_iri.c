@@ -17,6 +17,10 @@ void __init gic_init(unsigned int cpu_idx)
 	gicv5_driver_init();
 }
 
+void gic_attach(unsigned int cpu_idx)
+{
+}
+
 void gic_save(void)
 {
 }
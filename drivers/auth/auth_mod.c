@@ -5,6 +5,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -28,6 +29,65 @@
 
 #pragma weak plat_set_nv_ctr2
 
+#ifdef PK_DER_LEN
+/*
+ * Root of trust public keys found to match the platform ROTPK. Further root
+ * certificates signed with one of these keys skip the platform lookup and the
+ * key check, so the ROTPK is only checked once per boot stage and key cookie.
+ */
+#ifndef PLAT_AUTH_ROTPK_CACHE_ENTRIES
+#define PLAT_AUTH_ROTPK_CACHE_ENTRIES	U(2)
+#endif
+
+static struct {
+	void *cookie;
+	unsigned int pk_len;
+	unsigned char pk[PK_DER_LEN];
+} rotpk_cache[PLAT_AUTH_ROTPK_CACHE_ENTRIES];
+static unsigned int rotpk_cache_count;
+
+static bool rotpk_is_cached(void *cookie, const void *pk_ptr,
+			    unsigned int pk_len)
+{
+	unsigned int i;
+
+	for (i = 0U; i < rotpk_cache_count; i++) {
+		if ((rotpk_cache[i].cookie == cookie) &&
+		    (rotpk_cache[i].pk_len == pk_len) &&
+		    (memcmp(rotpk_cache[i].pk, pk_ptr, pk_len) == 0)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void rotpk_cache_add(void *cookie, const void *pk_ptr,
+			    unsigned int pk_len)
+{
+	if ((rotpk_cache_count == PLAT_AUTH_ROTPK_CACHE_ENTRIES) ||
+	    (pk_len > PK_DER_LEN)) {
+		return;
+	}
+
+	rotpk_cache[rotpk_cache_count].cookie = cookie;
+	rotpk_cache[rotpk_cache_count].pk_len = pk_len;
+	(void)memcpy(rotpk_cache[rotpk_cache_count].pk, pk_ptr, pk_len);
+	rotpk_cache_count++;
+}
+#else
+static bool rotpk_is_cached(void *cookie __unused, const void *pk_ptr __unused,
+			    unsigned int pk_len __unused)
+{
+	return false;
+}
+
+static void rotpk_cache_add(void *cookie __unused, const void *pk_ptr __unused,
+			    unsigned int pk_len __unused)
+{
+}
+#endif /* PK_DER_LEN */
+
 static int cmp_auth_param_type_desc(const auth_param_type_desc_t *a,
 		const auth_param_type_desc_t *b)
 {
@@ -126,6 +186,60 @@ static int auth_hash(const auth_method_param_hash_t *param,
 	return 0;
 }
 
+/*
+ * Validate the public key of a root certificate against the platform ROTPK.
+ *
+ * Platform may store key in one of the following way -
+ * 1. Hash of ROTPK
+ * 2. Hash if prefixed, suffixed or modified ROTPK
+ * 3. Full ROTPK
+ */
+static int auth_check_rotpk(void *pk_ptr, unsigned int pk_len,
+			    void *pk_plat_ptr, unsigned int pk_plat_len,
+			    unsigned int flags)
+{
+	void *cnv_pk_ptr;
+	unsigned int cnv_pk_len;
+	int rc;
+
+	if ((flags & ROTPK_NOT_DEPLOYED) != 0U) {
+		NOTICE("ROTPK is not deployed on platform. "
+			"Skipping ROTPK verification.\n");
+	} else if ((flags & ROTPK_IS_HASH) != 0U) {
+		/*
+		 * platform may store the hash of a prefixed,
+		 * suffixed or modified pk
+		 */
+		rc = crypto_mod_convert_pk(pk_ptr, pk_len, &cnv_pk_ptr, &cnv_pk_len);
+		if (rc != 0) {
+			VERBOSE("[TBB] %s():%d failed with error code %d.\n",
+				__func__, __LINE__, rc);
+			return rc;
+		}
+
+		/*
+		 * The hash of the certificate's public key must match
+		 * the hash of the ROTPK.
+		 */
+		rc = crypto_mod_verify_hash(cnv_pk_ptr, cnv_pk_len,
+					    pk_plat_ptr, pk_plat_len);
+		if (rc != 0) {
+			VERBOSE("[TBB] %s():%d failed with error code %d.\n",
+				__func__, __LINE__, rc);
+			return rc;
+		}
+	} else {
+		/* Platform supports full ROTPK */
+		if ((pk_len != pk_plat_len) ||
+		    (memcmp(pk_plat_ptr, pk_ptr, pk_len) != 0)) {
+			ERROR("plat and cert ROTPK len mismatch\n");
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
 /*
  * Authenticate by digital signature
  *
@@ -157,8 +271,8 @@ static int auth_signature(const auth_method_param_sig_t *param,
 			  const auth_img_desc_t *img_desc,
 			  void *img, unsigned int img_len)
 {
-	void *data_ptr, *pk_ptr, *cnv_pk_ptr, *pk_plat_ptr, *sig_ptr, *sig_alg_ptr, *pk_oid;
-	unsigned int data_len, pk_len, cnv_pk_len, pk_plat_len, sig_len, sig_alg_len;
+	void *data_ptr, *pk_ptr, *pk_plat_ptr, *sig_ptr, *sig_alg_ptr, *pk_oid;
+	unsigned int data_len, pk_len, pk_plat_len, sig_len, sig_alg_len;
 	unsigned int flags = 0;
 	int rc;
 
@@ -213,21 +327,7 @@ static int auth_signature(const auth_method_param_sig_t *param,
 			return rc;
 		}
 	} else {
-		/*
-		 * Root certificates are signed with the ROTPK, so we have to
-		 * get it from the platform.
-		 */
-		rc = plat_get_rotpk_info(param->pk->cookie, &pk_plat_ptr,
-					 &pk_plat_len, &flags);
-		if (rc != 0) {
-			VERBOSE("[TBB] %s():%d failed with error code %d.\n",
-				__func__, __LINE__, rc);
-			return rc;
-		}
-
-		assert(is_rotpk_flags_valid(flags));
-
-		/* Also retrieve the key from the image. */
+		/* Retrieve the key from the image. */
 		rc = img_parser_get_auth_param(img_desc->img_type,
 					       param->pk, img, img_len,
 					       &pk_ptr, &pk_len);
@@ -238,45 +338,30 @@ static int auth_signature(const auth_method_param_sig_t *param,
 		}
 
 		/*
-		 * Validate the certificate's key against the platform ROTPK.
-		 *
-		 * Platform may store key in one of the following way -
-		 * 1. Hash of ROTPK
-		 * 2. Hash if prefixed, suffixed or modified ROTPK
-		 * 3. Full ROTPK
+		 * Root certificates are signed with the ROTPK, so we have to
+		 * get it from the platform, unless the key has already been
+		 * validated against it.
 		 */
-		if ((flags & ROTPK_NOT_DEPLOYED) != 0U) {
-			NOTICE("ROTPK is not deployed on platform. "
-				"Skipping ROTPK verification.\n");
-		} else if ((flags & ROTPK_IS_HASH) != 0U) {
-			/*
-			 * platform may store the hash of a prefixed,
-			 * suffixed or modified pk
-			 */
-			rc = crypto_mod_convert_pk(pk_ptr, pk_len, &cnv_pk_ptr, &cnv_pk_len);
+		if (!rotpk_is_cached(param->pk->cookie, pk_ptr, pk_len)) {
+			rc = plat_get_rotpk_info(param->pk->cookie, &pk_plat_ptr,
+						 &pk_plat_len, &flags);
 			if (rc != 0) {
 				VERBOSE("[TBB] %s():%d failed with error code %d.\n",
 					__func__, __LINE__, rc);
 				return rc;
 			}
 
-			/*
-			 * The hash of the certificate's public key must match
-			 * the hash of the ROTPK.
-			 */
-			rc = crypto_mod_verify_hash(cnv_pk_ptr, cnv_pk_len,
-						    pk_plat_ptr, pk_plat_len);
+			assert(is_rotpk_flags_valid(flags));
+
+			rc = auth_check_rotpk(pk_ptr, pk_len, pk_plat_ptr,
+					      pk_plat_len, flags);
 			if (rc != 0) {
-				VERBOSE("[TBB] %s():%d failed with error code %d.\n",
-					__func__, __LINE__, rc);
 				return rc;
 			}
-		} else {
-			/* Platform supports full ROTPK */
-			if ((pk_len != pk_plat_len) ||
-			    (memcmp(pk_plat_ptr, pk_ptr, pk_len) != 0)) {
-				ERROR("plat and cert ROTPK len mismatch\n");
-				return -1;
+
+			if ((flags & ROTPK_NOT_DEPLOYED) == 0U) {
+				rotpk_cache_add(param->pk->cookie, pk_ptr,
+						pk_len);
 			}
 		}
 
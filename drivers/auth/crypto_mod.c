@@ -5,9 +5,16 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <stdint.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <drivers/auth/crypto_mod.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+
+#include <platform_def.h>
 
 /* Variable exported by the crypto library through REGISTER_CRYPTO_LIB() */
 
@@ -39,6 +46,254 @@
  *     SignatureValue ::= BIT STRING
  */
 
+/*
+ * Accelerator used when no platform registered any: every operation is
+ * handled by the crypto library.
+ */
+static const crypto_accel_desc_t crypto_accel_none;
+
+#if CRYPTO_ACCEL
+/*
+ * Operations are offloaded to the accelerator registered by the platform when
+ * it implements them and the data is large enough, and suitably aligned for
+ * its DMA. Each operation is timed, so that the platform can check that the
+ * offload pays off.
+ */
+static const crypto_accel_desc_t *crypto_accel = &crypto_accel_none;
+
+/* BL2 may run operations on several CPUs, see BL2_CONCURRENT_LOAD */
+static crypto_op_stats_t crypto_stats[CRYPTO_OP_COUNT];
+static spinlock_t crypto_stats_lock;
+
+static const char *const crypto_op_names[CRYPTO_OP_COUNT] = {
+	[CRYPTO_OP_VERIFY_SIGNATURE] = "verify_signature",
+	[CRYPTO_OP_VERIFY_HASH] = "verify_hash",
+	[CRYPTO_OP_CALC_HASH] = "calc_hash",
+	[CRYPTO_OP_AUTH_DECRYPT] = "auth_decrypt",
+};
+
+/*
+ * Register the hardware accelerator the operations are offloaded to. This must
+ * be called before crypto_mod_init(), typically from the platform setup.
+ */
+int crypto_mod_register_accel(const crypto_accel_desc_t *desc)
+{
+	assert(desc != NULL);
+	assert(desc->name != NULL);
+
+	/*
+	 * The decrypted data is invalidated from its first cache line, which
+	 * must not hold anything else.
+	 */
+	assert(!desc->dma_non_coherent ||
+	       (desc->dma_align >= CACHE_WRITEBACK_GRANULE));
+	if (desc->dma_non_coherent &&
+	    (desc->dma_align < CACHE_WRITEBACK_GRANULE)) {
+		return -EINVAL;
+	}
+
+	if (crypto_accel != &crypto_accel_none) {
+		return -EBUSY;
+	}
+
+	crypto_accel = desc;
+
+	return 0;
+}
+
+/* Return the statistics of the operation 'op' in 'stats' */
+int crypto_mod_get_stats(enum crypto_op op, crypto_op_stats_t *stats)
+{
+	assert(stats != NULL);
+
+	if (op >= CRYPTO_OP_COUNT) {
+		return -EINVAL;
+	}
+
+	spin_lock(&crypto_stats_lock);
+	*stats = crypto_stats[op];
+	spin_unlock(&crypto_stats_lock);
+
+	return 0;
+}
+
+static uint64_t crypto_op_start(void)
+{
+	return read_cntpct_el0();
+}
+
+static void crypto_op_end(enum crypto_op op, bool accel, size_t len,
+			  uint64_t start)
+{
+	crypto_op_stats_t *stats = &crypto_stats[op];
+	uint64_t ticks = read_cntpct_el0() - start;
+
+	spin_lock(&crypto_stats_lock);
+	if (accel) {
+		stats->accel_count++;
+		stats->accel_bytes += len;
+		stats->accel_ticks += ticks;
+	} else {
+		stats->lib_count++;
+		stats->lib_bytes += len;
+		stats->lib_ticks += ticks;
+	}
+	spin_unlock(&crypto_stats_lock);
+}
+
+static void crypto_print_stats(void)
+{
+	crypto_op_stats_t stats;
+	uint64_t freq = read_cntfrq_el0();
+	unsigned int op;
+
+	if (freq == 0U) {
+		return;
+	}
+
+	for (op = 0U; op < CRYPTO_OP_COUNT; op++) {
+		(void)crypto_mod_get_stats(op, &stats);
+		if ((stats.accel_count + stats.lib_count) == 0U) {
+			continue;
+		}
+
+		INFO("Crypto %s: accel %u ops %llu bytes %llu us, lib %u ops %llu bytes %llu us\n",
+		     crypto_op_names[op],
+		     stats.accel_count, (unsigned long long)stats.accel_bytes,
+		     (unsigned long long)((stats.accel_ticks * 1000000U) / freq),
+		     stats.lib_count, (unsigned long long)stats.lib_bytes,
+		     (unsigned long long)((stats.lib_ticks * 1000000U) / freq));
+	}
+}
+
+/*
+ * Return whether a request on 'len' bytes at 'data_ptr' goes to the
+ * accelerator, which implements it if 'has_op' is true. When the accelerator
+ * DMA writes the data back ('dma_write') without coherency, the data must
+ * cover whole cache lines, as the last one could not be invalidated without
+ * discarding the data following the buffer, nor cleaned without overwriting
+ * the DMA output.
+ */
+static bool crypto_accel_usable(bool has_op, const void *data_ptr, size_t len,
+				size_t min_len, bool dma_write)
+{
+	if (!has_op || (len < min_len)) {
+		return false;
+	}
+
+	if (dma_write && crypto_accel->dma_non_coherent &&
+	    !is_aligned(len, CACHE_WRITEBACK_GRANULE)) {
+		return false;
+	}
+
+	return (crypto_accel->dma_align == 0U) ||
+	       is_aligned((uintptr_t)data_ptr, crypto_accel->dma_align);
+}
+
+/*
+ * Make the data visible to the accelerator DMA. The data buffer is also
+ * invalidated, so that no dirty line is written back over the DMA output.
+ */
+static void crypto_accel_prepare(void *data_ptr, size_t len)
+{
+	if (crypto_accel->dma_non_coherent) {
+		flush_dcache_range((uintptr_t)data_ptr, len);
+	}
+}
+
+/* Make a parameter buffer, which the accelerator DMA only reads, visible */
+static void crypto_accel_clean(const void *ptr, size_t len)
+{
+	if (crypto_accel->dma_non_coherent) {
+		clean_dcache_range((uintptr_t)ptr, len);
+	}
+}
+
+/*
+ * Make the data written by the accelerator DMA visible to the CPU. The buffer
+ * covers whole cache lines, see crypto_accel_usable().
+ */
+static void crypto_accel_complete(void *data_ptr, size_t len)
+{
+	if (crypto_accel->dma_non_coherent) {
+		inv_dcache_range((uintptr_t)data_ptr, len);
+	}
+}
+
+/*
+ * After a decryption, the crypto library may hold the digest of the plaintext
+ * for the next hash verification and calculation, which it reports with
+ * CRYPTO_SUCCESS_DIGEST. These must then reach the library, so that it uses
+ * or drops the digest, instead of the accelerator.
+ */
+static unsigned int crypto_lib_digest_ops;
+
+static void crypto_lib_digest_set(bool held)
+{
+	crypto_lib_digest_ops = held ? (BIT(CRYPTO_OP_VERIFY_HASH) |
+					BIT(CRYPTO_OP_CALC_HASH)) : 0U;
+}
+
+static bool crypto_lib_digest_take(enum crypto_op op)
+{
+	bool pending = (crypto_lib_digest_ops & BIT(op)) != 0U;
+
+	crypto_lib_digest_ops &= ~BIT(op);
+
+	return pending;
+}
+#else
+static const crypto_accel_desc_t *const crypto_accel = &crypto_accel_none;
+
+static inline uint64_t crypto_op_start(void)
+{
+	return 0ULL;
+}
+
+static inline void crypto_op_end(enum crypto_op op __unused,
+				 bool accel __unused, size_t len __unused,
+				 uint64_t start __unused)
+{
+}
+
+static inline void crypto_print_stats(void)
+{
+}
+
+static inline bool crypto_accel_usable(bool has_op __unused,
+				       const void *data_ptr __unused,
+				       size_t len __unused,
+				       size_t min_len __unused,
+				       bool dma_write __unused)
+{
+	return false;
+}
+
+static inline void crypto_accel_prepare(void *data_ptr __unused,
+					size_t len __unused)
+{
+}
+
+static inline void crypto_accel_clean(const void *ptr __unused,
+				      size_t len __unused)
+{
+}
+
+static inline void crypto_accel_complete(void *data_ptr __unused,
+					 size_t len __unused)
+{
+}
+
+static inline void crypto_lib_digest_set(bool held __unused)
+{
+}
+
+static inline bool crypto_lib_digest_take(enum crypto_op op __unused)
+{
+	return false;
+}
+#endif /* CRYPTO_ACCEL */
+
 /*
  * Perform some static checking and call the library initialization function
  */
@@ -62,6 +317,22 @@ CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 	/* Initialize the cryptographic library */
 	crypto_lib_desc.init();
 	INFO("Using crypto library '%s'\n", crypto_lib_desc.name);
+
+#if CRYPTO_ACCEL
+	if (crypto_accel == &crypto_accel_none) {
+		return;
+	}
+
+	/* Without its accelerator, the library handles all operations */
+	if ((crypto_accel->init != NULL) && (crypto_accel->init() != 0)) {
+		WARN("Failed to initialize crypto accelerator '%s'\n",
+		     crypto_accel->name);
+		crypto_accel = &crypto_accel_none;
+		return;
+	}
+
+	INFO("Using crypto accelerator '%s'\n", crypto_accel->name);
+#endif /* CRYPTO_ACCEL */
 }
 
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
@@ -81,6 +352,9 @@ int crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
 				void *sig_alg_ptr, unsigned int sig_alg_len,
 				void *pk_ptr, unsigned int pk_len)
 {
+	uint64_t start;
+	int rc;
+
 	assert(data_ptr != NULL);
 	assert(data_len != 0);
 	assert(sig_ptr != NULL);
@@ -90,10 +364,32 @@ int crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
 	assert(pk_ptr != NULL);
 	assert(pk_len != 0);
 
-	return crypto_lib_desc.verify_signature(data_ptr, data_len,
-						sig_ptr, sig_len,
-						sig_alg_ptr, sig_alg_len,
-						pk_ptr, pk_len);
+	start = crypto_op_start();
+
+	if (crypto_accel_usable(crypto_accel->verify_signature != NULL,
+				data_ptr, data_len, 0U, false)) {
+		crypto_accel_prepare(data_ptr, data_len);
+		crypto_accel_clean(sig_ptr, sig_len);
+		crypto_accel_clean(sig_alg_ptr, sig_alg_len);
+		crypto_accel_clean(pk_ptr, pk_len);
+		rc = crypto_accel->verify_signature(data_ptr, data_len,
+						    sig_ptr, sig_len,
+						    sig_alg_ptr, sig_alg_len,
+						    pk_ptr, pk_len);
+		if (rc != CRYPTO_ERR_NOT_SUPPORTED) {
+			crypto_op_end(CRYPTO_OP_VERIFY_SIGNATURE, true,
+				      data_len, start);
+			return rc;
+		}
+	}
+
+	rc = crypto_lib_desc.verify_signature(data_ptr, data_len,
+					      sig_ptr, sig_len,
+					      sig_alg_ptr, sig_alg_len,
+					      pk_ptr, pk_len);
+	crypto_op_end(CRYPTO_OP_VERIFY_SIGNATURE, false, data_len, start);
+
+	return rc;
 }
 
 /*
@@ -107,13 +403,36 @@ int crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
 int crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
 			   void *digest_info_ptr, unsigned int digest_info_len)
 {
+	uint64_t start;
+	int rc;
+
 	assert(data_ptr != NULL);
 	assert(data_len != 0);
 	assert(digest_info_ptr != NULL);
 	assert(digest_info_len != 0);
 
-	return crypto_lib_desc.verify_hash(data_ptr, data_len,
-					   digest_info_ptr, digest_info_len);
+	start = crypto_op_start();
+
+	if (!crypto_lib_digest_take(CRYPTO_OP_VERIFY_HASH) &&
+	    crypto_accel_usable(crypto_accel->verify_hash != NULL, data_ptr,
+				data_len, crypto_accel->hash_min_len, false)) {
+		crypto_accel_prepare(data_ptr, data_len);
+		crypto_accel_clean(digest_info_ptr, digest_info_len);
+		rc = crypto_accel->verify_hash(data_ptr, data_len,
+					       digest_info_ptr,
+					       digest_info_len);
+		if (rc != CRYPTO_ERR_NOT_SUPPORTED) {
+			crypto_op_end(CRYPTO_OP_VERIFY_HASH, true, data_len,
+				      start);
+			return rc;
+		}
+	}
+
+	rc = crypto_lib_desc.verify_hash(data_ptr, data_len,
+					 digest_info_ptr, digest_info_len);
+	crypto_op_end(CRYPTO_OP_VERIFY_HASH, false, data_len, start);
+
+	return rc;
 }
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
@@ -133,11 +452,82 @@ int crypto_mod_calc_hash(enum crypto_md_algo alg, void *data_ptr,
 			 unsigned int data_len,
 			 unsigned char output[CRYPTO_MD_MAX_SIZE])
 {
+	uint64_t start;
+	int rc;
+
+	assert(data_ptr != NULL);
+	assert(data_len != 0);
+	assert(output != NULL);
+
+	start = crypto_op_start();
+
+	if (!crypto_lib_digest_take(CRYPTO_OP_CALC_HASH) &&
+	    crypto_accel_usable(crypto_accel->calc_hash != NULL, data_ptr,
+				data_len, crypto_accel->hash_min_len, false)) {
+		crypto_accel_prepare(data_ptr, data_len);
+		rc = crypto_accel->calc_hash(alg, data_ptr, data_len, output);
+		if (rc != CRYPTO_ERR_NOT_SUPPORTED) {
+			crypto_op_end(CRYPTO_OP_CALC_HASH, true, data_len,
+				      start);
+			return rc;
+		}
+	}
+
+	rc = crypto_lib_desc.calc_hash(alg, data_ptr, data_len, output);
+	crypto_op_end(CRYPTO_OP_CALC_HASH, false, data_len, start);
+
+	return rc;
+}
+
+/*
+ * Calculate several hashes of the same data
+ *
+ * Libraries that provide calc_hashes() walk the data once and feed every
+ * digest from the same cache-resident block. Otherwise the data is hashed
+ * once per algorithm, which is also the case when the hashes are offloaded to
+ * the accelerator.
+ *
+ * Parameters:
+ *
+ *   algs, alg_count: message digest algorithms
+ *   data_ptr, data_len: data to be hashed
+ *   output: resulting hashes, one per algorithm in the same order as 'algs'
+ */
+int crypto_mod_calc_hashes(const enum crypto_md_algo algs[],
+			   unsigned int alg_count, void *data_ptr,
+			   unsigned int data_len,
+			   unsigned char (*output)[CRYPTO_MD_MAX_SIZE])
+{
+	uint64_t start;
+	unsigned int i;
+	int rc;
+
+	assert(algs != NULL);
+	assert((alg_count != 0U) && (alg_count <= CRYPTO_MD_ALGO_COUNT));
 	assert(data_ptr != NULL);
 	assert(data_len != 0);
 	assert(output != NULL);
 
-	return crypto_lib_desc.calc_hash(alg, data_ptr, data_len, output);
+	if ((alg_count > 1U) && (crypto_lib_desc.calc_hashes != NULL) &&
+	    !crypto_accel_usable(crypto_accel->calc_hash != NULL, data_ptr,
+				 data_len, crypto_accel->hash_min_len, false)) {
+		start = crypto_op_start();
+		rc = crypto_lib_desc.calc_hashes(algs, alg_count, data_ptr,
+						 data_len, output);
+		crypto_op_end(CRYPTO_OP_CALC_HASH, false, data_len, start);
+
+		return rc;
+	}
+
+	for (i = 0U; i < alg_count; i++) {
+		rc = crypto_mod_calc_hash(algs[i], data_ptr, data_len,
+					  output[i]);
+		if (rc != CRYPTO_SUCCESS) {
+			return rc;
+		}
+	}
+
+	return CRYPTO_SUCCESS;
 }
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
@@ -173,6 +563,9 @@ int crypto_mod_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 			    unsigned int iv_len, const void *tag,
 			    unsigned int tag_len)
 {
+	uint64_t start;
+	int rc;
+
 	assert(crypto_lib_desc.auth_decrypt != NULL);
 	assert(data_ptr != NULL);
 	assert(len != 0U);
@@ -183,14 +576,108 @@ int crypto_mod_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 	assert(tag != NULL);
 	assert((tag_len != 0U) && (tag_len <= CRYPTO_MAX_TAG_SIZE));
 
-	return crypto_lib_desc.auth_decrypt(dec_algo, data_ptr, len, key,
-					    key_len, key_flags, iv, iv_len, tag,
-					    tag_len);
+	start = crypto_op_start();
+
+	if (crypto_accel_usable(crypto_accel->auth_decrypt != NULL, data_ptr,
+				len, crypto_accel->dec_min_len, true)) {
+		crypto_accel_prepare(data_ptr, len);
+		crypto_accel_clean(key, key_len);
+		crypto_accel_clean(iv, iv_len);
+		crypto_accel_clean(tag, tag_len);
+		rc = crypto_accel->auth_decrypt(dec_algo, data_ptr, len, key,
+						key_len, key_flags, iv, iv_len,
+						tag, tag_len);
+		if (rc != CRYPTO_ERR_NOT_SUPPORTED) {
+			crypto_accel_complete(data_ptr, len);
+			crypto_op_end(CRYPTO_OP_AUTH_DECRYPT, true, len, start);
+			return rc;
+		}
+	}
+
+	rc = crypto_lib_desc.auth_decrypt(dec_algo, data_ptr, len, key,
+					  key_len, key_flags, iv, iv_len, tag,
+					  tag_len);
+	crypto_op_end(CRYPTO_OP_AUTH_DECRYPT, false, len, start);
+
+	if ((rc == CRYPTO_SUCCESS) || (rc == CRYPTO_SUCCESS_DIGEST)) {
+		crypto_lib_digest_set(rc == CRYPTO_SUCCESS_DIGEST);
+		rc = CRYPTO_SUCCESS;
+	}
+
+	return rc;
+}
+
+/*
+ * Incremental authenticated decryption of data, for data which is not
+ * available at once: crypto_mod_auth_decrypt_init() starts the operation,
+ * crypto_mod_auth_decrypt_update() decrypts in place the consecutive parts of
+ * the data and crypto_mod_auth_decrypt_finish() checks the authentication tag.
+ * Only one operation may be in progress at a time. The operation is aborted
+ * by crypto_mod_auth_decrypt_finish() with a NULL 'tag', which must be done
+ * when any step fails, and the data decrypted so far must then be discarded.
+ *
+ * These operations are handled by the crypto library only, and return
+ * CRYPTO_ERR_NOT_SUPPORTED from crypto_mod_auth_decrypt_init() if it does not
+ * implement them, in which case crypto_mod_auth_decrypt() must be used.
+ *
+ * Parameters are as for crypto_mod_auth_decrypt().
+ */
+int crypto_mod_auth_decrypt_init(enum crypto_dec_algo dec_algo,
+				 const void *key, unsigned int key_len,
+				 unsigned int key_flags, const void *iv,
+				 unsigned int iv_len)
+{
+	assert(key != NULL);
+	assert(key_len != 0U);
+	assert(iv != NULL);
+	assert((iv_len != 0U) && (iv_len <= CRYPTO_MAX_IV_SIZE));
+
+	if ((crypto_lib_desc.auth_decrypt_init == NULL) ||
+	    (crypto_lib_desc.auth_decrypt_update == NULL) ||
+	    (crypto_lib_desc.auth_decrypt_finish == NULL)) {
+		return CRYPTO_ERR_NOT_SUPPORTED;
+	}
+
+	return crypto_lib_desc.auth_decrypt_init(dec_algo, key, key_len,
+						 key_flags, iv, iv_len);
+}
+
+int crypto_mod_auth_decrypt_update(void *data_ptr, size_t len)
+{
+	uint64_t start;
+	int rc;
+
+	assert(data_ptr != NULL);
+	assert(len != 0U);
+
+	start = crypto_op_start();
+	rc = crypto_lib_desc.auth_decrypt_update(data_ptr, len);
+	crypto_op_end(CRYPTO_OP_AUTH_DECRYPT, false, len, start);
+
+	return rc;
+}
+
+int crypto_mod_auth_decrypt_finish(const void *tag, unsigned int tag_len)
+{
+	int rc;
+
+	assert((tag == NULL) ||
+	       ((tag_len != 0U) && (tag_len <= CRYPTO_MAX_TAG_SIZE)));
+
+	rc = crypto_lib_desc.auth_decrypt_finish(tag, tag_len);
+	if ((rc == CRYPTO_SUCCESS) || (rc == CRYPTO_SUCCESS_DIGEST)) {
+		crypto_lib_digest_set(rc == CRYPTO_SUCCESS_DIGEST);
+		rc = CRYPTO_SUCCESS;
+	}
+
+	return rc;
 }
 
 /* Perform end of psa crypto usage calls to finish */
 void crypto_mod_finish(void)
 {
+	crypto_print_stats();
+
 	if (crypto_lib_desc.finish != NULL) {
 		crypto_lib_desc.finish();
 		INFO("Finished using crypto library '%s'\n", crypto_lib_desc.name);
@@ -12,6 +12,7 @@
 #include <mbedtls/platform.h>
 #include <mbedtls/version.h>
 
+#include <arch_features.h>
 #include <common/debug.h>
 #include <drivers/auth/mbedtls/mbedtls_common.h>
 
@@ -23,6 +24,34 @@ static void cleanup(void)
 	panic();
 }
 
+/*
+ * Check that the PE implements the cryptographic instructions mbed TLS was
+ * built to use, rather than taking an undefined instruction exception on the
+ * first hash.
+ */
+static void check_crypto_features(void)
+{
+#if TF_MBEDTLS_USE_ARMV8_CRYPTO
+	if (!is_feat_sha256_present()) {
+		ERROR("FEAT_%s not supported by the PE\n", "SHA256");
+		panic();
+	}
+#if TF_MBEDTLS_USE_AES_GCM
+	if (!is_feat_aes_present() || !is_feat_pmull_present()) {
+		ERROR("FEAT_%s not supported by the PE\n", "AES/PMULL");
+		panic();
+	}
+#endif
+#endif /* TF_MBEDTLS_USE_ARMV8_CRYPTO */
+
+#if TF_MBEDTLS_USE_ARMV8_SHA512
+	if (!is_feat_sha512_present()) {
+		ERROR("FEAT_%s not supported by the PE\n", "SHA512");
+		panic();
+	}
+#endif
+}
+
 /*
  * mbed TLS initialization function
  */
@@ -34,6 +63,8 @@ void mbedtls_init(void)
 	int err;
 
 	if (!ready) {
+		check_crypto_features();
+
 		if (atexit(cleanup))
 			panic();
 
@@ -119,14 +119,6 @@ else
     TF_MBEDTLS_HASH_ALG_ID	:=	TF_MBEDTLS_SHA256
 endif
 
-ifeq (${MBOOT_EL_HASH_ALG}, sha256)
-    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA256))
-else ifeq (${MBOOT_EL_HASH_ALG}, sha384)
-    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA384))
-else ifeq (${MBOOT_EL_HASH_ALG}, sha512)
-    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA512))
-endif
-
 ifeq (${TF_MBEDTLS_KEY_ALG},ecdsa)
     TF_MBEDTLS_KEY_ALG_ID	:=	TF_MBEDTLS_ECDSA
 else ifeq (${TF_MBEDTLS_KEY_ALG},rsa)
@@ -143,13 +135,39 @@ else
     TF_MBEDTLS_USE_AES_GCM	:=	0
 endif
 
+# Number of parsed public keys kept for later signature verifications. Each
+# entry enlarges the mbed TLS heap. 0 parses the key of every verification.
+TF_MBEDTLS_PK_CACHE_ENTRIES	?=	0
+
+# Use the Armv8-A Cryptographic Extension instructions in mbed TLS: SHA-256
+# and AES/PMULL with TF_MBEDTLS_USE_ARMV8_CRYPTO, SHA-512 with
+# TF_MBEDTLS_USE_ARMV8_SHA512. There is no way to select the implementation at
+# runtime in firmware, so the instructions must be implemented by every core.
+TF_MBEDTLS_USE_ARMV8_CRYPTO	?=	0
+TF_MBEDTLS_USE_ARMV8_SHA512	?=	0
+
+ifneq ($(filter 1,${TF_MBEDTLS_USE_ARMV8_CRYPTO} ${TF_MBEDTLS_USE_ARMV8_SHA512}),)
+    ifneq (${ARCH},aarch64)
+        $(error "TF_MBEDTLS_USE_ARMV8_CRYPTO and TF_MBEDTLS_USE_ARMV8_SHA512 require ARCH=aarch64")
+    endif
+    # The NS world FP/SIMD registers are not saved around EL3 runtime services
+    ifeq (${DRTM_SUPPORT},1)
+        $(error "TF_MBEDTLS_USE_ARMV8_CRYPTO and TF_MBEDTLS_USE_ARMV8_SHA512 are not supported with DRTM_SUPPORT")
+    endif
+    # The cryptographic instructions operate on the FP/SIMD registers
+    libmbedtls_CFLAGS_REMOVE	:=	-mgeneral-regs-only
+endif
+
 # Needs to be set to drive mbed TLS configuration correctly
 $(eval $(call add_defines,\
     $(sort \
         TF_MBEDTLS_KEY_ALG_ID \
         TF_MBEDTLS_KEY_SIZE \
         TF_MBEDTLS_HASH_ALG_ID \
+        TF_MBEDTLS_PK_CACHE_ENTRIES \
         TF_MBEDTLS_USE_AES_GCM \
+        TF_MBEDTLS_USE_ARMV8_CRYPTO \
+        TF_MBEDTLS_USE_ARMV8_SHA512 \
 )))
 
 $(eval $(call MAKE_LIB,mbedtls))
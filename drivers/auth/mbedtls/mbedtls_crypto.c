@@ -5,6 +5,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -25,6 +26,18 @@
 
 #define LIB_NAME		"mbed TLS"
 
+/* Block size used when computing several digests in a single pass */
+#define MD_MULTI_BLOCK_SIZE	U(4096)
+
+/* Hash algorithm used for authentication, see TF_MBEDTLS_HASH_ALG_ID */
+#if TF_MBEDTLS_HASH_ALG_ID == TF_MBEDTLS_SHA256
+#define AUTH_MD			MBEDTLS_MD_SHA256
+#elif TF_MBEDTLS_HASH_ALG_ID == TF_MBEDTLS_SHA384
+#define AUTH_MD			MBEDTLS_MD_SHA384
+#else
+#define AUTH_MD			MBEDTLS_MD_SHA512
+#endif
+
 #if CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 /*
@@ -63,6 +76,55 @@ static void init(void)
 	mbedtls_init();
 }
 
+/* Users of the digest of the decrypted plaintext, see dec_digest_take() */
+#define DEC_DIGEST_VERIFY	BIT(0)
+#define DEC_DIGEST_CALC		BIT(1)
+
+#if TF_MBEDTLS_USE_AES_GCM
+/*
+ * Digest of the plaintext of the last decryption, computed with AUTH_MD while
+ * the data was decrypted. The data may be modified once it is returned to the
+ * caller, so the digest is only offered to the next verify_hash() and the
+ * next calc_hash(), and dropped by any other use.
+ */
+static struct {
+	unsigned int users;
+	const void *data_ptr;
+	size_t data_len;
+	unsigned char digest[MBEDTLS_MD_MAX_SIZE];
+} dec_digest;
+
+/*
+ * Copy the digest of the last decryption to 'output' if it is the
+ * 'md_alg' digest of 'data_len' bytes at 'data_ptr', and return true. The
+ * digest is no longer offered to 'user' afterwards.
+ */
+static bool dec_digest_take(unsigned int user, mbedtls_md_type_t md_alg,
+			    const void *data_ptr, size_t data_len,
+			    unsigned char *output)
+{
+	bool found = ((dec_digest.users & user) != 0U) && (md_alg == AUTH_MD) &&
+		     (data_ptr == dec_digest.data_ptr) &&
+		     (data_len == dec_digest.data_len);
+
+	dec_digest.users &= ~user;
+
+	if (found) {
+		memcpy(output, dec_digest.digest,
+		       mbedtls_md_get_size(mbedtls_md_info_from_type(AUTH_MD)));
+	}
+
+	return found;
+}
+#else
+static inline bool dec_digest_take(unsigned int user, mbedtls_md_type_t md_alg,
+				   const void *data_ptr, size_t data_len,
+				   unsigned char *output)
+{
+	return false;
+}
+#endif /* TF_MBEDTLS_USE_AES_GCM */
+
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 
@@ -77,6 +139,96 @@ int mbedtls_x509_get_sig_alg(const mbedtls_x509_buf *sig_oid,
 			     mbedtls_md_type_t *md_alg,
 			     mbedtls_pk_type_t *pk_alg,
 			     void **sig_opts);
+#if TF_MBEDTLS_PK_CACHE_ENTRIES
+/*
+ * Public keys parsed for signature verifications are kept in the mbed TLS
+ * heap, keyed by the hash of their DER encoding, so that the keys signing
+ * several certificates are only parsed once. Entries are replaced in a
+ * round-robin fashion.
+ */
+static struct {
+	bool valid;
+	unsigned int pk_len;
+	unsigned char key_hash[MBEDTLS_MD_MAX_SIZE];
+	mbedtls_pk_context pk;
+} pk_cache[TF_MBEDTLS_PK_CACHE_ENTRIES];
+static unsigned int pk_cache_next;
+
+static void pk_cache_evict(unsigned int i)
+{
+	if (pk_cache[i].valid) {
+		mbedtls_pk_free(&pk_cache[i].pk);
+		pk_cache[i].valid = false;
+	}
+}
+
+static int pk_cache_parse(unsigned int i, void *pk_ptr, unsigned int pk_len)
+{
+	unsigned char *p = (unsigned char *)pk_ptr;
+	unsigned char *end = p + pk_len;
+	int rc;
+
+	mbedtls_pk_init(&pk_cache[i].pk);
+	rc = mbedtls_pk_parse_subpubkey(&p, end, &pk_cache[i].pk);
+	if (rc != 0) {
+		mbedtls_pk_free(&pk_cache[i].pk);
+	}
+
+	return rc;
+}
+
+/*
+ * Return the parsed context of a public key, from the cache or parsed into
+ * it. Return NULL if the key cannot be parsed.
+ */
+static mbedtls_pk_context *pk_cache_get(void *pk_ptr, unsigned int pk_len)
+{
+	const mbedtls_md_info_t *md_info;
+	unsigned char key_hash[MBEDTLS_MD_MAX_SIZE];
+	unsigned int i, hash_len;
+
+	md_info = mbedtls_md_info_from_type(AUTH_MD);
+	if ((md_info == NULL) ||
+	    (mbedtls_md(md_info, pk_ptr, pk_len, key_hash) != 0)) {
+		return NULL;
+	}
+	hash_len = mbedtls_md_get_size(md_info);
+
+	for (i = 0U; i < TF_MBEDTLS_PK_CACHE_ENTRIES; i++) {
+		if (pk_cache[i].valid && (pk_cache[i].pk_len == pk_len) &&
+		    (memcmp(pk_cache[i].key_hash, key_hash, hash_len) == 0)) {
+			return &pk_cache[i].pk;
+		}
+	}
+
+	i = pk_cache_next;
+	pk_cache_next = (pk_cache_next + 1U) % TF_MBEDTLS_PK_CACHE_ENTRIES;
+	pk_cache_evict(i);
+
+	if (pk_cache_parse(i, pk_ptr, pk_len) != 0) {
+		/*
+		 * The parsing may have run out of heap because of the cached
+		 * keys, so retry once with an empty cache.
+		 */
+		for (i = 0U; i < TF_MBEDTLS_PK_CACHE_ENTRIES; i++) {
+			pk_cache_evict(i);
+		}
+
+		i = 0U;
+		pk_cache_next = 1U % TF_MBEDTLS_PK_CACHE_ENTRIES;
+		if (pk_cache_parse(i, pk_ptr, pk_len) != 0) {
+			return NULL;
+		}
+	}
+
+	(void)memcpy(pk_cache[i].key_hash, key_hash, hash_len);
+	pk_cache[i].pk_len = pk_len;
+	pk_cache[i].valid = true;
+
+	return &pk_cache[i].pk;
+}
+#endif /* TF_MBEDTLS_PK_CACHE_ENTRIES */
+
 /*
  * Verify a signature.
  *
@@ -92,7 +244,10 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	mbedtls_asn1_buf signature;
 	mbedtls_md_type_t md_alg;
 	mbedtls_pk_type_t pk_alg;
-	mbedtls_pk_context pk = {0};
+	mbedtls_pk_context *pk;
+#if !TF_MBEDTLS_PK_CACHE_ENTRIES
+	mbedtls_pk_context pk_ctx = {0};
+#endif
 	int rc;
 	void *sig_opts = NULL;
 	const mbedtls_md_info_t *md_info;
@@ -114,14 +269,23 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	}
 
 	/* Parse the public key */
-	mbedtls_pk_init(&pk);
+#if TF_MBEDTLS_PK_CACHE_ENTRIES
+	pk = pk_cache_get(pk_ptr, pk_len);
+	if (pk == NULL) {
+		rc = CRYPTO_ERR_SIGNATURE;
+		goto end2;
+	}
+#else
+	pk = &pk_ctx;
+	mbedtls_pk_init(pk);
 	p = (unsigned char *)pk_ptr;
 	end = (unsigned char *)(p + pk_len);
-	rc = mbedtls_pk_parse_subpubkey(&p, end, &pk);
+	rc = mbedtls_pk_parse_subpubkey(&p, end, pk);
 	if (rc != 0) {
 		rc = CRYPTO_ERR_SIGNATURE;
 		goto end2;
 	}
+#endif
 
 	/* Get the signature (bitstring) */
 	p = (unsigned char *)sig_ptr;
@@ -148,7 +312,7 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	}
 
 	/* Verify the signature */
-	rc = mbedtls_pk_verify_ext(pk_alg, sig_opts, &pk, md_alg, hash,
+	rc = mbedtls_pk_verify_ext(pk_alg, sig_opts, pk, md_alg, hash,
 			mbedtls_md_get_size(md_info),
 			signature.p, signature.len);
 	if (rc != 0) {
@@ -160,7 +324,9 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	rc = CRYPTO_SUCCESS;
 
 end1:
-	mbedtls_pk_free(&pk);
+#if !TF_MBEDTLS_PK_CACHE_ENTRIES
+	mbedtls_pk_free(pk);
+#endif
 end2:
 	mbedtls_free(sig_opts);
 	return rc;
@@ -226,11 +392,14 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 	}
 	hash = p;
 
-	/* Calculate the hash of the data */
-	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, data_hash);
-	if (rc != 0) {
-		return CRYPTO_ERR_HASH;
+	/* Calculate the hash of the data, unless it was hashed on decryption */
+	if (!dec_digest_take(DEC_DIGEST_VERIFY, md_alg, data_ptr, data_len,
+			     data_hash)) {
+		p = (unsigned char *)data_ptr;
+		rc = mbedtls_md(md_info, p, data_len, data_hash);
+		if (rc != 0) {
+			return CRYPTO_ERR_HASH;
+		}
 	}
 
 	/* Compare values */
@@ -282,6 +451,11 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
 		return CRYPTO_ERR_HASH;
 	}
 
+	if (dec_digest_take(DEC_DIGEST_CALC, md_type(md_algo), data_ptr,
+			    data_len, output)) {
+		return CRYPTO_SUCCESS;
+	}
+
 	/*
 	 * Calculate the hash of the data, it is safe to pass the
 	 * 'output' hash buffer pointer considering its size is always
@@ -294,6 +468,71 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
 
 	return CRYPTO_SUCCESS;
 }
+
+/*
+ * Calculate several hashes of the same data
+ *
+ * The data is walked once in MD_MULTI_BLOCK_SIZE blocks and every digest is
+ * updated with a block while it is still resident in the data cache, instead
+ * of streaming the whole buffer from memory once per algorithm.
+ */
+static int calc_hashes(const enum crypto_md_algo md_algs[],
+		       unsigned int md_count, void *data_ptr,
+		       unsigned int data_len,
+		       unsigned char (*output)[CRYPTO_MD_MAX_SIZE])
+{
+	mbedtls_md_context_t ctx[CRYPTO_MD_ALGO_COUNT];
+	const mbedtls_md_info_t *md_info;
+	const unsigned char *p = data_ptr;
+	unsigned int chunk, i;
+	int rc = 0;
+
+	if (md_count > CRYPTO_MD_ALGO_COUNT) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	/* Never offer the digest of a decryption to a later call */
+	(void)dec_digest_take(DEC_DIGEST_CALC, MBEDTLS_MD_NONE, NULL, 0U, NULL);
+
+	for (i = 0U; i < md_count; i++) {
+		mbedtls_md_init(&ctx[i]);
+	}
+
+	for (i = 0U; (i < md_count) && (rc == 0); i++) {
+		md_info = mbedtls_md_info_from_type(md_type(md_algs[i]));
+		if (md_info == NULL) {
+			rc = -1;
+			break;
+		}
+
+		rc = mbedtls_md_setup(&ctx[i], md_info, 0);
+		if (rc == 0) {
+			rc = mbedtls_md_starts(&ctx[i]);
+		}
+	}
+
+	while ((data_len != 0U) && (rc == 0)) {
+		chunk = (data_len > MD_MULTI_BLOCK_SIZE) ?
+			MD_MULTI_BLOCK_SIZE : data_len;
+
+		for (i = 0U; (i < md_count) && (rc == 0); i++) {
+			rc = mbedtls_md_update(&ctx[i], p, chunk);
+		}
+
+		p += chunk;
+		data_len -= chunk;
+	}
+
+	for (i = 0U; (i < md_count) && (rc == 0); i++) {
+		rc = mbedtls_md_finish(&ctx[i], output[i]);
+	}
+
+	for (i = 0U; i < md_count; i++) {
+		mbedtls_md_free(&ctx[i]);
+	}
+
+	return (rc == 0) ? CRYPTO_SUCCESS : CRYPTO_ERR_HASH;
+}
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
@@ -304,50 +543,100 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
  */
 #define DEC_OP_BUF_SIZE		128
 
-static int aes_gcm_decrypt(void *data_ptr, size_t len, const void *key,
-			   unsigned int key_len, const void *iv,
-			   unsigned int iv_len, const void *tag,
-			   unsigned int tag_len)
+/*
+ * State of the streamed decryption. The plaintext is hashed with AUTH_MD
+ * while it is in the decryption buffer, as long as it is contiguous.
+ */
+static struct {
+	mbedtls_gcm_context gcm;
+	mbedtls_md_context_t md;
+	bool hashing;
+	unsigned char *data_ptr;
+	size_t data_len;
+} dec_stream;
+
+/*
+ * Start a streamed authenticated decryption
+ */
+static int auth_decrypt_init(enum crypto_dec_algo dec_algo, const void *key,
+			     unsigned int key_len, unsigned int key_flags,
+			     const void *iv, unsigned int iv_len)
 {
-	mbedtls_gcm_context ctx;
 	mbedtls_cipher_id_t cipher = MBEDTLS_CIPHER_ID_AES;
-	unsigned char buf[DEC_OP_BUF_SIZE];
-	unsigned char tag_buf[CRYPTO_MAX_TAG_SIZE];
-	unsigned char *pt = data_ptr;
-	size_t dec_len;
-	int diff, i, rc;
-	size_t output_length __unused;
+	int rc;
 
-	mbedtls_gcm_init(&ctx);
+	assert((key_flags & ENC_KEY_IS_IDENTIFIER) == 0);
 
-	rc = mbedtls_gcm_setkey(&ctx, cipher, key, key_len * 8);
-	if (rc != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
+	if (dec_algo != CRYPTO_GCM_DECRYPT) {
+		return CRYPTO_ERR_DECRYPTION;
 	}
 
+	dec_digest.users = 0U;
+
+	mbedtls_gcm_init(&dec_stream.gcm);
+
+	rc = mbedtls_gcm_setkey(&dec_stream.gcm, cipher, key, key_len * 8);
+	if (rc == 0) {
 #if (MBEDTLS_VERSION_MAJOR < 3)
-	rc = mbedtls_gcm_starts(&ctx, MBEDTLS_GCM_DECRYPT, iv, iv_len, NULL, 0);
+		rc = mbedtls_gcm_starts(&dec_stream.gcm, MBEDTLS_GCM_DECRYPT,
+					iv, iv_len, NULL, 0);
 #else
-	rc = mbedtls_gcm_starts(&ctx, MBEDTLS_GCM_DECRYPT, iv, iv_len);
+		rc = mbedtls_gcm_starts(&dec_stream.gcm, MBEDTLS_GCM_DECRYPT,
+					iv, iv_len);
 #endif
+	}
+
 	if (rc != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
+		mbedtls_gcm_free(&dec_stream.gcm);
+		return CRYPTO_ERR_DECRYPTION;
 	}
 
+	/* Without a digest, verify_hash() and calc_hash() hash the data */
+	mbedtls_md_init(&dec_stream.md);
+	dec_stream.hashing =
+		(mbedtls_md_setup(&dec_stream.md,
+				  mbedtls_md_info_from_type(AUTH_MD), 0) == 0) &&
+		(mbedtls_md_starts(&dec_stream.md) == 0);
+	dec_stream.data_ptr = NULL;
+	dec_stream.data_len = 0U;
+
+	return CRYPTO_SUCCESS;
+}
+
+/*
+ * Decrypt in place the next part of the data of a streamed decryption
+ */
+static int auth_decrypt_update(void *data_ptr, size_t len)
+{
+	unsigned char buf[DEC_OP_BUF_SIZE];
+	unsigned char *pt = data_ptr;
+	size_t dec_len;
+	size_t output_length __unused;
+	int rc;
+
+	if (dec_stream.data_ptr == NULL) {
+		dec_stream.data_ptr = pt;
+	} else if (pt != (dec_stream.data_ptr + dec_stream.data_len)) {
+		dec_stream.hashing = false;
+	}
+	dec_stream.data_len += len;
+
 	while (len > 0) {
 		dec_len = MIN(sizeof(buf), len);
 
 #if (MBEDTLS_VERSION_MAJOR < 3)
-		rc = mbedtls_gcm_update(&ctx, dec_len, pt, buf);
+		rc = mbedtls_gcm_update(&dec_stream.gcm, dec_len, pt, buf);
 #else
-		rc = mbedtls_gcm_update(&ctx, pt, dec_len, buf, sizeof(buf), &output_length);
+		rc = mbedtls_gcm_update(&dec_stream.gcm, pt, dec_len, buf,
+					sizeof(buf), &output_length);
 #endif
-
 		if (rc != 0) {
-			rc = CRYPTO_ERR_DECRYPTION;
-			goto exit_gcm;
+			return CRYPTO_ERR_DECRYPTION;
+		}
+
+		if (dec_stream.hashing &&
+		    (mbedtls_md_update(&dec_stream.md, buf, dec_len) != 0)) {
+			dec_stream.hashing = false;
 		}
 
 		memcpy(pt, buf, dec_len);
@@ -355,31 +644,54 @@ static int aes_gcm_decrypt(void *data_ptr, size_t len, const void *key,
 		len -= dec_len;
 	}
 
+	return CRYPTO_SUCCESS;
+}
+
+/*
+ * Check the tag of a streamed decryption, or abort it if 'tag' is NULL
+ */
+static int auth_decrypt_finish(const void *tag, unsigned int tag_len)
+{
+	unsigned char tag_buf[CRYPTO_MAX_TAG_SIZE];
+	size_t output_length __unused;
+	int diff, i, rc;
+
+	rc = CRYPTO_ERR_DECRYPTION;
+
+	if (tag != NULL) {
 #if (MBEDTLS_VERSION_MAJOR < 3)
-	rc = mbedtls_gcm_finish(&ctx, tag_buf, sizeof(tag_buf));
+		rc = mbedtls_gcm_finish(&dec_stream.gcm, tag_buf,
+					sizeof(tag_buf));
 #else
-	rc = mbedtls_gcm_finish(&ctx, NULL, 0, &output_length, tag_buf, sizeof(tag_buf));
+		rc = mbedtls_gcm_finish(&dec_stream.gcm, NULL, 0,
+					&output_length, tag_buf,
+					sizeof(tag_buf));
 #endif
-
-	if (rc != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
 	}
 
-	/* Check tag in "constant-time" */
-	for (diff = 0, i = 0; i < tag_len; i++)
-		diff |= ((const unsigned char *)tag)[i] ^ tag_buf[i];
+	if (rc == 0) {
+		/* Check tag in "constant-time" */
+		for (diff = 0, i = 0; i < tag_len; i++)
+			diff |= ((const unsigned char *)tag)[i] ^ tag_buf[i];
 
-	if (diff != 0) {
+		rc = (diff == 0) ? CRYPTO_SUCCESS : CRYPTO_ERR_DECRYPTION;
+	} else {
 		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
 	}
 
-	/* GCM decryption success */
-	rc = CRYPTO_SUCCESS;
+	/* Only the digest of authenticated plaintext may be reused */
+	if ((rc == CRYPTO_SUCCESS) && dec_stream.hashing &&
+	    (dec_stream.data_ptr != NULL) &&
+	    (mbedtls_md_finish(&dec_stream.md, dec_digest.digest) == 0)) {
+		dec_digest.data_ptr = dec_stream.data_ptr;
+		dec_digest.data_len = dec_stream.data_len;
+		dec_digest.users = DEC_DIGEST_VERIFY | DEC_DIGEST_CALC;
+		rc = CRYPTO_SUCCESS_DIGEST;
+	}
+
+	mbedtls_md_free(&dec_stream.md);
+	mbedtls_gcm_free(&dec_stream.gcm);
 
-exit_gcm:
-	mbedtls_gcm_free(&ctx);
 	return rc;
 }
 
@@ -394,20 +706,18 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 {
 	int rc;
 
-	assert((key_flags & ENC_KEY_IS_IDENTIFIER) == 0);
+	rc = auth_decrypt_init(dec_algo, key, key_len, key_flags, iv, iv_len);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
 
-	switch (dec_algo) {
-	case CRYPTO_GCM_DECRYPT:
-		rc = aes_gcm_decrypt(data_ptr, len, key, key_len, iv, iv_len,
-				     tag, tag_len);
-		if (rc != 0)
-			return rc;
-		break;
-	default:
-		return CRYPTO_ERR_DECRYPTION;
+	rc = auth_decrypt_update(data_ptr, len);
+	if (rc != CRYPTO_SUCCESS) {
+		(void)auth_decrypt_finish(NULL, 0U);
+		return rc;
 	}
 
-	return CRYPTO_SUCCESS;
+	return auth_decrypt_finish(tag, tag_len);
 }
 #endif /* TF_MBEDTLS_USE_AES_GCM */
 
@@ -417,19 +727,22 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 #if TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    auth_decrypt, NULL, NULL);
+		    calc_hashes, auth_decrypt, auth_decrypt_init,
+		    auth_decrypt_update, auth_decrypt_finish, NULL, NULL);
 #else
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    NULL, NULL, NULL);
+		    calc_hashes, NULL, NULL, NULL, NULL, NULL, NULL);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY
 #if TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    auth_decrypt, NULL, NULL);
+		    NULL, auth_decrypt, auth_decrypt_init, auth_decrypt_update,
+		    auth_decrypt_finish, NULL, NULL);
 #else
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    NULL, NULL, NULL);
+		    NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY
-REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, NULL, NULL, NULL);
+REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, calc_hashes,
+		    NULL, NULL, NULL, NULL, NULL, NULL);
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
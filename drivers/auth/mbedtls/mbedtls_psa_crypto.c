@@ -29,6 +29,9 @@
 
 #define LIB_NAME		"mbed TLS PSA"
 
+/* Block size used when computing several digests in a single pass */
+#define MD_MULTI_BLOCK_SIZE	U(4096)
+
 /* Minimum required size for a buffer containing a raw EC signature when using
  * a maximum curve size of 384 bits.
  * This is calculated as 2 * (384 / 8). */
@@ -482,6 +485,61 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
 
 	return CRYPTO_SUCCESS;
 }
+
+/*
+ * Calculate several hashes of the same data
+ *
+ * The data is walked once in MD_MULTI_BLOCK_SIZE blocks and every hash
+ * operation is updated with a block while it is still resident in the data
+ * cache, instead of streaming the whole buffer once per algorithm.
+ */
+static int calc_hashes(const enum crypto_md_algo md_algs[],
+		       unsigned int md_count, void *data_ptr,
+		       unsigned int data_len,
+		       unsigned char (*output)[CRYPTO_MD_MAX_SIZE])
+{
+	psa_hash_operation_t op[CRYPTO_MD_ALGO_COUNT];
+	const uint8_t *p = data_ptr;
+	psa_status_t status = PSA_SUCCESS;
+	size_t hash_length;
+	unsigned int chunk, i;
+
+	if (md_count > CRYPTO_MD_ALGO_COUNT) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	for (i = 0U; i < md_count; i++) {
+		op[i] = psa_hash_operation_init();
+	}
+
+	for (i = 0U; (i < md_count) && (status == PSA_SUCCESS); i++) {
+		status = psa_hash_setup(&op[i],
+				mbedtls_md_psa_alg_from_type(md_type(md_algs[i])));
+	}
+
+	while ((data_len != 0U) && (status == PSA_SUCCESS)) {
+		chunk = (data_len > MD_MULTI_BLOCK_SIZE) ?
+			MD_MULTI_BLOCK_SIZE : data_len;
+
+		for (i = 0U; (i < md_count) && (status == PSA_SUCCESS); i++) {
+			status = psa_hash_update(&op[i], p, chunk);
+		}
+
+		p += chunk;
+		data_len -= chunk;
+	}
+
+	for (i = 0U; (i < md_count) && (status == PSA_SUCCESS); i++) {
+		status = psa_hash_finish(&op[i], (uint8_t *)output[i],
+					 CRYPTO_MD_MAX_SIZE, &hash_length);
+	}
+
+	for (i = 0U; i < md_count; i++) {
+		(void)psa_hash_abort(&op[i]);
+	}
+
+	return (status == PSA_SUCCESS) ? CRYPTO_SUCCESS : CRYPTO_ERR_HASH;
+}
 #endif /*
 	* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
@@ -590,19 +648,21 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 #if CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC
 #if TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    auth_decrypt, NULL, finish);
+		    calc_hashes, auth_decrypt, NULL, NULL, NULL, NULL,
+		    finish);
 #else
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, calc_hash,
-		    NULL, NULL, finish);
+		    calc_hashes, NULL, NULL, NULL, NULL, NULL, finish);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY
 #if TF_MBEDTLS_USE_AES_GCM
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    auth_decrypt, NULL, finish);
+		    NULL, auth_decrypt, NULL, NULL, NULL, NULL, finish);
 #else
 REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
-		    NULL, NULL, finish);
+		    NULL, NULL, NULL, NULL, NULL, NULL, finish);
 #endif
 #elif CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY
-REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, NULL, NULL, finish);
+REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, calc_hashes,
+		    NULL, NULL, NULL, NULL, NULL, finish);
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
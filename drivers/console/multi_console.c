@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2025, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 
+#include <common/tf_log_ring.h>
 #include <drivers/console.h>
 
 console_t *console_list;
@@ -107,6 +108,12 @@ int console_putc(int c)
 
 int putchar(int c)
 {
+	/*
+	 * Direct output, e.g. from printf(), must not overtake the messages
+	 * still pending in the log ring.
+	 */
+	tf_log_ring_drain();
+
 	if (console_putc(c) == 0) {
 		return c;
 	} else {
@@ -142,6 +149,9 @@ void console_flush(void)
 {
 	console_t *console;
 
+	/* Output deferred by the log ring must reach the console first */
+	tf_log_ring_drain();
+
 	for (console = console_list; console != NULL; console = console->next)
 		if (((console->flags & console_state) != 0U) && (console->flush != NULL)) {
 			console->flush(console);
@@ -30,6 +30,15 @@ static uintptr_t backend_image_spec;
 
 static io_dev_info_t enc_dev_info;
 
+/*
+ * Size of the chunks the payload is read and decrypted by. Larger chunks
+ * amortise the backend read requests, smaller ones keep each chunk in the
+ * data cache between its read and its decryption.
+ */
+#ifndef PLAT_ENC_READ_CHUNK_SIZE
+#define PLAT_ENC_READ_CHUNK_SIZE	U(0x4000)
+#endif
+
 /* Encrypted firmware driver functions */
 static int enc_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
 static int enc_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
@@ -150,6 +159,108 @@ static int enc_file_len(io_entity_t *entity, size_t *length)
 	return result;
 }
 
+/*
+ * Read the whole payload, then decrypt it
+ */
+static int enc_read_decrypt(const struct fw_enc_hdr *header, uintptr_t buffer,
+			    size_t length, size_t *length_read,
+			    const uint8_t *key, size_t key_len,
+			    unsigned int key_flags)
+{
+	int result;
+	size_t bytes_read;
+
+	result = io_read(backend_handle, buffer, length, &bytes_read);
+	if (result != 0) {
+		WARN("Failed to read encrypted payload (%i)\n", result);
+		return -ENOENT;
+	}
+
+	result = crypto_mod_auth_decrypt(header->dec_algo,
+					 (void *)buffer, bytes_read, key,
+					 key_len, key_flags, header->iv,
+					 header->iv_len, header->tag,
+					 header->tag_len);
+	if (result != 0) {
+		ERROR("File decryption failed (%i)\n", result);
+		zeromem((void *)buffer, bytes_read);
+		return -ENOENT;
+	}
+
+	*length_read = bytes_read;
+
+	return 0;
+}
+
+/*
+ * Read the payload by chunks and decrypt each chunk as it arrives, while it
+ * is still in the data cache, instead of walking the whole image from memory
+ * again once it is read. The crypto library may also hash the plaintext on
+ * the way, for the authentication and measurement of the image. Return
+ * CRYPTO_ERR_NOT_SUPPORTED if the crypto library cannot decrypt by parts.
+ */
+static int enc_read_stream_decrypt(const struct fw_enc_hdr *header,
+				   uintptr_t buffer, size_t length,
+				   size_t *length_read, const uint8_t *key,
+				   size_t key_len, unsigned int key_flags)
+{
+	int result;
+	size_t bytes_read, chunk, done = 0U;
+
+	result = crypto_mod_auth_decrypt_init(header->dec_algo, key, key_len,
+					      key_flags, header->iv,
+					      header->iv_len);
+	if (result != 0) {
+		return result;
+	}
+
+	while (done < length) {
+		chunk = MIN(length - done, (size_t)PLAT_ENC_READ_CHUNK_SIZE);
+
+		result = io_read(backend_handle, buffer + done, chunk,
+				 &bytes_read);
+		if (result != 0) {
+			WARN("Failed to read encrypted payload (%i)\n", result);
+			goto abort;
+		}
+
+		if (bytes_read == 0U) {
+			break;
+		}
+
+		result = crypto_mod_auth_decrypt_update((void *)(buffer + done),
+							bytes_read);
+		if (result != 0) {
+			ERROR("File decryption failed (%i)\n", result);
+			goto abort;
+		}
+
+		done += bytes_read;
+
+		/* A short read is the end of the payload */
+		if (bytes_read < chunk) {
+			break;
+		}
+	}
+
+	result = crypto_mod_auth_decrypt_finish(header->tag, header->tag_len);
+	if (result != 0) {
+		ERROR("File decryption failed (%i)\n", result);
+		zeromem((void *)buffer, done);
+		return -ENOENT;
+	}
+
+	*length_read = done;
+
+	return 0;
+
+abort:
+	(void)crypto_mod_auth_decrypt_finish(NULL, 0U);
+	zeromem((void *)buffer, done);
+
+	return -ENOENT;
+}
+
 static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			 size_t *length_read)
 {
@@ -186,14 +297,6 @@ static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		return -ENOENT;
 	}
 
-	result = io_read(backend_handle, buffer, length, &bytes_read);
-	if (result != 0) {
-		WARN("Failed to read encrypted payload (%i)\n", result);
-		return -ENOENT;
-	}
-
-	*length_read = bytes_read;
-
 	result = plat_get_enc_key_info(fw_enc_status, key, &key_len, &key_flags,
 				       (uint8_t *)&uuid_spec->uuid,
 				       sizeof(uuid_t));
@@ -202,18 +305,18 @@ static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		return -ENOENT;
 	}
 
-	result = crypto_mod_auth_decrypt(header.dec_algo,
-					 (void *)buffer, *length_read, key,
-					 key_len, key_flags, header.iv,
-					 header.iv_len, header.tag,
-					 header.tag_len);
-	memset(key, 0, key_len);
-
-	if (result != 0) {
+	result = enc_read_stream_decrypt(&header, buffer, length, length_read,
+					 key, key_len, key_flags);
+	if (result == CRYPTO_ERR_NOT_SUPPORTED) {
+		result = enc_read_decrypt(&header, buffer, length, length_read,
+					  key, key_len, key_flags);
+	} else if (result > 0) {
 		ERROR("File decryption failed (%i)\n", result);
-		return -ENOENT;
+		result = -ENOENT;
 	}
 
+	memset(key, 0, key_len);
+
 	return result;
 }
 
@@ -140,9 +140,11 @@ static int memmap_block_seek(io_entity_t *entity, int mode,
 
 		fp = (memmap_file_state_t *) entity->info;
 
-		/* Assert that new file position is valid */
-		assert((offset >= 0) &&
-		       ((unsigned long long)offset < fp->size));
+		/* Reject positions outside of the file */
+		if ((offset < 0) ||
+		    ((unsigned long long)offset >= fp->size)) {
+			return -EINVAL;
+		}
 
 		/* Reset file position */
 		fp->file_pos = (unsigned long long)offset;
@@ -177,9 +179,11 @@ static int memmap_block_read(io_entity_t *entity, uintptr_t buffer,
 
 	fp = (memmap_file_state_t *) entity->info;
 
-	/* Assert that file position is valid for this read operation */
+	/* Reject reads beyond the end of the file */
 	pos_after = fp->file_pos + length;
-	assert((pos_after >= fp->file_pos) && (pos_after <= fp->size));
+	if ((pos_after < fp->file_pos) || (pos_after > fp->size)) {
+		return -EINVAL;
+	}
 
 	memcpy((void *)buffer,
 	       (void *)((uintptr_t)(fp->base + fp->file_pos)), length);
@@ -205,9 +209,11 @@ static int memmap_block_write(io_entity_t *entity, const uintptr_t buffer,
 
 	fp = (memmap_file_state_t *) entity->info;
 
-	/* Assert that file position is valid for this write operation */
+	/* Reject writes beyond the end of the file */
 	pos_after = fp->file_pos + length;
-	assert((pos_after >= fp->file_pos) && (pos_after <= fp->size));
+	if ((pos_after < fp->file_pos) || (pos_after > fp->size)) {
+		return -EINVAL;
+	}
 
 	memcpy((void *)((uintptr_t)(fp->base + fp->file_pos)),
 	       (void *)buffer, length);
@@ -9,6 +9,7 @@
 
 #include <platform_def.h>
 
+#include <common/boot_prof.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_storage.h>
 
@@ -171,6 +172,7 @@ int io_dev_open(const io_dev_connector_t *dev_con, const uintptr_t dev_spec,
 int io_dev_init(uintptr_t dev_handle, const uintptr_t init_params)
 {
 	int result = 0;
+	unsigned int prof;
 	assert(dev_handle != (uintptr_t)NULL);
 	assert(is_valid_dev(dev_handle));
 
@@ -178,7 +180,10 @@ int io_dev_init(uintptr_t dev_handle, const uintptr_t init_params)
 
 	/* Absence of registered function implies NOP here */
 	if (dev->funcs->dev_init != NULL) {
+		prof = boot_prof_begin(BOOT_PROF_STORAGE_INIT,
+				       (unsigned int)dev->funcs->type());
 		result = dev->funcs->dev_init(dev, init_params);
+		boot_prof_end(prof);
 	}
 
 	return result;
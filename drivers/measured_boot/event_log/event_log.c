@@ -21,6 +21,34 @@
 #  error Invalid TPM algorithm.
 #endif /* TPM_ALG_ID */
 
+/* PCR bank recorded in the Event Log */
+typedef struct {
+	uint16_t algorithm_id;
+	uint16_t digest_size;
+	enum crypto_md_algo md_alg;
+} evlog_bank_t;
+
+/* Recorded PCR banks, the bank selected by TPM_ALG_ID comes first */
+static const evlog_bank_t evlog_banks[HASH_ALG_COUNT] = {
+	{ TPM_ALG_ID, TCG_DIGEST_SIZE, CRYPTO_MD_ID },
+#if MBOOT_EL_EXTRA_SHA256 && (TPM_ALG_ID != TPM_ALG_SHA256)
+	{ TPM_ALG_SHA256, SHA256_DIGEST_SIZE, CRYPTO_MD_SHA256 },
+#endif
+#if MBOOT_EL_EXTRA_SHA384 && (TPM_ALG_ID != TPM_ALG_SHA384)
+	{ TPM_ALG_SHA384, SHA384_DIGEST_SIZE, CRYPTO_MD_SHA384 },
+#endif
+#if MBOOT_EL_EXTRA_SHA512 && (TPM_ALG_ID != TPM_ALG_SHA512)
+	{ TPM_ALG_SHA512, SHA512_DIGEST_SIZE, CRYPTO_MD_SHA512 },
+#endif
+};
+
+/*
+ * Metadata table the index below was built for, and position + 1 of the
+ * entry for each image ID in that table (0 if the ID is not indexed).
+ */
+static const event_log_metadata_t *metadata_index_table;
+static uint8_t metadata_index[EVLOG_METADATA_INDEX_SIZE];
+
 /* Running Event Log Pointer */
 static uint8_t *log_ptr;
 
@@ -77,6 +105,7 @@ int event_log_record(const uint8_t *hash, uint32_t event_type,
 {
 	void *ptr = log_ptr;
 	uint32_t name_len = 0U;
+	unsigned int i;
 
 	/* event_log_buf_init() must have been called prior to this. */
 	if (hash == NULL || metadata_ptr == NULL || log_ptr == NULL) {
@@ -111,17 +140,20 @@ int event_log_record(const uint8_t *hash, uint32_t event_type,
 	ptr = (uint8_t *)((uintptr_t)ptr +
 			offsetof(tpml_digest_values, digests));
 
-	/* TCG_PCR_EVENT2.Digests[].AlgorithmId */
-	((tpmt_ha *)ptr)->algorithm_id = TPM_ALG_ID;
+	for (i = 0U; i < HASH_ALG_COUNT; i++) {
+		/* TCG_PCR_EVENT2.Digests[].AlgorithmId */
+		((tpmt_ha *)ptr)->algorithm_id = evlog_banks[i].algorithm_id;
 
-	/* TCG_PCR_EVENT2.Digests[].Digest[] */
-	ptr = (uint8_t *)((uintptr_t)ptr + offsetof(tpmt_ha, digest));
+		/* TCG_PCR_EVENT2.Digests[].Digest[] */
+		ptr = (uint8_t *)((uintptr_t)ptr + offsetof(tpmt_ha, digest));
 
-	/* Copy digest */
-	(void)memcpy(ptr, (const void *)hash, TCG_DIGEST_SIZE);
+		/* Copy digest */
+		(void)memcpy(ptr, (const void *)&hash[i * CRYPTO_MD_MAX_SIZE],
+			     evlog_banks[i].digest_size);
+		ptr = (uint8_t *)((uintptr_t)ptr + evlog_banks[i].digest_size);
+	}
 
 	/* TCG_PCR_EVENT2.EventSize */
-	ptr = (uint8_t *)((uintptr_t)ptr + TCG_DIGEST_SIZE);
 	((event2_data_t *)ptr)->event_size = name_len;
 
 	/* Copy event data to TCG_PCR_EVENT2.Event */
@@ -158,6 +190,7 @@ int event_log_init(uint8_t *event_log_start, uint8_t *event_log_finish)
 int event_log_write_specid_event(void)
 {
 	void *ptr;
+	unsigned int i;
 
 	/* event_log_buf_init() must have been called prior to this. */
 	if (log_ptr == NULL) {
@@ -179,10 +212,15 @@ int event_log_write_specid_event(void)
 			sizeof(id_event_header));
 	ptr = (uint8_t *)((uintptr_t)ptr + sizeof(id_event_header));
 
-	/* TCG_EfiSpecIdEventAlgorithmSize structure */
-	((id_event_algorithm_size_t *)ptr)->algorithm_id = TPM_ALG_ID;
-	((id_event_algorithm_size_t *)ptr)->digest_size = TCG_DIGEST_SIZE;
-	ptr = (uint8_t *)((uintptr_t)ptr + sizeof(id_event_algorithm_size_t));
+	/* TCG_EfiSpecIdEventAlgorithmSize structures */
+	for (i = 0U; i < HASH_ALG_COUNT; i++) {
+		((id_event_algorithm_size_t *)ptr)->algorithm_id =
+			evlog_banks[i].algorithm_id;
+		((id_event_algorithm_size_t *)ptr)->digest_size =
+			evlog_banks[i].digest_size;
+		ptr = (uint8_t *)((uintptr_t)ptr +
+				sizeof(id_event_algorithm_size_t));
+	}
 
 	/*
 	 * TCG_EfiSpecIDEventStruct.vendorInfoSize
@@ -199,6 +237,7 @@ int event_log_write_header(void)
 {
 	const char locality_signature[] = TCG_STARTUP_LOCALITY_SIGNATURE;
 	void *ptr;
+	unsigned int i;
 	int rc;
 
 	rc = event_log_write_specid_event();
@@ -224,13 +263,16 @@ int event_log_write_header(void)
 			sizeof(locality_event_header));
 	ptr = (uint8_t *)((uintptr_t)ptr + sizeof(locality_event_header));
 
-	/* TCG_PCR_EVENT2.Digests[].AlgorithmId */
-	((tpmt_ha *)ptr)->algorithm_id = TPM_ALG_ID;
+	for (i = 0U; i < HASH_ALG_COUNT; i++) {
+		/* TCG_PCR_EVENT2.Digests[].AlgorithmId */
+		((tpmt_ha *)ptr)->algorithm_id = evlog_banks[i].algorithm_id;
 
-	/* TCG_PCR_EVENT2.Digests[].Digest[] */
-	(void)memset(&((tpmt_ha *)ptr)->digest, 0, TCG_DIGEST_SIZE);
-	ptr = (uint8_t *)((uintptr_t)ptr +
-			offsetof(tpmt_ha, digest) + TCG_DIGEST_SIZE);
+		/* TCG_PCR_EVENT2.Digests[].Digest[] */
+		(void)memset(&((tpmt_ha *)ptr)->digest, 0,
+			     evlog_banks[i].digest_size);
+		ptr = (uint8_t *)((uintptr_t)ptr + offsetof(tpmt_ha, digest) +
+				evlog_banks[i].digest_size);
+	}
 
 	/* TCG_PCR_EVENT2.EventSize */
 	((event2_data_t *)ptr)->event_size =
@@ -259,11 +301,83 @@ int event_log_measure(uintptr_t data_base, uint32_t data_size,
 				    (void *)data_base, data_size, hash_data);
 }
 
+int event_log_measure_banks(uintptr_t data_base, uint32_t data_size,
+		unsigned char digests[HASH_ALG_COUNT][CRYPTO_MD_MAX_SIZE])
+{
+	enum crypto_md_algo md_algs[HASH_ALG_COUNT];
+	unsigned int i;
+
+	for (i = 0U; i < HASH_ALG_COUNT; i++) {
+		md_algs[i] = evlog_banks[i].md_alg;
+	}
+
+	/* Calculate the hash of every bank in a single pass */
+	return crypto_mod_calc_hashes(md_algs, HASH_ALG_COUNT,
+				      (void *)data_base, data_size, digests);
+}
+
+void event_log_get_bank(unsigned int bank, uint16_t *algorithm_id,
+			uint16_t *digest_size)
+{
+	assert(bank < HASH_ALG_COUNT);
+
+	*algorithm_id = evlog_banks[bank].algorithm_id;
+	*digest_size = evlog_banks[bank].digest_size;
+}
+
+/*
+ * Index the image IDs of a metadata table. Entries past UINT8_MAX and IDs
+ * above EVLOG_METADATA_INDEX_SIZE are left to the linear lookup.
+ */
+static void event_log_index_metadata(const event_log_metadata_t *metadata_ptr)
+{
+	unsigned int i;
+
+	(void)memset(metadata_index, 0, sizeof(metadata_index));
+
+	for (i = 0U; (metadata_ptr[i].id != EVLOG_INVALID_ID) &&
+		     (i < UINT8_MAX); i++) {
+		unsigned int id = metadata_ptr[i].id;
+
+		if ((id < EVLOG_METADATA_INDEX_SIZE) &&
+		    (metadata_index[id] == 0U)) {
+			metadata_index[id] = (uint8_t)(i + 1U);
+		}
+	}
+
+	metadata_index_table = metadata_ptr;
+}
+
+static const event_log_metadata_t *event_log_find_metadata(
+			const event_log_metadata_t *metadata_ptr,
+			uint32_t data_id)
+{
+	if (metadata_ptr != metadata_index_table) {
+		event_log_index_metadata(metadata_ptr);
+	}
+
+	if ((data_id < EVLOG_METADATA_INDEX_SIZE) &&
+	    (metadata_index[data_id] != 0U)) {
+		return &metadata_ptr[metadata_index[data_id] - 1U];
+	}
+
+	/* Not indexed, walk the table */
+	while (metadata_ptr->id != data_id) {
+		if (metadata_ptr->id == EVLOG_INVALID_ID) {
+			return NULL;
+		}
+
+		metadata_ptr++;
+	}
+
+	return metadata_ptr;
+}
+
 int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 				 uint32_t data_id,
 				 const event_log_metadata_t *metadata_ptr)
 {
-	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
+	unsigned char digests[HASH_ALG_COUNT][CRYPTO_MD_MAX_SIZE];
 	int rc;
 
 	if (metadata_ptr == NULL) {
@@ -271,21 +385,18 @@ int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 	}
 
 	/* Get the metadata associated with this image. */
-	while (metadata_ptr->id != data_id) {
-		if (metadata_ptr->id == EVLOG_INVALID_ID) {
-			return -EINVAL;
-		}
-
-		metadata_ptr++;
+	metadata_ptr = event_log_find_metadata(metadata_ptr, data_id);
+	if (metadata_ptr == NULL) {
+		return -EINVAL;
 	}
 
-	/* Measure the payload with algorithm selected by EventLog driver */
-	rc = event_log_measure(data_base, data_size, hash_data);
+	/* Measure the payload with every bank selected by EventLog driver */
+	rc = event_log_measure_banks(data_base, data_size, digests);
 	if (rc != 0) {
 		return rc;
 	}
 
-	rc = event_log_record(hash_data, EV_POST_CODE, metadata_ptr);
+	rc = event_log_record(&digests[0][0], EV_POST_CODE, metadata_ptr);
 	if (rc != 0) {
 		return rc;
 	}
@@ -34,12 +34,43 @@ else
     TCG_DIGEST_SIZE		:=	32U
 endif #MBOOT_EL_HASH_ALG
 
+# Additional PCR banks recorded in the Event Log, as a space separated list of
+# hash algorithms (sha256, sha384, sha512). Every measurement is hashed with
+# MBOOT_EL_HASH_ALG and all of these in a single pass over the data, and each
+# TCG_PCR_EVENT2 carries one digest per bank. MBOOT_EL_HASH_ALG is always the
+# first bank and is ignored if repeated here.
+MBOOT_EL_EXTRA_HASH_ALGS	?=
+
+$(foreach alg,${MBOOT_EL_EXTRA_HASH_ALGS},\
+    $(if $(filter ${alg},sha256 sha384 sha512),,\
+        $(error "Invalid value for MBOOT_EL_EXTRA_HASH_ALGS: ${alg}")))
+
+MBOOT_EL_EXTRA_SHA256	:=	$(if $(filter sha256,${MBOOT_EL_EXTRA_HASH_ALGS}),1,0)
+MBOOT_EL_EXTRA_SHA384	:=	$(if $(filter sha384,${MBOOT_EL_EXTRA_HASH_ALGS}),1,0)
+MBOOT_EL_EXTRA_SHA512	:=	$(if $(filter sha512,${MBOOT_EL_EXTRA_HASH_ALGS}),1,0)
+
+# Have the crypto library enable every algorithm recorded in the Event Log.
+# This is done here rather than in mbedtls_common.mk, which may be included
+# before this file.
+ifneq ($(filter sha256,${MBOOT_EL_HASH_ALG} ${MBOOT_EL_EXTRA_HASH_ALGS}),)
+    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA256))
+endif
+ifneq ($(filter sha384,${MBOOT_EL_HASH_ALG} ${MBOOT_EL_EXTRA_HASH_ALGS}),)
+    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA384))
+endif
+ifneq ($(filter sha512,${MBOOT_EL_HASH_ALG} ${MBOOT_EL_EXTRA_HASH_ALGS}),)
+    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA512))
+endif
+
 # Set definitions for Measured Boot driver.
 $(eval $(call add_defines,\
     $(sort \
         TPM_ALG_ID \
         TCG_DIGEST_SIZE \
         EVENT_LOG_LEVEL \
+        MBOOT_EL_EXTRA_SHA256 \
+        MBOOT_EL_EXTRA_SHA384 \
+        MBOOT_EL_EXTRA_SHA512 \
 )))
 
 INCLUDES		+= -Iinclude/drivers/measured_boot/event_log \
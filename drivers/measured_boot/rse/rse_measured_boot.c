@@ -59,14 +59,10 @@ void rse_measured_boot_init(struct rse_mboot_metadata *metadata_ptr)
 	}
 }
 
-int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
-				 uintptr_t data_base, uint32_t data_size,
-				 uint32_t data_id)
+static struct rse_mboot_metadata *
+rse_mboot_find_metadata(struct rse_mboot_metadata *metadata_ptr,
+			uint32_t data_id)
 {
-	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
-	int rc;
-	psa_status_t ret;
-
 	assert(metadata_ptr != NULL);
 
 	/* Get the metadata associated with this image. */
@@ -77,15 +73,16 @@ int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
 
 	/* If image is not present in metadata array then skip */
 	if (metadata_ptr->id == RSE_MBOOT_INVALID_ID) {
-		return 0;
+		return NULL;
 	}
 
-	/* Calculate hash */
-	rc = crypto_mod_calc_hash(CRYPTO_MD_ID,
-				  (void *)data_base, data_size, hash_data);
-	if (rc != 0) {
-		return rc;
-	}
+	return metadata_ptr;
+}
+
+static int rse_mboot_extend(const struct rse_mboot_metadata *metadata_ptr,
+			    const uint8_t *hash)
+{
+	psa_status_t ret;
 
 	ret = rse_measured_boot_extend_measurement(
 						metadata_ptr->slot,
@@ -96,7 +93,7 @@ int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
 						PSA_CRYPTO_MD_ID,
 						metadata_ptr->sw_type,
 						metadata_ptr->sw_type_size,
-						hash_data,
+						hash,
 						MBOOT_DIGEST_SIZE,
 						metadata_ptr->lock_measurement);
 	if (ret != PSA_SUCCESS) {
@@ -106,6 +103,47 @@ int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
 	return 0;
 }
 
+int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
+				 uintptr_t data_base, uint32_t data_size,
+				 uint32_t data_id)
+{
+	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
+	int rc;
+
+	metadata_ptr = rse_mboot_find_metadata(metadata_ptr, data_id);
+	if (metadata_ptr == NULL) {
+		return 0;
+	}
+
+	/* Calculate hash */
+	rc = crypto_mod_calc_hash(CRYPTO_MD_ID,
+				  (void *)data_base, data_size, hash_data);
+	if (rc != 0) {
+		return rc;
+	}
+
+	return rse_mboot_extend(metadata_ptr, hash_data);
+}
+
+/*
+ * Record in RSE a measurement computed by the caller, e.g. one of the digests
+ * returned by event_log_measure_banks(), so that a platform which also records
+ * the image in the TCG Event Log only hashes it once. The digest must use
+ * MBOOT_RSE_HASH_ALG.
+ */
+int rse_mboot_record(struct rse_mboot_metadata *metadata_ptr,
+		     const uint8_t *hash, uint32_t data_id)
+{
+	assert(hash != NULL);
+
+	metadata_ptr = rse_mboot_find_metadata(metadata_ptr, data_id);
+	if (metadata_ptr == NULL) {
+		return 0;
+	}
+
+	return rse_mboot_extend(metadata_ptr, hash);
+}
+
 int rse_mboot_set_signer_id(struct rse_mboot_metadata *metadata_ptr,
 			    const void *pk_oid,
 			    const void *pk_ptr,
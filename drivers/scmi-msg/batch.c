@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ */
+#include <cdefs.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <drivers/scmi-msg.h>
+#include <drivers/scmi.h>
+#include <lib/utils.h>
+#include <lib/utils_def.h>
+
+#include "common.h"
+
+#pragma weak plat_scmi_sensor_readings_get
+#pragma weak plat_scmi_clock_get_rates
+
+/*
+ * Entries are queried from the platform by chunks, so that the platform may
+ * batch the hardware accesses without the server holding a buffer for the
+ * largest response.
+ */
+#define BATCH_CHUNK_MAX		16U
+
+static bool message_id_is_supported(unsigned int message_id);
+
+int32_t plat_scmi_sensor_readings_get(unsigned int agent_id,
+				      unsigned int first_id, size_t count,
+				      uint64_t *values, int32_t *status)
+{
+	struct scmi_sensor_val val;
+	size_t n;
+
+	for (n = 0U; n < count; n++) {
+		zeromem(&val, sizeof(val));
+
+		if (plat_scmi_sensor_reading_get(agent_id, first_id + n,
+						 (uint32_t *)&val) != 0) {
+			status[n] = SCMI_HARDWARE_ERROR;
+			values[n] = 0U;
+			continue;
+		}
+
+		status[n] = SCMI_SUCCESS;
+		values[n] = ((uint64_t)val.value_high << 32) | val.value_low;
+	}
+
+	return SCMI_SUCCESS;
+}
+
+int32_t plat_scmi_clock_get_rates(unsigned int agent_id,
+				  unsigned int first_id, size_t count,
+				  unsigned long *rates)
+{
+	size_t n;
+
+	for (n = 0U; n < count; n++) {
+		rates[n] = plat_scmi_clock_get_rate(agent_id, first_id + n);
+	}
+
+	return SCMI_SUCCESS;
+}
+
+static void report_version(struct scmi_msg *msg)
+{
+	struct scmi_protocol_version_p2a return_values = {
+		.status = SCMI_SUCCESS,
+		.version = SCMI_PROTOCOL_VERSION_BATCH,
+	};
+
+	if (msg->in_size != 0U) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void report_attributes(struct scmi_msg *msg)
+{
+	struct scmi_protocol_attributes_p2a return_values = {
+		.status = SCMI_SUCCESS,
+		/* For this protocol, attributes shall be zero */
+		.attributes = 0U,
+	};
+
+	if (msg->in_size != 0U) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void report_message_attributes(struct scmi_msg *msg)
+{
+	struct scmi_protocol_message_attributes_a2p *in_args = (void *)msg->in;
+	struct scmi_protocol_message_attributes_p2a return_values = {
+		.status = SCMI_SUCCESS,
+		/* For this protocol, attributes shall be zero */
+		.attributes = 0U,
+	};
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	if (!message_id_is_supported(in_args->message_id)) {
+		scmi_status_response(msg, SCMI_NOT_FOUND);
+		return;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+/*
+ * Check the range of a batch request against the number of elements, and
+ * return in 'count' the number of entries that fit in the response and in
+ * 'remaining' the number of entries left for later requests.
+ */
+static int32_t batch_range(struct scmi_msg *msg, size_t nb_elts,
+			   size_t entry_size, size_t *count, size_t *remaining)
+{
+	const struct scmi_batch_get_a2p *in_args = (void *)msg->in;
+	size_t first_id, max_nb;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		return SCMI_PROTOCOL_ERROR;
+	}
+
+	first_id = SPECULATION_SAFE_VALUE(in_args->first_id);
+
+	if ((in_args->count == 0U) || (first_id >= nb_elts) ||
+	    (in_args->count > (nb_elts - first_id))) {
+		return SCMI_INVALID_PARAMETERS;
+	}
+
+	max_nb = (msg->out_size - sizeof(struct scmi_batch_get_p2a)) /
+		 entry_size;
+	max_nb = MIN(max_nb, (size_t)SCMI_BATCH_NUM_RETURNED_MASK);
+
+	*count = MIN((size_t)in_args->count, max_nb);
+	*remaining = in_args->count - *count;
+
+	return SCMI_SUCCESS;
+}
+
+static void scmi_batch_sensor_readings_get(struct scmi_msg *msg)
+{
+	const struct scmi_batch_get_a2p *in_args = (void *)msg->in;
+	struct scmi_batch_get_p2a p2a = {
+		.status = SCMI_SUCCESS,
+	};
+	struct scmi_batch_sensor_reading entry;
+	uint64_t values[BATCH_CHUNK_MAX];
+	int32_t status[BATCH_CHUNK_MAX];
+	size_t count = 0U, remaining = 0U;
+	size_t done, chunk, n;
+	char *out = msg->out + sizeof(p2a);
+	int32_t ret;
+
+	ret = batch_range(msg, plat_scmi_sensor_count(msg->agent_id),
+			  sizeof(entry), &count, &remaining);
+	if (ret != SCMI_SUCCESS) {
+		scmi_status_response(msg, ret);
+		return;
+	}
+
+	for (done = 0U; done < count; done += chunk) {
+		chunk = MIN(count - done, (size_t)BATCH_CHUNK_MAX);
+
+		ret = plat_scmi_sensor_readings_get(msg->agent_id,
+						    in_args->first_id + done,
+						    chunk, values, status);
+		if (ret != SCMI_SUCCESS) {
+			scmi_status_response(msg, ret);
+			return;
+		}
+
+		for (n = 0U; n < chunk; n++) {
+			entry.status = status[n];
+			entry.value_low = (uint32_t)values[n];
+			entry.value_high = (uint32_t)(values[n] >> 32);
+
+			memcpy(out, &entry, sizeof(entry));
+			out += sizeof(entry);
+		}
+	}
+
+	p2a.num_entries = SCMI_BATCH_NUM_ENTRIES(count, remaining);
+
+	memcpy(msg->out, &p2a, sizeof(p2a));
+	msg->out_size_out = sizeof(p2a) + count * sizeof(entry);
+}
+
+static void scmi_batch_clock_rates_get(struct scmi_msg *msg)
+{
+	const struct scmi_batch_get_a2p *in_args = (void *)msg->in;
+	struct scmi_batch_get_p2a p2a = {
+		.status = SCMI_SUCCESS,
+	};
+	struct scmi_batch_clock_rate entry;
+	unsigned long rates[BATCH_CHUNK_MAX];
+	size_t count = 0U, remaining = 0U;
+	size_t done, chunk, n;
+	char *out = msg->out + sizeof(p2a);
+	int32_t ret;
+
+	ret = batch_range(msg, plat_scmi_clock_count(msg->agent_id),
+			  sizeof(entry), &count, &remaining);
+	if (ret != SCMI_SUCCESS) {
+		scmi_status_response(msg, ret);
+		return;
+	}
+
+	for (done = 0U; done < count; done += chunk) {
+		chunk = MIN(count - done, (size_t)BATCH_CHUNK_MAX);
+
+		ret = plat_scmi_clock_get_rates(msg->agent_id,
+						in_args->first_id + done,
+						chunk, rates);
+		if (ret != SCMI_SUCCESS) {
+			scmi_status_response(msg, ret);
+			return;
+		}
+
+		for (n = 0U; n < chunk; n++) {
+			entry.rate_low = (uint32_t)rates[n];
+			entry.rate_high = (uint32_t)((uint64_t)rates[n] >> 32);
+
+			memcpy(out, &entry, sizeof(entry));
+			out += sizeof(entry);
+		}
+	}
+
+	p2a.num_entries = SCMI_BATCH_NUM_ENTRIES(count, remaining);
+
+	memcpy(msg->out, &p2a, sizeof(p2a));
+	msg->out_size_out = sizeof(p2a) + count * sizeof(entry);
+}
+
+static const scmi_msg_handler_t scmi_batch_handler_table[] = {
+	[SCMI_PROTOCOL_VERSION] = report_version,
+	[SCMI_PROTOCOL_ATTRIBUTES] = report_attributes,
+	[SCMI_PROTOCOL_MESSAGE_ATTRIBUTES] = report_message_attributes,
+	[SCMI_BATCH_SENSOR_READINGS_GET] = scmi_batch_sensor_readings_get,
+	[SCMI_BATCH_CLOCK_RATES_GET] = scmi_batch_clock_rates_get,
+};
+
+static bool message_id_is_supported(unsigned int message_id)
+{
+	return (message_id < ARRAY_SIZE(scmi_batch_handler_table)) &&
+	       (scmi_batch_handler_table[message_id] != NULL);
+}
+
+scmi_msg_handler_t scmi_msg_get_batch_handler(struct scmi_msg *msg)
+{
+	const size_t array_size = ARRAY_SIZE(scmi_batch_handler_table);
+	unsigned int message_id = SPECULATION_SAFE_VALUE(msg->message_id);
+
+	if (message_id >= array_size) {
+		VERBOSE("batch handle not found %u", msg->message_id);
+		return NULL;
+	}
+
+	return scmi_batch_handler_table[message_id];
+}
@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ */
+
+#ifndef SCMI_MSG_BATCH_H
+#define SCMI_MSG_BATCH_H
+
+#include <stdint.h>
+
+#include <lib/utils_def.h>
+
+#define SCMI_PROTOCOL_VERSION_BATCH	0x10000U
+
+/*
+ * Identifiers of the batched query vendor protocol commands
+ */
+enum scmi_batch_command_id {
+	SCMI_BATCH_SENSOR_READINGS_GET = 0x003,
+	SCMI_BATCH_CLOCK_RATES_GET = 0x004,
+};
+
+/*
+ * Both commands query a range of consecutive sensors or clocks, and return
+ * as many entries as fit in the response, with the number of entries
+ * returned and of entries remaining, as CLOCK_DESCRIBE_RATES does.
+ */
+#define SCMI_BATCH_NUM_RETURNED_MASK		GENMASK(11, 0)
+#define SCMI_BATCH_NUM_REMAINING_MASK		GENMASK(31, 16)
+
+#define SCMI_BATCH_NUM_ENTRIES(_returned, _remaining) \
+	(((_returned) & SCMI_BATCH_NUM_RETURNED_MASK) | \
+	 (((_remaining) << 16) & SCMI_BATCH_NUM_REMAINING_MASK))
+
+struct scmi_batch_get_a2p {
+	uint32_t first_id;
+	uint32_t count;
+};
+
+struct scmi_batch_get_p2a {
+	int32_t status;
+	uint32_t num_entries;
+};
+
+/*
+ * Batch Sensor Readings Get
+ */
+
+struct scmi_batch_sensor_reading {
+	int32_t status;
+	uint32_t value_low;
+	uint32_t value_high;
+};
+
+/*
+ * Batch Clock Rates Get
+ */
+
+struct scmi_batch_clock_rate {
+	uint32_t rate_low;
+	uint32_t rate_high;
+};
+
+#endif /* SCMI_MSG_BATCH_H */
@@ -12,7 +12,9 @@
 #include <string.h>
 
 #include "base.h"
+#include "batch.h"
 #include "clock.h"
+#include "perf.h"
 #include "power_domain.h"
 #include "reset_domain.h"
 #include "sensor.h"
@@ -68,6 +70,7 @@ struct scmi_protocol_message_attributes_p2a {
  * @agent_id: SCMI agent ID, safely set from secure world
  * @protocol_id: SCMI protocol ID for the related message, set by caller agent
  * @message_id: SCMI message ID for the related message, set by caller agent
+ * @token: Token of the message, set by caller agent
  * @in: Address of the incoming message payload copied in secure memory
  * @in_size: Byte length of the incoming message payload, set by caller agent
  * @out: Address of of the output message payload message in non-secure memory
@@ -78,6 +81,7 @@ struct scmi_msg {
 	unsigned int agent_id;
 	unsigned int protocol_id;
 	unsigned int message_id;
+	unsigned int token;
 	char *in;
 	size_t in_size;
 	char *out;
@@ -119,6 +123,13 @@ scmi_msg_handler_t scmi_msg_get_rstd_handler(struct scmi_msg *msg);
  */
 scmi_msg_handler_t scmi_msg_get_pd_handler(struct scmi_msg *msg);
 
+/*
+ * scmi_msg_get_perf_handler - Return a handler for a performance domain message
+ * @msg - message to process
+ * Return a function handler for the message or NULL
+ */
+scmi_msg_handler_t scmi_msg_get_perf_handler(struct scmi_msg *msg);
+
 /*
  * scmi_msg_get_sensor_handler - Return a handler for a sensor message
  * @msg - message to process
@@ -126,6 +137,13 @@ scmi_msg_handler_t scmi_msg_get_pd_handler(struct scmi_msg *msg);
  */
 scmi_msg_handler_t scmi_msg_get_sensor_handler(struct scmi_msg *msg);
 
+/*
+ * scmi_msg_get_batch_handler - Return a handler for a batched query message
+ * @msg - message to process
+ * Return a function handler for the message or NULL
+ */
+scmi_msg_handler_t scmi_msg_get_batch_handler(struct scmi_msg *msg);
+
 /*
  * Process Read, process and write response for input SCMI message
  *
@@ -149,4 +167,21 @@ void scmi_write_response(struct scmi_msg *msg, void *payload, size_t size);
  * @status: SCMI status value returned to caller
  */
 void scmi_status_response(struct scmi_msg *msg, int32_t status);
+
+/*
+ * Queue a delayed response to an asynchronous command, posted to the
+ * server-to-agent channel of the agent as soon as the channel is free
+ *
+ * @agent_id: SCMI agent ID the response is for
+ * @protocol_id: SCMI protocol ID of the command
+ * @message_id: SCMI message ID of the command
+ * @token: Token of the command
+ * @payload: Response payload, starting with the status
+ * @size: Byte size of the response payload
+ * Return 0 on success, -ENODEV if the agent has no server-to-agent channel,
+ * -EINVAL if the payload is too big or -EBUSY if too many responses wait
+ */
+int scmi_smt_delayed_response(unsigned int agent_id, unsigned int protocol_id,
+			      unsigned int message_id, unsigned int token,
+			      const void *payload, size_t size);
 #endif /* SCMI_MSG_COMMON_H */
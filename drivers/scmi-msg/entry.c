@@ -14,8 +14,10 @@
 #pragma weak scmi_msg_get_clock_handler
 #pragma weak scmi_msg_get_rstd_handler
 #pragma weak scmi_msg_get_pd_handler
+#pragma weak scmi_msg_get_perf_handler
 #pragma weak scmi_msg_get_voltage_handler
 #pragma weak scmi_msg_get_sensor_handler
+#pragma weak scmi_msg_get_batch_handler
 
 scmi_msg_handler_t scmi_msg_get_clock_handler(struct scmi_msg *msg __unused)
 {
@@ -32,6 +34,11 @@ scmi_msg_handler_t scmi_msg_get_pd_handler(struct scmi_msg *msg __unused)
 	return NULL;
 }
 
+scmi_msg_handler_t scmi_msg_get_perf_handler(struct scmi_msg *msg __unused)
+{
+	return NULL;
+}
+
 scmi_msg_handler_t scmi_msg_get_voltage_handler(struct scmi_msg *msg __unused)
 {
 	return NULL;
@@ -42,6 +49,11 @@ scmi_msg_handler_t scmi_msg_get_sensor_handler(struct scmi_msg *msg __unused)
 	return NULL;
 }
 
+scmi_msg_handler_t scmi_msg_get_batch_handler(struct scmi_msg *msg __unused)
+{
+	return NULL;
+}
+
 void scmi_status_response(struct scmi_msg *msg, int32_t status)
 {
 	assert(msg->out && msg->out_size >= sizeof(int32_t));
@@ -81,9 +93,15 @@ void scmi_process_message(struct scmi_msg *msg)
 	case SCMI_PROTOCOL_ID_POWER_DOMAIN:
 		handler = scmi_msg_get_pd_handler(msg);
 		break;
+	case SCMI_PROTOCOL_ID_PERF:
+		handler = scmi_msg_get_perf_handler(msg);
+		break;
 	case SCMI_PROTOCOL_ID_SENSOR:
 		handler = scmi_msg_get_sensor_handler(msg);
 		break;
+	case SCMI_PROTOCOL_ID_BATCH:
+		handler = scmi_msg_get_batch_handler(msg);
+		break;
 	default:
 		break;
 	}
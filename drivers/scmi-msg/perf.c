@@ -0,0 +1,767 @@
+// SPDX-License-Identifier: BSD-3-Clause
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ */
+#include <cdefs.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/scmi-msg.h>
+#include <drivers/scmi.h>
+#include <lib/mmio.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <lib/utils_def.h>
+
+#include "common.h"
+
+#pragma weak plat_scmi_perf_count
+#pragma weak plat_scmi_perf_get_name
+#pragma weak plat_scmi_perf_get_levels
+#pragma weak plat_scmi_perf_get_sustained
+#pragma weak plat_scmi_perf_get_level
+#pragma weak plat_scmi_perf_set_level
+#pragma weak plat_scmi_perf_get_limits
+#pragma weak plat_scmi_perf_set_limits
+#pragma weak plat_scmi_perf_get_fastchannel
+
+/* Offsets of the fastchannels in struct scmi_perf_fc_shm */
+#define FC_LEVEL_SET		offsetof(struct scmi_perf_fc_shm, level_set)
+#define FC_LEVEL_GET		offsetof(struct scmi_perf_fc_shm, level_get)
+#define FC_LIMITS_SET		offsetof(struct scmi_perf_fc_shm, limits_set)
+#define FC_LIMITS_GET		offsetof(struct scmi_perf_fc_shm, limits_get)
+
+/*
+ * Level and limits changes are serialised, whether they come from messages
+ * or from fastchannels, so that the get fastchannels always reflect the last
+ * change. The lock also protects the latency counters, indexed by whether
+ * the change came from a fastchannel.
+ */
+static spinlock_t perf_lock;
+static struct scmi_perf_latency perf_latency[2];
+
+static bool message_id_is_supported(unsigned int message_id);
+
+size_t plat_scmi_perf_count(unsigned int agent_id __unused)
+{
+	return 0U;
+}
+
+const char *plat_scmi_perf_get_name(unsigned int agent_id __unused,
+				    unsigned int scmi_id __unused)
+{
+	return NULL;
+}
+
+int32_t plat_scmi_perf_get_levels(unsigned int agent_id __unused,
+				  unsigned int scmi_id __unused,
+				  const struct scmi_perf_level **levels __unused,
+				  size_t *nb_levels __unused)
+{
+	return SCMI_NOT_SUPPORTED;
+}
+
+int32_t plat_scmi_perf_get_sustained(unsigned int agent_id,
+				     unsigned int scmi_id, uint32_t *level,
+				     uint32_t *freq_khz)
+{
+	const struct scmi_perf_level *levels = NULL;
+	size_t nb_levels = 0U;
+	int32_t status;
+
+	status = plat_scmi_perf_get_levels(agent_id, scmi_id, &levels,
+					   &nb_levels);
+	if (status != SCMI_SUCCESS) {
+		return status;
+	}
+
+	if (nb_levels == 0U) {
+		return SCMI_GENERIC_ERROR;
+	}
+
+	*level = levels[nb_levels - 1U].level;
+	*freq_khz = levels[nb_levels - 1U].level;
+
+	return SCMI_SUCCESS;
+}
+
+uint32_t plat_scmi_perf_get_level(unsigned int agent_id __unused,
+				  unsigned int scmi_id __unused)
+{
+	return 0U;
+}
+
+int32_t plat_scmi_perf_set_level(unsigned int agent_id __unused,
+				 unsigned int scmi_id __unused,
+				 uint32_t level __unused)
+{
+	return SCMI_NOT_SUPPORTED;
+}
+
+int32_t plat_scmi_perf_get_limits(unsigned int agent_id, unsigned int scmi_id,
+				  uint32_t *range_max, uint32_t *range_min)
+{
+	const struct scmi_perf_level *levels = NULL;
+	size_t nb_levels = 0U;
+	int32_t status;
+
+	status = plat_scmi_perf_get_levels(agent_id, scmi_id, &levels,
+					   &nb_levels);
+	if (status != SCMI_SUCCESS) {
+		return status;
+	}
+
+	if (nb_levels == 0U) {
+		return SCMI_GENERIC_ERROR;
+	}
+
+	*range_max = levels[nb_levels - 1U].level;
+	*range_min = levels[0].level;
+
+	return SCMI_SUCCESS;
+}
+
+int32_t plat_scmi_perf_set_limits(unsigned int agent_id __unused,
+				  unsigned int scmi_id __unused,
+				  uint32_t range_max __unused,
+				  uint32_t range_min __unused)
+{
+	return SCMI_NOT_SUPPORTED;
+}
+
+struct scmi_perf_fastchannel *plat_scmi_perf_get_fastchannel(
+						unsigned int agent_id __unused,
+						unsigned int scmi_id __unused)
+{
+	return NULL;
+}
+
+static struct scmi_perf_fastchannel *get_fastchannel(unsigned int agent_id,
+						     unsigned int domain_id)
+{
+	struct scmi_perf_fastchannel *fc;
+
+	fc = plat_scmi_perf_get_fastchannel(agent_id, domain_id);
+	if ((fc == NULL) || (fc->shm_addr == 0U)) {
+		return NULL;
+	}
+
+	return fc;
+}
+
+static bool agent_has_fastchannels(unsigned int agent_id)
+{
+	size_t count = plat_scmi_perf_count(agent_id);
+	unsigned int domain_id;
+
+	for (domain_id = 0U; domain_id < count; domain_id++) {
+		if (get_fastchannel(agent_id, domain_id) != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool level_is_supported(unsigned int agent_id, unsigned int domain_id,
+			       uint32_t level)
+{
+	const struct scmi_perf_level *levels = NULL;
+	size_t nb_levels = 0U;
+	size_t n;
+
+	if (plat_scmi_perf_get_levels(agent_id, domain_id, &levels,
+				      &nb_levels) != SCMI_SUCCESS) {
+		return false;
+	}
+
+	for (n = 0U; n < nb_levels; n++) {
+		if (levels[n].level == level) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Publish the current level and limits in the get fastchannels */
+static void update_fastchannel(unsigned int agent_id, unsigned int domain_id)
+{
+	struct scmi_perf_fastchannel *fc = get_fastchannel(agent_id, domain_id);
+	uint32_t range_max = 0U;
+	uint32_t range_min = 0U;
+
+	if (fc == NULL) {
+		return;
+	}
+
+	mmio_write_32(fc->shm_addr + FC_LEVEL_GET,
+		      plat_scmi_perf_get_level(agent_id, domain_id));
+
+	if (plat_scmi_perf_get_limits(agent_id, domain_id, &range_max,
+				      &range_min) == SCMI_SUCCESS) {
+		mmio_write_32(fc->shm_addr + FC_LIMITS_GET, range_max);
+		mmio_write_32(fc->shm_addr + FC_LIMITS_GET + 4U, range_min);
+	}
+}
+
+/* Called with perf_lock held */
+static void account_latency(bool fastchannel, uint64_t start)
+{
+	struct scmi_perf_latency *latency = &perf_latency[fastchannel ? 1 : 0];
+	uint64_t ticks = read_cntpct_el0() - start;
+
+	latency->count++;
+	latency->total += ticks;
+	if (ticks > latency->max) {
+		latency->max = ticks;
+	}
+}
+
+/* Called with perf_lock held */
+static int32_t perf_set_level(unsigned int agent_id, unsigned int domain_id,
+			      uint32_t level, bool fastchannel, uint64_t start)
+{
+	uint32_t range_max = 0U;
+	uint32_t range_min = 0U;
+	int32_t status;
+
+	if (!level_is_supported(agent_id, domain_id, level)) {
+		return SCMI_OUT_OF_RANGE;
+	}
+
+	status = plat_scmi_perf_get_limits(agent_id, domain_id, &range_max,
+					   &range_min);
+	if (status != SCMI_SUCCESS) {
+		return status;
+	}
+
+	if ((level > range_max) || (level < range_min)) {
+		return SCMI_OUT_OF_RANGE;
+	}
+
+	status = plat_scmi_perf_set_level(agent_id, domain_id, level);
+	if (status == SCMI_SUCCESS) {
+		account_latency(fastchannel, start);
+		update_fastchannel(agent_id, domain_id);
+	}
+
+	return status;
+}
+
+/* Called with perf_lock held */
+static int32_t perf_set_limits(unsigned int agent_id, unsigned int domain_id,
+			       uint32_t range_max, uint32_t range_min)
+{
+	int32_t status;
+
+	if (range_min > range_max) {
+		return SCMI_INVALID_PARAMETERS;
+	}
+
+	status = plat_scmi_perf_set_limits(agent_id, domain_id, range_max,
+					   range_min);
+	if (status == SCMI_SUCCESS) {
+		update_fastchannel(agent_id, domain_id);
+	}
+
+	return status;
+}
+
+void scmi_perf_fastchannel_init(unsigned int agent_id)
+{
+	size_t count = plat_scmi_perf_count(agent_id);
+	struct scmi_perf_fastchannel *fc;
+	uint32_t range_max = 0U;
+	uint32_t range_min = 0U;
+	unsigned int domain_id;
+
+	spin_lock(&perf_lock);
+
+	for (domain_id = 0U; domain_id < count; domain_id++) {
+		fc = get_fastchannel(agent_id, domain_id);
+		if (fc == NULL) {
+			continue;
+		}
+
+		/* The set fastchannels start with no pending request */
+		fc->level_seen = plat_scmi_perf_get_level(agent_id, domain_id);
+		(void)plat_scmi_perf_get_limits(agent_id, domain_id,
+						&range_max, &range_min);
+		fc->limits_seen[0] = range_max;
+		fc->limits_seen[1] = range_min;
+
+		mmio_write_32(fc->shm_addr + FC_LEVEL_SET, fc->level_seen);
+		mmio_write_32(fc->shm_addr + FC_LIMITS_SET, range_max);
+		mmio_write_32(fc->shm_addr + FC_LIMITS_SET + 4U, range_min);
+
+		update_fastchannel(agent_id, domain_id);
+	}
+
+	spin_unlock(&perf_lock);
+}
+
+/*
+ * Fastchannel requests have no response: a request the platform rejects is
+ * dropped, and the agent finds the level it got in the get fastchannels.
+ * Limits are handled before the level, so that an agent may widen the limits
+ * and move to a level beyond the former ones with a single doorbell.
+ */
+void scmi_perf_fastchannel_entry(unsigned int agent_id)
+{
+	uint64_t start = read_cntpct_el0();
+	size_t count = plat_scmi_perf_count(agent_id);
+	struct scmi_perf_fastchannel *fc;
+	uint32_t range_max, range_min, level;
+	unsigned int domain_id;
+	int32_t status;
+
+	spin_lock(&perf_lock);
+
+	for (domain_id = 0U; domain_id < count; domain_id++) {
+		fc = get_fastchannel(agent_id, domain_id);
+		if (fc == NULL) {
+			continue;
+		}
+
+		range_max = mmio_read_32(fc->shm_addr + FC_LIMITS_SET);
+		range_min = mmio_read_32(fc->shm_addr + FC_LIMITS_SET + 4U);
+		if ((range_max != fc->limits_seen[0]) ||
+		    (range_min != fc->limits_seen[1])) {
+			fc->limits_seen[0] = range_max;
+			fc->limits_seen[1] = range_min;
+
+			status = perf_set_limits(agent_id, domain_id,
+						 range_max, range_min);
+			if (status != SCMI_SUCCESS) {
+				VERBOSE("Agent %u perf %u: limits %u-%u: %d\n",
+					agent_id, domain_id, range_min,
+					range_max, status);
+			}
+		}
+
+		level = mmio_read_32(fc->shm_addr + FC_LEVEL_SET);
+		if (level != fc->level_seen) {
+			fc->level_seen = level;
+
+			status = perf_set_level(agent_id, domain_id, level,
+						true, start);
+			if (status != SCMI_SUCCESS) {
+				VERBOSE("Agent %u perf %u: level %u: %d\n",
+					agent_id, domain_id, level, status);
+			}
+		}
+	}
+
+	spin_unlock(&perf_lock);
+}
+
+void scmi_perf_get_latency(bool fastchannel, struct scmi_perf_latency *latency,
+			   bool clear)
+{
+	struct scmi_perf_latency *counters = &perf_latency[fastchannel ? 1 : 0];
+
+	assert(latency != NULL);
+
+	spin_lock(&perf_lock);
+
+	*latency = *counters;
+	if (clear) {
+		zeromem(counters, sizeof(*counters));
+	}
+
+	spin_unlock(&perf_lock);
+}
+
+static void report_version(struct scmi_msg *msg)
+{
+	struct scmi_protocol_version_p2a return_values = {
+		.status = SCMI_SUCCESS,
+		.version = SCMI_PROTOCOL_VERSION_PERF,
+	};
+
+	if (msg->in_size != 0) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void report_attributes(struct scmi_msg *msg)
+{
+	struct scmi_protocol_attributes_p2a_perf return_values = {
+		.status = SCMI_SUCCESS,
+	};
+
+	if (msg->in_size != 0) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	/* Power costs are abstract and there is no statistics area */
+	return_values.attributes = plat_scmi_perf_count(msg->agent_id) &
+				   SCMI_PERF_DOMAIN_COUNT_MASK;
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void report_message_attributes(struct scmi_msg *msg)
+{
+	struct scmi_protocol_message_attributes_a2p *in_args = (void *)msg->in;
+	struct scmi_protocol_message_attributes_p2a return_values = {
+		.status = SCMI_SUCCESS,
+		.attributes = 0U,
+	};
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	if (!message_id_is_supported(in_args->message_id)) {
+		scmi_status_response(msg, SCMI_NOT_FOUND);
+		return;
+	}
+
+	switch (in_args->message_id) {
+	case SCMI_PERF_LIMITS_SET:
+	case SCMI_PERF_LIMITS_GET:
+	case SCMI_PERF_LEVEL_SET:
+	case SCMI_PERF_LEVEL_GET:
+		if (agent_has_fastchannels(msg->agent_id)) {
+			return_values.attributes = SCMI_PERF_MESSAGE_FASTCHANNEL;
+		}
+		break;
+	default:
+		break;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void scmi_perf_domain_attributes(struct scmi_msg *msg)
+{
+	const struct scmi_perf_attributes_a2p *in_args = (void *)msg->in;
+	struct scmi_perf_attributes_p2a return_values = {
+		.status = SCMI_SUCCESS,
+		.attributes = SCMI_PERF_SET_LIMITS | SCMI_PERF_SET_LEVEL,
+	};
+	const char *name = NULL;
+	unsigned int domain_id = 0U;
+	int32_t status;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	name = plat_scmi_perf_get_name(msg->agent_id, domain_id);
+	if (name == NULL) {
+		scmi_status_response(msg, SCMI_NOT_FOUND);
+		return;
+	}
+
+	status = plat_scmi_perf_get_sustained(msg->agent_id, domain_id,
+					      &return_values.sustained_perf_level,
+					      &return_values.sustained_freq);
+	if (status != SCMI_SUCCESS) {
+		scmi_status_response(msg, status);
+		return;
+	}
+
+	if (get_fastchannel(msg->agent_id, domain_id) != NULL) {
+		return_values.attributes |= SCMI_PERF_FASTCHANNEL;
+	}
+
+	COPY_NAME_IDENTIFIER(return_values.name, name);
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+#define LEVELS_ARRAY_SIZE_MAX	(SCMI_PLAYLOAD_MAX - \
+				 sizeof(struct scmi_perf_describe_levels_p2a))
+
+static void scmi_perf_describe_levels(struct scmi_msg *msg)
+{
+	const struct scmi_perf_describe_levels_a2p *in_args = (void *)msg->in;
+	struct scmi_perf_describe_levels_p2a p2a = {
+		.status = SCMI_SUCCESS,
+	};
+	struct scmi_perf_level_desc desc = { 0 };
+	const struct scmi_perf_level *levels = NULL;
+	size_t nb_levels = 0U;
+	size_t max_nb, ret_nb, n;
+	unsigned int domain_id = 0U;
+	unsigned int level_index = 0U;
+	int32_t status;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	status = plat_scmi_perf_get_levels(msg->agent_id, domain_id, &levels,
+					   &nb_levels);
+	if (status != SCMI_SUCCESS) {
+		scmi_status_response(msg, status);
+		return;
+	}
+
+	level_index = SPECULATION_SAFE_VALUE(in_args->level_index);
+
+	if (level_index >= nb_levels) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	max_nb = MIN(msg->out_size - sizeof(p2a), LEVELS_ARRAY_SIZE_MAX) /
+		 sizeof(desc);
+	ret_nb = MIN(nb_levels - level_index, max_nb);
+
+	for (n = 0U; n < ret_nb; n++) {
+		desc.perf_level = levels[level_index + n].level;
+		desc.power_cost = levels[level_index + n].power_cost;
+		desc.attributes = levels[level_index + n].latency_us &
+				  SCMI_PERF_LEVEL_LATENCY_MASK;
+
+		memcpy(msg->out + sizeof(p2a) + n * sizeof(desc), &desc,
+		       sizeof(desc));
+	}
+
+	p2a.num_levels = SCMI_PERF_NUM_LEVELS(ret_nb,
+					      nb_levels - level_index - ret_nb);
+
+	memcpy(msg->out, &p2a, sizeof(p2a));
+	msg->out_size_out = sizeof(p2a) + ret_nb * sizeof(desc);
+}
+
+static void scmi_perf_limits_set(struct scmi_msg *msg)
+{
+	const struct scmi_perf_limits_set_a2p *in_args = (void *)msg->in;
+	unsigned int domain_id = 0U;
+	int32_t status;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	spin_lock(&perf_lock);
+	status = perf_set_limits(msg->agent_id, domain_id, in_args->range_max,
+				 in_args->range_min);
+	spin_unlock(&perf_lock);
+
+	scmi_status_response(msg, status);
+}
+
+static void scmi_perf_limits_get(struct scmi_msg *msg)
+{
+	const struct scmi_perf_limits_get_a2p *in_args = (void *)msg->in;
+	struct scmi_perf_limits_get_p2a return_values = {
+		.status = SCMI_SUCCESS,
+	};
+	unsigned int domain_id = 0U;
+	int32_t status;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	status = plat_scmi_perf_get_limits(msg->agent_id, domain_id,
+					   &return_values.range_max,
+					   &return_values.range_min);
+	if (status != SCMI_SUCCESS) {
+		scmi_status_response(msg, status);
+		return;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void scmi_perf_level_set(struct scmi_msg *msg)
+{
+	const struct scmi_perf_level_set_a2p *in_args = (void *)msg->in;
+	uint64_t start = read_cntpct_el0();
+	unsigned int domain_id = 0U;
+	int32_t status;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	spin_lock(&perf_lock);
+	status = perf_set_level(msg->agent_id, domain_id, in_args->perf_level,
+				false, start);
+	spin_unlock(&perf_lock);
+
+	scmi_status_response(msg, status);
+}
+
+static void scmi_perf_level_get(struct scmi_msg *msg)
+{
+	const struct scmi_perf_level_get_a2p *in_args = (void *)msg->in;
+	struct scmi_perf_level_get_p2a return_values = {
+		.status = SCMI_SUCCESS,
+	};
+	unsigned int domain_id = 0U;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	return_values.perf_level = plat_scmi_perf_get_level(msg->agent_id,
+							    domain_id);
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static void scmi_perf_describe_fastchannel(struct scmi_msg *msg)
+{
+	const struct scmi_perf_describe_fc_a2p *in_args = (void *)msg->in;
+	struct scmi_perf_describe_fc_p2a return_values = {
+		.status = SCMI_SUCCESS,
+	};
+	const struct scmi_perf_fastchannel *fc = NULL;
+	unsigned int domain_id = 0U;
+	uintptr_t chan_addr = 0U;
+	bool doorbell = false;
+
+	if (msg->in_size != sizeof(*in_args)) {
+		scmi_status_response(msg, SCMI_PROTOCOL_ERROR);
+		return;
+	}
+
+	domain_id = SPECULATION_SAFE_VALUE(in_args->domain_id);
+
+	if (domain_id >= plat_scmi_perf_count(msg->agent_id)) {
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	fc = get_fastchannel(msg->agent_id, domain_id);
+	if (fc == NULL) {
+		scmi_status_response(msg, SCMI_NOT_SUPPORTED);
+		return;
+	}
+
+	switch (in_args->message_id) {
+	case SCMI_PERF_LIMITS_SET:
+		chan_addr = fc->shm_addr + FC_LIMITS_SET;
+		return_values.chan_size = 2U * sizeof(uint32_t);
+		doorbell = true;
+		break;
+	case SCMI_PERF_LIMITS_GET:
+		chan_addr = fc->shm_addr + FC_LIMITS_GET;
+		return_values.chan_size = 2U * sizeof(uint32_t);
+		break;
+	case SCMI_PERF_LEVEL_SET:
+		chan_addr = fc->shm_addr + FC_LEVEL_SET;
+		return_values.chan_size = sizeof(uint32_t);
+		doorbell = true;
+		break;
+	case SCMI_PERF_LEVEL_GET:
+		chan_addr = fc->shm_addr + FC_LEVEL_GET;
+		return_values.chan_size = sizeof(uint32_t);
+		break;
+	default:
+		scmi_status_response(msg, SCMI_INVALID_PARAMETERS);
+		return;
+	}
+
+	return_values.chan_addr_low = (uint32_t)chan_addr;
+	return_values.chan_addr_high = (uint32_t)((uint64_t)chan_addr >> 32);
+	return_values.rate_limit = fc->rate_limit_us & SCMI_PERF_RATE_LIMIT_MASK;
+
+	if (doorbell && (fc->doorbell_addr != 0U)) {
+		return_values.attributes = SCMI_PERF_FC_DOORBELL |
+					   SCMI_PERF_FC_DOORBELL_WIDTH_32;
+		return_values.doorbell_addr_low = (uint32_t)fc->doorbell_addr;
+		return_values.doorbell_addr_high =
+			(uint32_t)((uint64_t)fc->doorbell_addr >> 32);
+		return_values.doorbell_set_mask_low = fc->doorbell_set_mask;
+		return_values.doorbell_preserve_mask_low =
+			fc->doorbell_preserve_mask;
+	}
+
+	scmi_write_response(msg, &return_values, sizeof(return_values));
+}
+
+static const scmi_msg_handler_t scmi_perf_handler_table[] = {
+	[SCMI_PROTOCOL_VERSION] = report_version,
+	[SCMI_PROTOCOL_ATTRIBUTES] = report_attributes,
+	[SCMI_PROTOCOL_MESSAGE_ATTRIBUTES] = report_message_attributes,
+	[SCMI_PERF_DOMAIN_ATTRIBUTES] = scmi_perf_domain_attributes,
+	[SCMI_PERF_DESCRIBE_LEVELS] = scmi_perf_describe_levels,
+	[SCMI_PERF_LIMITS_SET] = scmi_perf_limits_set,
+	[SCMI_PERF_LIMITS_GET] = scmi_perf_limits_get,
+	[SCMI_PERF_LEVEL_SET] = scmi_perf_level_set,
+	[SCMI_PERF_LEVEL_GET] = scmi_perf_level_get,
+	[SCMI_PERF_DESCRIBE_FASTCHANNEL] = scmi_perf_describe_fastchannel,
+};
+
+static bool message_id_is_supported(unsigned int message_id)
+{
+	return (message_id < ARRAY_SIZE(scmi_perf_handler_table)) &&
+	       (scmi_perf_handler_table[message_id] != NULL);
+}
+
+scmi_msg_handler_t scmi_msg_get_perf_handler(struct scmi_msg *msg)
+{
+	const size_t array_size = ARRAY_SIZE(scmi_perf_handler_table);
+	unsigned int message_id = SPECULATION_SAFE_VALUE(msg->message_id);
+
+	if (message_id >= array_size) {
+		VERBOSE("perf handle not found %u", msg->message_id);
+		return NULL;
+	}
+
+	return scmi_perf_handler_table[message_id];
+}
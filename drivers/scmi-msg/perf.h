@@ -0,0 +1,172 @@
+/* SPDX-License-Identifier: BSD-3-Clause */
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ */
+
+#ifndef SCMI_MSG_PERF_H
+#define SCMI_MSG_PERF_H
+
+#include <stdint.h>
+
+#include <lib/utils_def.h>
+
+#define SCMI_PROTOCOL_VERSION_PERF	0x20000U
+
+/*
+ * Identifiers of the SCMI Performance Domain Management Protocol commands
+ */
+enum scmi_perf_command_id {
+	SCMI_PERF_DOMAIN_ATTRIBUTES = 0x003,
+	SCMI_PERF_DESCRIBE_LEVELS = 0x004,
+	SCMI_PERF_LIMITS_SET = 0x005,
+	SCMI_PERF_LIMITS_GET = 0x006,
+	SCMI_PERF_LEVEL_SET = 0x007,
+	SCMI_PERF_LEVEL_GET = 0x008,
+	SCMI_PERF_NOTIFY_LIMITS = 0x009,
+	SCMI_PERF_NOTIFY_LEVEL = 0x00A,
+	SCMI_PERF_DESCRIBE_FASTCHANNEL = 0x00B,
+};
+
+/* Protocol attributes */
+#define SCMI_PERF_DOMAIN_COUNT_MASK		GENMASK(15, 0)
+
+struct scmi_protocol_attributes_p2a_perf {
+	int32_t status;
+	uint32_t attributes;
+	uint32_t statistics_addr_low;
+	uint32_t statistics_addr_high;
+	uint32_t statistics_len;
+};
+
+/* Message attributes */
+#define SCMI_PERF_MESSAGE_FASTCHANNEL		BIT(0)
+
+/*
+ * Performance Domain Attributes
+ */
+
+#define SCMI_PERF_SET_LIMITS			BIT(31)
+#define SCMI_PERF_SET_LEVEL			BIT(30)
+#define SCMI_PERF_FASTCHANNEL			BIT(27)
+
+#define SCMI_PERF_RATE_LIMIT_MASK		GENMASK(19, 0)
+
+#define SCMI_PERF_NAME_LENGTH_MAX		16U
+
+struct scmi_perf_attributes_a2p {
+	uint32_t domain_id;
+};
+
+struct scmi_perf_attributes_p2a {
+	int32_t status;
+	uint32_t attributes;
+	uint32_t rate_limit;
+	uint32_t sustained_freq;
+	uint32_t sustained_perf_level;
+	char name[SCMI_PERF_NAME_LENGTH_MAX];
+};
+
+/*
+ * Performance Describe Levels
+ */
+
+#define SCMI_PERF_NUM_LEVELS_MASK		GENMASK(11, 0)
+#define SCMI_PERF_REMAINING_LEVELS_MASK		GENMASK(31, 16)
+
+#define SCMI_PERF_NUM_LEVELS(_nb_levels, _rem_levels) \
+	(((_nb_levels) & SCMI_PERF_NUM_LEVELS_MASK) | \
+	 (((_rem_levels) << 16) & SCMI_PERF_REMAINING_LEVELS_MASK))
+
+#define SCMI_PERF_LEVEL_LATENCY_MASK		GENMASK(15, 0)
+
+struct scmi_perf_describe_levels_a2p {
+	uint32_t domain_id;
+	uint32_t level_index;
+};
+
+struct scmi_perf_level_desc {
+	uint32_t perf_level;
+	uint32_t power_cost;
+	uint32_t attributes;
+};
+
+struct scmi_perf_describe_levels_p2a {
+	int32_t status;
+	uint32_t num_levels;
+	struct scmi_perf_level_desc levels[];
+};
+
+/*
+ * Performance Limits Set
+ */
+
+struct scmi_perf_limits_set_a2p {
+	uint32_t domain_id;
+	uint32_t range_max;
+	uint32_t range_min;
+};
+
+/*
+ * Performance Limits Get
+ */
+
+struct scmi_perf_limits_get_a2p {
+	uint32_t domain_id;
+};
+
+struct scmi_perf_limits_get_p2a {
+	int32_t status;
+	uint32_t range_max;
+	uint32_t range_min;
+};
+
+/*
+ * Performance Level Set
+ */
+
+struct scmi_perf_level_set_a2p {
+	uint32_t domain_id;
+	uint32_t perf_level;
+};
+
+/*
+ * Performance Level Get
+ */
+
+struct scmi_perf_level_get_a2p {
+	uint32_t domain_id;
+};
+
+struct scmi_perf_level_get_p2a {
+	int32_t status;
+	uint32_t perf_level;
+};
+
+/*
+ * Performance Describe Fastchannel
+ */
+
+#define SCMI_PERF_FC_DOORBELL			BIT(0)
+#define SCMI_PERF_FC_DOORBELL_WIDTH_32		(2U << 1)
+
+struct scmi_perf_describe_fc_a2p {
+	uint32_t domain_id;
+	uint32_t message_id;
+};
+
+struct scmi_perf_describe_fc_p2a {
+	int32_t status;
+	uint32_t attributes;
+	uint32_t rate_limit;
+	uint32_t chan_addr_low;
+	uint32_t chan_addr_high;
+	uint32_t chan_size;
+	uint32_t doorbell_addr_low;
+	uint32_t doorbell_addr_high;
+	uint32_t doorbell_set_mask_low;
+	uint32_t doorbell_set_mask_high;
+	uint32_t doorbell_preserve_mask_low;
+	uint32_t doorbell_preserve_mask_high;
+};
+
+#endif /* SCMI_MSG_PERF_H */
@@ -12,6 +12,8 @@
 #include <drivers/scmi.h>
 #include <lib/utils_def.h>
 
+#pragma weak plat_scmi_sensor_reading_start
+
 static bool message_id_is_supported(size_t message_id);
 
 uint16_t plat_scmi_sensor_count(unsigned int agent_id __unused)
@@ -94,6 +96,32 @@ uint32_t plat_scmi_sensor_timestamped(uint32_t agent_id __unused,
 	return 0U;
 }
 
+int32_t plat_scmi_sensor_reading_start(unsigned int agent_id __unused,
+				       unsigned int sensor_id __unused,
+				       unsigned int token __unused)
+{
+	return SCMI_NOT_SUPPORTED;
+}
+
+void scmi_sensor_reading_complete(unsigned int agent_id,
+				  unsigned int sensor_id, unsigned int token,
+				  int32_t status, uint64_t value)
+{
+	struct scmi_sensor_reading_complete_p2a resp = {
+		.status = status,
+		.sensor_id = sensor_id,
+		.value_low = (uint32_t)value,
+		.value_high = (uint32_t)(value >> 32),
+	};
+
+	if (scmi_smt_delayed_response(agent_id, SCMI_PROTOCOL_ID_SENSOR,
+				      SCMI_SENSOR_READING_GET, token, &resp,
+				      sizeof(resp)) != 0) {
+		WARN("SCMI agent %u: sensor %u reading dropped\n", agent_id,
+		     sensor_id);
+	}
+}
+
 static void report_version(struct scmi_msg *msg)
 {
 	struct scmi_protocol_version_p2a return_values = {
@@ -233,6 +261,15 @@ static void scmi_sensor_reading_get(struct scmi_msg *msg)
 		return;
 	}
 
+	/* The reading is sent later as a delayed response */
+	if ((in_args->flags & SCMI_SENSOR_READING_ASYNC) != 0U) {
+		scmi_status_response(msg,
+				     plat_scmi_sensor_reading_start(msg->agent_id,
+								    sensor_id,
+								    msg->token));
+		return;
+	}
+
 	ret = plat_scmi_sensor_reading_get(msg->agent_id, sensor_id,
 					  (uint32_t *)&return_values.val);
 	if (ret) {
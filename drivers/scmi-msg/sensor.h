@@ -80,6 +80,8 @@ struct scmi_sensor_reading_get_a2p {
 	uint32_t flags;
 };
 
+#define SCMI_SENSOR_READING_ASYNC	BIT(0)
+
 struct scmi_sensor_val {
 	uint32_t value_low;
 	uint32_t value_high;
@@ -92,6 +94,14 @@ struct scmi_sensor_reading_get_p2a {
 	struct scmi_sensor_val val;
 };
 
+/* Sensor Reading Get delayed response, for asynchronous readings */
+struct scmi_sensor_reading_complete_p2a {
+	int32_t status;
+	uint32_t sensor_id;
+	uint32_t value_low;
+	uint32_t value_high;
+};
+
 typedef struct {
 	uint16_t (*sensor_count)(unsigned int agent_id);
 	uint8_t (*sensor_max_request)(unsigned int agent_id);
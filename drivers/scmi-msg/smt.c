@@ -4,6 +4,7 @@
  * Copyright (c) 2019-2020, Linaro Limited
  */
 #include <assert.h>
+#include <errno.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
@@ -61,6 +62,38 @@ CASSERT(SCMI_PLAYLOAD_MAX + sizeof(struct smt_header) <= SMT_BUF_SLOT_SIZE,
 #define SMT_MSG_PROT_ID_MASK		GENMASK_32(17, 10)
 #define SMT_HDR_PROT_ID(_hdr)		(((_hdr) & SMT_MSG_PROT_ID_MASK) >> 10)
 
+#define SMT_MSG_TOKEN_MASK		GENMASK_32(27, 18)
+#define SMT_HDR_TOKEN(_hdr)		(((_hdr) & SMT_MSG_TOKEN_MASK) >> 18)
+
+/* Message type of delayed responses */
+#define SMT_MSG_TYPE_DELAYED_RESP	2U
+
+#define SMT_MSG_HEADER(_prot_id, _msg_id, _type, _token)		\
+	((((_prot_id) << 10) & SMT_MSG_PROT_ID_MASK) |			\
+	 (((_type) << 8) & SMT_MSG_TYPE_MASK) |				\
+	 ((_msg_id) & SMT_MSG_ID_MASK) |				\
+	 (((_token) << 18) & SMT_MSG_TOKEN_MASK))
+
+/*
+ * Delayed responses wait in secure memory until the server-to-agent channel
+ * of their agent is free.
+ */
+#ifndef PLAT_SCMI_DELAYED_RESP_MAX
+#define PLAT_SCMI_DELAYED_RESP_MAX	8U
+#endif
+
+struct smt_delayed_resp {
+	bool pending;
+	unsigned int seq;
+	unsigned int agent_id;
+	uint32_t message_header;
+	size_t size;
+	uint32_t payload[SCMI_PLAYLOAD_U32_MAX];
+};
+
+static struct smt_delayed_resp delayed_resp[PLAT_SCMI_DELAYED_RESP_MAX];
+static unsigned int delayed_resp_seq;
+
 /*
  * Provision input message payload buffers for fastcall SMC context entries
  * and for interrupt context execution entries.
@@ -68,35 +101,50 @@ CASSERT(SCMI_PLAYLOAD_MAX + sizeof(struct smt_header) <= SMT_BUF_SLOT_SIZE,
 static uint32_t fast_smc_payload[PLATFORM_CORE_COUNT][SCMI_PLAYLOAD_U32_MAX];
 static uint32_t interrupt_payload[PLATFORM_CORE_COUNT][SCMI_PLAYLOAD_U32_MAX];
 
-/* SMP protection on channel access */
+/* SMP protection on channel access and on the delayed responses */
 static struct spinlock smt_channels_lock;
 
-/* If channel is not busy, set busy and return true, otherwise return false */
-static bool channel_set_busy(struct scmi_msg_channel *chan)
+#pragma weak plat_scmi_notify_agent
+
+void plat_scmi_notify_agent(unsigned int agent_id __unused)
+{
+}
+
+static unsigned int channel_slot_count(struct scmi_msg_channel *chan)
+{
+	return (chan->slot_count == 0U) ? 1U : chan->slot_count;
+}
+
+/* If slot is not busy, set busy and return true, otherwise return false */
+static bool channel_set_busy(struct scmi_msg_channel *chan, unsigned int slot)
 {
-	bool channel_is_busy;
+	bool slot_is_busy;
 
 	spin_lock(&smt_channels_lock);
 
-	channel_is_busy = chan->busy;
+	slot_is_busy = (chan->busy_slots & BIT_32(slot)) != 0U;
 
-	if (!channel_is_busy) {
-		chan->busy = true;
+	if (!slot_is_busy) {
+		chan->busy_slots |= BIT_32(slot);
 	}
 
 	spin_unlock(&smt_channels_lock);
 
-	return !channel_is_busy;
+	return !slot_is_busy;
 }
 
-static void channel_release_busy(struct scmi_msg_channel *chan)
+static void channel_release_busy(struct scmi_msg_channel *chan,
+				 unsigned int slot)
 {
-	chan->busy = false;
+	spin_lock(&smt_channels_lock);
+	chan->busy_slots &= ~BIT_32(slot);
+	spin_unlock(&smt_channels_lock);
 }
 
-static struct smt_header *channel_to_smt_hdr(struct scmi_msg_channel *chan)
+static struct smt_header *channel_to_smt_hdr(struct scmi_msg_channel *chan,
+					     unsigned int slot)
 {
-	return (struct smt_header *)chan->shm_addr;
+	return (struct smt_header *)(chan->shm_addr + slot * chan->shm_size);
 }
 
 /*
@@ -104,31 +152,50 @@ static struct smt_header *channel_to_smt_hdr(struct scmi_msg_channel *chan)
  * message drivers. Message structure contains SCMI protocol meta-data and
  * references to input payload in secure memory and output message buffer
  * in shared memory.
+ *
+ * Channels with a single slot keep the legacy behaviour: a message found
+ * busy or free is answered with an error. On channels with several slots,
+ * such slots are skipped, as they are either processed on another CPU or
+ * have no pending message.
  */
-static void scmi_proccess_smt(unsigned int agent_id, uint32_t *payload_buf)
+static void scmi_proccess_smt_slot(unsigned int agent_id,
+				   struct scmi_msg_channel *chan,
+				   unsigned int slot, uint32_t *payload_buf)
 {
-	struct scmi_msg_channel *chan;
+	bool single_slot = channel_slot_count(chan) == 1U;
 	struct smt_header *smt_hdr;
 	size_t in_payload_size;
 	uint32_t smt_status;
 	struct scmi_msg msg;
+	bool slot_taken = false;
 	bool error = true;
 
-	chan = plat_scmi_get_channel(agent_id);
-	if (chan == NULL) {
-		return;
-	}
-
-	smt_hdr = channel_to_smt_hdr(chan);
+	smt_hdr = channel_to_smt_hdr(chan, slot);
 	assert(smt_hdr);
 
 	smt_status = __atomic_load_n(&smt_hdr->status, __ATOMIC_RELAXED);
 
-	if (!channel_set_busy(chan)) {
-		VERBOSE("SCMI channel %u busy", agent_id);
+	if (!single_slot && ((smt_status & SMT_STATUS_FREE) != 0U)) {
+		return;
+	}
+
+	if (!channel_set_busy(chan, slot)) {
+		VERBOSE("SCMI channel %u slot %u busy", agent_id, slot);
+		if (!single_slot) {
+			return;
+		}
 		goto out;
 	}
 
+	slot_taken = true;
+
+	/* The slot may have been processed since its status was read */
+	smt_status = __atomic_load_n(&smt_hdr->status, __ATOMIC_ACQUIRE);
+	if (!single_slot && ((smt_status & SMT_STATUS_FREE) != 0U)) {
+		channel_release_busy(chan, slot);
+		return;
+	}
+
 	in_payload_size = __atomic_load_n(&smt_hdr->length, __ATOMIC_RELAXED) -
 			  sizeof(smt_hdr->message_header);
 
@@ -157,6 +224,7 @@ static void scmi_proccess_smt(unsigned int agent_id, uint32_t *payload_buf)
 
 	msg.protocol_id = SMT_HDR_PROT_ID(smt_hdr->message_header);
 	msg.message_id = SMT_HDR_MSG_ID(smt_hdr->message_header);
+	msg.token = SMT_HDR_TOKEN(smt_hdr->message_header);
 	msg.agent_id = agent_id;
 
 	scmi_process_message(&msg);
@@ -164,7 +232,6 @@ static void scmi_proccess_smt(unsigned int agent_id, uint32_t *payload_buf)
 	/* Update message length with the length of the response message */
 	smt_hdr->length = msg.out_size_out + sizeof(smt_hdr->message_header);
 
-	channel_release_busy(chan);
 	error = false;
 
 out:
@@ -174,6 +241,147 @@ out:
 	} else {
 		smt_hdr->status |= SMT_STATUS_FREE;
 	}
+
+	/* Released once free, so that a concurrent drain skips the slot */
+	if (slot_taken) {
+		channel_release_busy(chan, slot);
+	}
+}
+
+/*
+ * Post the oldest delayed response queued for an agent in its
+ * server-to-agent channel, if the agent has consumed the previous one.
+ * Called with smt_channels_lock held. Return true if a response was posted.
+ */
+static bool post_delayed_resp(unsigned int agent_id,
+			      struct scmi_msg_channel *chan)
+{
+	struct smt_header *smt_hdr = (struct smt_header *)chan->p2a_shm_addr;
+	struct smt_delayed_resp *resp = NULL;
+	unsigned int n;
+
+	if ((__atomic_load_n(&smt_hdr->status, __ATOMIC_ACQUIRE) &
+	     SMT_STATUS_FREE) == 0U) {
+		return false;
+	}
+
+	for (n = 0U; n < PLAT_SCMI_DELAYED_RESP_MAX; n++) {
+		if (!delayed_resp[n].pending ||
+		    (delayed_resp[n].agent_id != agent_id)) {
+			continue;
+		}
+
+		if ((resp == NULL) ||
+		    ((int)(delayed_resp[n].seq - resp->seq) < 0)) {
+			resp = &delayed_resp[n];
+		}
+	}
+
+	if (resp == NULL) {
+		return false;
+	}
+
+	memcpy(smt_hdr->payload, resp->payload, resp->size);
+	smt_hdr->message_header = resp->message_header;
+	smt_hdr->length = resp->size + sizeof(smt_hdr->message_header);
+
+	/* Hand the channel over to the agent once the response is written */
+	__atomic_store_n(&smt_hdr->status, smt_hdr->status &
+			 ~(SMT_STATUS_FREE | SMT_STATUS_ERROR),
+			 __ATOMIC_RELEASE);
+
+	resp->pending = false;
+
+	return true;
+}
+
+static void flush_delayed_resp(unsigned int agent_id,
+			       struct scmi_msg_channel *chan)
+{
+	bool posted;
+
+	if (chan->p2a_shm_addr == 0U) {
+		return;
+	}
+
+	spin_lock(&smt_channels_lock);
+	posted = post_delayed_resp(agent_id, chan);
+	spin_unlock(&smt_channels_lock);
+
+	if (posted) {
+		plat_scmi_notify_agent(agent_id);
+	}
+}
+
+int scmi_smt_delayed_response(unsigned int agent_id, unsigned int protocol_id,
+			      unsigned int message_id, unsigned int token,
+			      const void *payload, size_t size)
+{
+	struct scmi_msg_channel *chan;
+	unsigned int n;
+
+	assert((payload != NULL) && (size >= sizeof(int32_t)));
+
+	chan = plat_scmi_get_channel(agent_id);
+	if ((chan == NULL) || (chan->p2a_shm_addr == 0U)) {
+		return -ENODEV;
+	}
+
+	if ((size > SCMI_PLAYLOAD_MAX) ||
+	    ((size + sizeof(struct smt_header)) > chan->p2a_shm_size)) {
+		return -EINVAL;
+	}
+
+	spin_lock(&smt_channels_lock);
+
+	for (n = 0U; n < PLAT_SCMI_DELAYED_RESP_MAX; n++) {
+		if (!delayed_resp[n].pending) {
+			break;
+		}
+	}
+
+	if (n == PLAT_SCMI_DELAYED_RESP_MAX) {
+		spin_unlock(&smt_channels_lock);
+		return -EBUSY;
+	}
+
+	delayed_resp[n].seq = delayed_resp_seq++;
+	delayed_resp[n].agent_id = agent_id;
+	delayed_resp[n].message_header =
+		SMT_MSG_HEADER(protocol_id, message_id,
+			       SMT_MSG_TYPE_DELAYED_RESP, token);
+	delayed_resp[n].size = size;
+	memcpy(delayed_resp[n].payload, payload, size);
+	delayed_resp[n].pending = true;
+
+	spin_unlock(&smt_channels_lock);
+
+	flush_delayed_resp(agent_id, chan);
+
+	return 0;
+}
+
+/*
+ * Process the pending messages of all the slots of the channel of an agent,
+ * then post a delayed response the agent may be waiting for.
+ */
+static void scmi_proccess_smt(unsigned int agent_id, uint32_t *payload_buf)
+{
+	struct scmi_msg_channel *chan;
+	unsigned int slot;
+
+	chan = plat_scmi_get_channel(agent_id);
+	if (chan == NULL) {
+		return;
+	}
+
+	assert(channel_slot_count(chan) <= SMT_SLOT_COUNT_MAX);
+
+	for (slot = 0U; slot < channel_slot_count(chan); slot++) {
+		scmi_proccess_smt_slot(agent_id, chan, slot, payload_buf);
+	}
+
+	flush_delayed_resp(agent_id, chan);
 }
 
 void scmi_smt_fastcall_smc_entry(unsigned int agent_id)
@@ -188,19 +396,41 @@ void scmi_smt_interrupt_entry(unsigned int agent_id)
 			  interrupt_payload[plat_my_core_pos()]);
 }
 
+void scmi_smt_p2a_ack_entry(unsigned int agent_id)
+{
+	struct scmi_msg_channel *chan;
+
+	chan = plat_scmi_get_channel(agent_id);
+	if (chan == NULL) {
+		return;
+	}
+
+	flush_delayed_resp(agent_id, chan);
+}
+
 /* Init a SMT header for a shared memory buffer: state it a free/no-error */
+static void smt_init_header(uintptr_t shm_addr)
+{
+	struct smt_header *smt_header = (struct smt_header *)shm_addr;
+
+	memset(smt_header, 0, sizeof(*smt_header));
+	smt_header->status = SMT_STATUS_FREE;
+}
+
 void scmi_smt_init_agent_channel(struct scmi_msg_channel *chan)
 {
-	if (chan != NULL) {
-		struct smt_header *smt_header = channel_to_smt_hdr(chan);
+	unsigned int slot;
 
-		if (smt_header != NULL) {
-			memset(smt_header, 0, sizeof(*smt_header));
-			smt_header->status = SMT_STATUS_FREE;
+	if ((chan == NULL) || (chan->shm_addr == 0U) ||
+	    (channel_slot_count(chan) > SMT_SLOT_COUNT_MAX)) {
+		panic();
+	}
 
-			return;
-		}
+	for (slot = 0U; slot < channel_slot_count(chan); slot++) {
+		smt_init_header((uintptr_t)channel_to_smt_hdr(chan, slot));
 	}
 
-	panic();
+	if (chan->p2a_shm_addr != 0U) {
+		smt_init_header(chan->p2a_shm_addr);
+	}
 }
@@ -237,6 +237,7 @@
 #define ID_AA64PFR0_RAS_SHIFT			U(28)
 #define ID_AA64PFR0_RAS_MASK			ULL(0xf)
 #define ID_AA64PFR0_RAS_LENGTH			U(4)
+#define ID_AA64PFR0_RAS_V2			ULL(0x3)
 
 /* Exception level handling */
 #define EL_IMPL_NONE		ULL(0)
@@ -301,6 +302,14 @@
 #define ID_AA64ISAR0_RNDR_SHIFT	U(60)
 #define ID_AA64ISAR0_RNDR_MASK	ULL(0xf)
 
+#define ID_AA64ISAR0_SHA2_SHIFT		U(12)
+#define ID_AA64ISAR0_SHA2_MASK		ULL(0xf)
+#define SHA2_SHA512_IMPLEMENTED		ULL(0x2)
+
+#define ID_AA64ISAR0_AES_SHIFT		U(4)
+#define ID_AA64ISAR0_AES_MASK		ULL(0xf)
+#define AES_PMULL_IMPLEMENTED		ULL(0x2)
+
 /* ID_AA64ISAR1_EL1 definitions */
 #define ID_AA64ISAR1_EL1		S3_0_C0_C6_1
 
@@ -1435,6 +1444,9 @@
 
 #define ERRSELR_EL1		S3_0_C5_C3_1
 
+/* FEAT_RASv2 status of the group of 64 records of the selected record */
+#define ERXGSR_EL1		S3_0_C5_C3_2
+
 /* System register access to Standard Error Record registers */
 #define ERXFR_EL1		S3_0_C5_C4_0
 #define ERXCTLR_EL1		S3_0_C5_C4_1
@@ -180,6 +180,8 @@ struct crypto_heap_info {
  * Function & variable prototypes
  ******************************************************************************/
 int load_auth_image(unsigned int image_id, image_info_t *image_data);
+uint64_t bl_load_lock_wait_ticks(void);
+void bl2_load_images_secondary(void);
 
 #if TRUSTED_BOARD_BOOT && defined(DYN_DISABLE_AUTH)
 /*
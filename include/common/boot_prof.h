@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BOOT_PROF_H
+#define BOOT_PROF_H
+
+#include <cdefs.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/utils_def.h>
+
+/*
+ * Boot phases. The whole of a boot image is recorded as BOOT_PROF_STAGE, and
+ * the other phases are nested in it. Platforms may record their own phases
+ * from BOOT_PROF_PLAT_BASE.
+ */
+#define BOOT_PROF_STAGE			U(0)	/* arg: none */
+#define BOOT_PROF_CONSOLE_INIT		U(1)	/* arg: none */
+#define BOOT_PROF_DDR_INIT		U(2)	/* arg: platform defined */
+#define BOOT_PROF_STORAGE_INIT		U(3)	/* arg: io_type_t of the device */
+#define BOOT_PROF_AUTH_INIT		U(4)	/* arg: none */
+#define BOOT_PROF_PLAT_SETUP		U(5)	/* arg: none */
+#define BOOT_PROF_PRELOAD		U(6)	/* arg: none */
+#define BOOT_PROF_LOAD_IMAGES		U(7)	/* arg: none */
+#define BOOT_PROF_IMAGE_LOAD		U(8)	/* arg: image ID */
+#define BOOT_PROF_IMAGE_AUTH		U(9)	/* arg: image ID */
+#define BOOT_PROF_IMAGE_DECOMPRESS	U(10)	/* arg: none */
+#define BOOT_PROF_IMAGE_MEASURE		U(11)	/* arg: image ID */
+#define BOOT_PROF_IMAGE_FLUSH		U(12)	/* arg: image ID */
+#define BOOT_PROF_AUTH_FINISH		U(13)	/* arg: none */
+#define BOOT_PROF_PHASE_COUNT		U(14)
+#define BOOT_PROF_PLAT_BASE		U(0x80)
+
+/* Boot image which recorded a phase */
+#define BOOT_PROF_STAGE_BL1		U(1)
+#define BOOT_PROF_STAGE_BL2		U(2)
+#define BOOT_PROF_STAGE_BL31		U(31)
+
+#define BOOT_PROF_MAGIC			U(0x46525042)	/* "BPRF" */
+
+/* Handle of a phase which could not be recorded */
+#define BOOT_PROF_INVALID		U(0xffffffff)
+
+/* Duration of a phase which has not ended */
+#define BOOT_PROF_IN_PROGRESS		U(0xffffffff)
+
+/*
+ * Layout of the boot profile region, PLAT_BOOT_PROF_BASE. Each boot image
+ * appends its records to the ones of the previous images. The counter values
+ * are those of the system counter, at the frequency given in the header.
+ */
+struct boot_prof_header {
+	uint32_t magic;
+	uint32_t count;		/* Records in use */
+	uint32_t max;		/* Records which fit in the region */
+	uint32_t dropped;	/* Phases not recorded as the region was full */
+	uint64_t freq;		/* Counter frequency in Hz */
+};
+
+struct boot_prof_record {
+	uint64_t start;		/* Counter value at the start of the phase */
+	uint32_t ticks;		/* Duration, or BOOT_PROF_IN_PROGRESS */
+	uint8_t phase;		/* BOOT_PROF_* phase */
+	uint8_t stage;		/* BOOT_PROF_STAGE_* image */
+	uint16_t arg;		/* Phase specific, see above */
+};
+
+#if BOOT_PROFILE && \
+	(defined(IMAGE_BL1) || defined(IMAGE_BL2) || defined(IMAGE_BL31))
+/*
+ * Start and end the BOOT_PROF_STAGE phase of the current image. The start is
+ * called at the entry of the image, before the MMU is enabled, and the end
+ * just before the next image is entered.
+ */
+void boot_prof_stage_entry(void);
+void boot_prof_stage_exit(void);
+
+/*
+ * Attach to the boot profile region once it is mapped. Phases recorded before
+ * are kept by the image and copied there.
+ */
+void boot_prof_init(void);
+
+/* Record a phase, returning the handle to pass to boot_prof_end() */
+unsigned int boot_prof_begin(unsigned int phase, unsigned int arg);
+void boot_prof_end(unsigned int handle);
+
+#if defined(IMAGE_BL31)
+/* Print the timeline of all the boot images */
+void boot_prof_report(void);
+
+/*
+ * Copy the timeline, in the format printed by boot_prof_report(). Return the
+ * number of bytes copied.
+ */
+size_t boot_prof_read(size_t offset, void *buf, size_t size);
+#endif /* IMAGE_BL31 */
+#else
+static inline void boot_prof_stage_entry(void)
+{
+}
+
+static inline void boot_prof_stage_exit(void)
+{
+}
+
+static inline void boot_prof_init(void)
+{
+}
+
+static inline unsigned int boot_prof_begin(unsigned int phase __unused,
+					   unsigned int arg __unused)
+{
+	return BOOT_PROF_INVALID;
+}
+
+static inline void boot_prof_end(unsigned int handle __unused)
+{
+}
+
+static inline void boot_prof_report(void)
+{
+}
+#endif /* BOOT_PROFILE */
+
+#endif /* BOOT_PROF_H */
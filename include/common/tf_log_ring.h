@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TF_LOG_RING_H
+#define TF_LOG_RING_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <common/debug.h>
+
+/*
+ * Size in bytes of the log ring of each CPU. It must be a power of two.
+ */
+#ifndef PLAT_LOG_RING_SIZE
+#define PLAT_LOG_RING_SIZE		U(4096)
+#endif
+
+/*
+ * Maximum length of a single formatted message, including the log prefix.
+ * Longer messages are truncated.
+ */
+#ifndef PLAT_LOG_RING_MSG_SIZE
+#define PLAT_LOG_RING_MSG_SIZE		U(128)
+#endif
+
+/*
+ * Messages at this level or more severe bypass the ring: any pending output is
+ * drained first and the message is then printed synchronously, so that errors
+ * reach the console even if the firmware does not make progress afterwards.
+ */
+#ifndef PLAT_LOG_RING_SYNC_LEVEL
+#define PLAT_LOG_RING_SYNC_LEVEL	LOG_LEVEL_ERROR
+#endif
+
+/* Statistics of the log rings, summed over all the CPUs */
+struct tf_log_ring_stats {
+	uint64_t messages;	/* Messages captured in the rings */
+	uint64_t bytes;		/* Bytes captured in the rings */
+	uint64_t dropped;	/* Messages dropped because a ring was full */
+	uint64_t drained;	/* Bytes written to the console by a drain */
+	uint64_t capture_ticks;	/* Time spent capturing messages */
+	uint64_t drain_ticks;	/* Time spent writing rings to the console */
+};
+
+#if LOG_RING_BUFFER
+/* Capture a message into the ring of the calling CPU */
+void tf_log_ring_vprintf(uint32_t log_level, const char *fmt, va_list args);
+void tf_log_ring_putc(char c);
+
+/* Write the pending content of all the rings to the console */
+void tf_log_ring_drain(void);
+
+/*
+ * Copy the content retained in the rings, including the part already drained
+ * to the console, as a single stream made of the ring of each CPU in turn.
+ * Return the number of bytes copied.
+ */
+size_t tf_log_ring_read(size_t offset, void *buf, size_t size);
+
+void tf_log_ring_get_stats(struct tf_log_ring_stats *stats);
+
+/* Print the ring statistics and the time spent on capture and drain */
+void tf_log_ring_report(void);
+#else
+static inline void tf_log_ring_drain(void)
+{
+}
+#endif /* LOG_RING_BUFFER */
+
+#endif /* TF_LOG_RING_H */
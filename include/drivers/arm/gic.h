@@ -12,6 +12,9 @@ void gic_cpuif_enable(unsigned int cpu_idx);
 void gic_cpuif_disable(unsigned int cpu_idx);
 void gic_pcpu_off(unsigned int cpu_idx);
 void gic_pcpu_init(unsigned int cpu_idx);
+/* attach to a GIC already configured by a previous BL31 image */
+void gic_attach(unsigned int cpu_idx);
+void gic_pcpu_attach(unsigned int cpu_idx);
 void gic_save(void);
 void gic_resume(void);
 #endif
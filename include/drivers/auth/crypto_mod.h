@@ -11,6 +11,10 @@
 #define	CRYPTO_HASH_CALC_ONLY			2
 #define	CRYPTO_AUTH_VERIFY_AND_HASH_CALC	3
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 /* Return values */
 enum crypto_ret_value {
 	CRYPTO_SUCCESS = 0,
@@ -18,7 +22,10 @@ enum crypto_ret_value {
 	CRYPTO_ERR_HASH,
 	CRYPTO_ERR_SIGNATURE,
 	CRYPTO_ERR_DECRYPTION,
-	CRYPTO_ERR_UNKNOWN
+	CRYPTO_ERR_UNKNOWN,
+	CRYPTO_ERR_NOT_SUPPORTED,
+	/* Crypto library decryption only, see crypto_lib_desc_t */
+	CRYPTO_SUCCESS_DIGEST
 };
 
 #define CRYPTO_MAX_IV_SIZE		16U
@@ -39,6 +46,9 @@ enum crypto_md_algo {
 /* Maximum size as per the known stronger hash algorithm i.e.SHA512 */
 #define CRYPTO_MD_MAX_SIZE		64U
 
+/* Number of message digest algorithms in 'enum crypto_md_algo' */
+#define CRYPTO_MD_ALGO_COUNT		3U
+
 /*
  * Cryptographic library descriptor
  */
@@ -66,13 +76,25 @@ typedef struct crypto_lib_desc_s {
 			 unsigned int data_len,
 			 unsigned char output[CRYPTO_MD_MAX_SIZE]);
 
+	/*
+	 * Calculate several hashes of the same data in a single pass over it
+	 * (optional). Return one of the 'enum crypto_ret_value' options.
+	 */
+	int (*calc_hashes)(const enum crypto_md_algo md_algs[],
+			   unsigned int md_count, void *data_ptr,
+			   unsigned int data_len,
+			   unsigned char (*output)[CRYPTO_MD_MAX_SIZE]);
+
 	/* Convert Public key (optional) */
 	int (*convert_pk)(void *full_pk_ptr, unsigned int full_pk_len,
 			  void **hashed_pk_ptr, unsigned int *hashed_pk_len);
 
 	/*
 	 * Authenticated decryption. Return one of the
-	 * 'enum crypto_ret_value' options.
+	 * 'enum crypto_ret_value' options. On success, CRYPTO_SUCCESS_DIGEST
+	 * rather than CRYPTO_SUCCESS tells that the library kept the digest of
+	 * the plaintext for the next verify_hash() and calc_hash(), which are
+	 * then not offloaded to an accelerator.
 	 */
 	int (*auth_decrypt)(enum crypto_dec_algo dec_algo, void *data_ptr,
 			    size_t len, const void *key, unsigned int key_len,
@@ -80,6 +102,21 @@ typedef struct crypto_lib_desc_s {
 			    unsigned int iv_len, const void *tag,
 			    unsigned int tag_len);
 
+	/*
+	 * Incremental authenticated decryption (optional): a single operation
+	 * is started by auth_decrypt_init(), fed the consecutive parts of the
+	 * data, decrypted in place, by auth_decrypt_update(), and completed by
+	 * auth_decrypt_finish(), which checks the tag, or aborts the operation
+	 * if 'tag' is NULL. Return one of the 'enum crypto_ret_value' options,
+	 * auth_decrypt_finish() returning CRYPTO_SUCCESS_DIGEST as
+	 * auth_decrypt() does.
+	 */
+	int (*auth_decrypt_init)(enum crypto_dec_algo dec_algo, const void *key,
+				 unsigned int key_len, unsigned int key_flags,
+				 const void *iv, unsigned int iv_len);
+	int (*auth_decrypt_update)(void *data_ptr, size_t len);
+	int (*auth_decrypt_finish)(const void *tag, unsigned int tag_len);
+
 	/*
 	 * Finish using the crypto library,
 	 * anything to be done to wrap up crypto usage done here.
@@ -87,7 +124,91 @@ typedef struct crypto_lib_desc_s {
 	void (*finish)(void);
 } crypto_lib_desc_t;
 
+/*
+ * Hardware crypto accelerator descriptor
+ *
+ * The operations have the prototypes of the crypto library ones and are all
+ * optional. An operation may decline a request it cannot serve (algorithm,
+ * key type, engine state...) by returning CRYPTO_ERR_NOT_SUPPORTED, in which
+ * case the crypto library performs it instead. Any other return value is the
+ * result of the operation.
+ */
+typedef struct crypto_accel_desc_s {
+	const char *name;
+
+	/* Initialize the accelerator (optional). Return 0 on success */
+	int (*init)(void);
+
+	int (*verify_signature)(void *data_ptr, unsigned int data_len,
+				void *sig_ptr, unsigned int sig_len,
+				void *sig_alg, unsigned int sig_alg_len,
+				void *pk_ptr, unsigned int pk_len);
+	int (*verify_hash)(void *data_ptr, unsigned int data_len,
+			   void *digest_info_ptr, unsigned int digest_info_len);
+	int (*calc_hash)(enum crypto_md_algo md_alg, void *data_ptr,
+			 unsigned int data_len,
+			 unsigned char output[CRYPTO_MD_MAX_SIZE]);
+	int (*auth_decrypt)(enum crypto_dec_algo dec_algo, void *data_ptr,
+			    size_t len, const void *key, unsigned int key_len,
+			    unsigned int key_flags, const void *iv,
+			    unsigned int iv_len, const void *tag,
+			    unsigned int tag_len);
+
+	/*
+	 * Data sizes below which the crypto library is faster than the
+	 * accelerator, for the hash operations and for the decryption.
+	 */
+	size_t hash_min_len;
+	size_t dec_min_len;
+
+	/*
+	 * Alignment of the data buffers handed to the accelerator DMA, 0 if
+	 * none. Unaligned buffers are handled by the crypto library.
+	 */
+	size_t dma_align;
+
+	/*
+	 * The accelerator DMA is not coherent with the CPU data cache: the
+	 * data and parameter buffers are cleaned to memory before an
+	 * operation, and the decrypted data invalidated after it. Such
+	 * accelerators must set 'dma_align' to at least
+	 * CACHE_WRITEBACK_GRANULE, and decryptions of data which does not end
+	 * on a cache line are handled by the crypto library, so that the
+	 * invalidation does not discard data around the buffer. The digest of
+	 * calc_hash() must be written with the CPU.
+	 */
+	bool dma_non_coherent;
+} crypto_accel_desc_t;
+
+/* Operations accounted for by the crypto module */
+enum crypto_op {
+	CRYPTO_OP_VERIFY_SIGNATURE,
+	CRYPTO_OP_VERIFY_HASH,
+	CRYPTO_OP_CALC_HASH,
+	CRYPTO_OP_AUTH_DECRYPT,
+	CRYPTO_OP_COUNT
+};
+
+/*
+ * Statistics of an operation, split between the requests served by the
+ * accelerator and the ones served by the crypto library. Times are in
+ * system counter ticks. Incremental decryptions count one request per part.
+ */
+typedef struct crypto_op_stats {
+	unsigned int accel_count;
+	unsigned int lib_count;
+	uint64_t accel_bytes;
+	uint64_t lib_bytes;
+	uint64_t accel_ticks;
+	uint64_t lib_ticks;
+} crypto_op_stats_t;
+
 /* Public functions */
+#if CRYPTO_ACCEL
+int crypto_mod_register_accel(const crypto_accel_desc_t *desc);
+int crypto_mod_get_stats(enum crypto_op op, crypto_op_stats_t *stats);
+#endif /* CRYPTO_ACCEL */
+
 #if CRYPTO_SUPPORT
 void crypto_mod_init(void);
 #else
@@ -112,12 +233,22 @@ int crypto_mod_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 			    unsigned int key_flags, const void *iv,
 			    unsigned int iv_len, const void *tag,
 			    unsigned int tag_len);
+int crypto_mod_auth_decrypt_init(enum crypto_dec_algo dec_algo,
+				 const void *key, unsigned int key_len,
+				 unsigned int key_flags, const void *iv,
+				 unsigned int iv_len);
+int crypto_mod_auth_decrypt_update(void *data_ptr, size_t len);
+int crypto_mod_auth_decrypt_finish(const void *tag, unsigned int tag_len);
 
 #if (CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY) || \
     (CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC)
 int crypto_mod_calc_hash(enum crypto_md_algo alg, void *data_ptr,
 			 unsigned int data_len,
 			 unsigned char output[CRYPTO_MD_MAX_SIZE]);
+int crypto_mod_calc_hashes(const enum crypto_md_algo algs[],
+			   unsigned int alg_count, void *data_ptr,
+			   unsigned int data_len,
+			   unsigned char (*output)[CRYPTO_MD_MAX_SIZE]);
 #endif /* (CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY) || \
 	  (CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC) */
 
@@ -134,14 +265,20 @@ static inline void crypto_mod_finish(void)
 
 /* Macro to register a cryptographic library */
 #define REGISTER_CRYPTO_LIB(_name, _init, _verify_signature, _verify_hash, \
-			    _calc_hash, _auth_decrypt, _convert_pk, _finish) \
+			    _calc_hash, _calc_hashes, _auth_decrypt, \
+			    _auth_decrypt_init, _auth_decrypt_update, \
+			    _auth_decrypt_finish, _convert_pk, _finish) \
 	const crypto_lib_desc_t crypto_lib_desc = { \
 		.name = _name, \
 		.init = _init, \
 		.verify_signature = _verify_signature, \
 		.verify_hash = _verify_hash, \
 		.calc_hash = _calc_hash, \
+		.calc_hashes = _calc_hashes, \
 		.auth_decrypt = _auth_decrypt, \
+		.auth_decrypt_init = _auth_decrypt_init, \
+		.auth_decrypt_update = _auth_decrypt_update, \
+		.auth_decrypt_finish = _auth_decrypt_finish, \
 		.convert_pk = _convert_pk, \
 		.finish = _finish \
 	}
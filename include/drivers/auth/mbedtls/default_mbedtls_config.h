@@ -102,6 +102,23 @@
 #define MBEDTLS_GCM_C
 #endif
 
+/*
+ * Use the Armv8-A Cryptographic Extension instructions. Firmware cannot query
+ * the hwcaps mbed TLS relies on to pick an implementation at runtime, so the
+ * C implementations are left out and the instructions are required.
+ */
+#if TF_MBEDTLS_USE_ARMV8_CRYPTO
+#define MBEDTLS_SHA256_USE_ARMV8_A_CRYPTO_ONLY
+#if TF_MBEDTLS_USE_AES_GCM
+#define MBEDTLS_AESCE_C
+#define MBEDTLS_AES_USE_HARDWARE_ONLY
+#endif
+#endif
+
+#if TF_MBEDTLS_USE_ARMV8_SHA512
+#define MBEDTLS_SHA512_USE_A64_CRYPTO_ONLY
+#endif
+
 /* MPI / BIGNUM options */
 
 /* Note: Lower numbers trade longer execution time for less RAM allocation */
@@ -131,16 +148,33 @@
 #include <stdlib.h>
 #endif
 
+/*
+ * Heap kept by each entry of the cache of parsed public keys, including the
+ * values mbed TLS computes once and keeps in the key context.
+ */
+#ifndef TF_MBEDTLS_PK_CACHE_ENTRIES
+#define TF_MBEDTLS_PK_CACHE_ENTRIES	0
+#endif
+
+#if TF_MBEDTLS_USE_ECDSA
+#define TF_MBEDTLS_PK_CACHE_ENTRY_HEAP	U(3 * 1024)
+#else
+#define TF_MBEDTLS_PK_CACHE_ENTRY_HEAP	(U(512) + (U(3) * TF_MBEDTLS_KEY_SIZE / U(8)))
+#endif
+
+#define TF_MBEDTLS_PK_CACHE_HEAP	(TF_MBEDTLS_PK_CACHE_ENTRIES * \
+					 TF_MBEDTLS_PK_CACHE_ENTRY_HEAP)
+
 /*
  * Determine Mbed TLS heap size.
  */
 #if TF_MBEDTLS_USE_ECDSA
-#define TF_MBEDTLS_HEAP_SIZE		U(13 * 1024)
+#define TF_MBEDTLS_HEAP_SIZE		(U(13 * 1024) + TF_MBEDTLS_PK_CACHE_HEAP)
 #elif TF_MBEDTLS_USE_RSA
 #if TF_MBEDTLS_KEY_SIZE <= 2048
-#define TF_MBEDTLS_HEAP_SIZE		U(7 * 1024)
+#define TF_MBEDTLS_HEAP_SIZE		(U(7 * 1024) + TF_MBEDTLS_PK_CACHE_HEAP)
 #else
-#define TF_MBEDTLS_HEAP_SIZE		U(11 * 1024)
+#define TF_MBEDTLS_HEAP_SIZE		(U(11 * 1024) + TF_MBEDTLS_PK_CACHE_HEAP)
 #endif
 #endif
 
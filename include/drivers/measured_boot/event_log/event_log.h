@@ -38,8 +38,47 @@
 #define LOG_EVENT printf
 #endif
 
-/* Number of hashing algorithms supported */
-#define HASH_ALG_COUNT		1U
+/* Additional PCR banks selected through MBOOT_EL_EXTRA_HASH_ALGS */
+#ifndef MBOOT_EL_EXTRA_SHA256
+#define MBOOT_EL_EXTRA_SHA256	0
+#endif
+#ifndef MBOOT_EL_EXTRA_SHA384
+#define MBOOT_EL_EXTRA_SHA384	0
+#endif
+#ifndef MBOOT_EL_EXTRA_SHA512
+#define MBOOT_EL_EXTRA_SHA512	0
+#endif
+
+/* 1U if an extra bank is enabled and is not already the TPM_ALG_ID bank */
+#define EVLOG_EXTRA_BANK(_enable, _alg)	\
+	((((_enable) != 0) && (TPM_ALG_ID != (_alg))) ? 1U : 0U)
+
+/*
+ * Number of hashing algorithms (PCR banks) recorded for each event. The bank
+ * selected by TPM_ALG_ID always comes first.
+ */
+#define HASH_ALG_COUNT		(1U + \
+	EVLOG_EXTRA_BANK(MBOOT_EL_EXTRA_SHA256, TPM_ALG_SHA256) + \
+	EVLOG_EXTRA_BANK(MBOOT_EL_EXTRA_SHA384, TPM_ALG_SHA384) + \
+	EVLOG_EXTRA_BANK(MBOOT_EL_EXTRA_SHA512, TPM_ALG_SHA512))
+
+/* Size of the TCG_PCR_EVENT2.Digests[] array for all the PCR banks */
+#define EVLOG_DIGESTS_SIZE	((sizeof(tpmt_ha) * HASH_ALG_COUNT) + \
+	TCG_DIGEST_SIZE + \
+	(EVLOG_EXTRA_BANK(MBOOT_EL_EXTRA_SHA256, TPM_ALG_SHA256) * \
+	 SHA256_DIGEST_SIZE) + \
+	(EVLOG_EXTRA_BANK(MBOOT_EL_EXTRA_SHA384, TPM_ALG_SHA384) * \
+	 SHA384_DIGEST_SIZE) + \
+	(EVLOG_EXTRA_BANK(MBOOT_EL_EXTRA_SHA512, TPM_ALG_SHA512) * \
+	 SHA512_DIGEST_SIZE))
+
+/*
+ * Image IDs below this value are looked up in the metadata table through a
+ * direct index rather than by walking the table.
+ */
+#ifndef EVLOG_METADATA_INDEX_SIZE
+#define EVLOG_METADATA_INDEX_SIZE	64U
+#endif
 
 #define EVLOG_INVALID_ID	UINT32_MAX
 
@@ -56,14 +95,14 @@ typedef struct {
 			sizeof(id_event_struct_data_t))
 
 #define	LOC_EVENT_SIZE	(sizeof(event2_header_t) + \
-			sizeof(tpmt_ha) + TCG_DIGEST_SIZE + \
+			EVLOG_DIGESTS_SIZE + \
 			sizeof(event2_data_t) + \
 			sizeof(startup_locality_event_t))
 
 #define	LOG_MIN_SIZE	(ID_EVENT_SIZE + LOC_EVENT_SIZE)
 
 #define EVENT2_HDR_SIZE	(sizeof(event2_header_t) + \
-			sizeof(tpmt_ha) + TCG_DIGEST_SIZE + \
+			EVLOG_DIGESTS_SIZE + \
 			sizeof(event2_data_t))
 
 /* Functions' declarations */
@@ -112,9 +151,12 @@ int event_log_init(uint8_t *event_log_start, uint8_t *event_log_finish);
 /**
  * Measure input data and log its hash to the Event Log.
  *
- * Computes the cryptographic hash of the specified data and records it
- * in the Event Log as a TCG_PCR_EVENT2 structure using event type EV_POST_CODE.
- * Useful for firmware or image attestation.
+ * Computes the cryptographic hash of the specified data for every PCR bank
+ * in a single pass and records it in the Event Log as a TCG_PCR_EVENT2
+ * structure using event type EV_POST_CODE. Useful for firmware or image
+ * attestation. The metadata of IDs below EVLOG_METADATA_INDEX_SIZE is found
+ * through an index built the first time a given table is used, so the
+ * table must not be modified afterwards.
  *
  * @param[in] data_base     Pointer to the base of the data to be measured.
  * @param[in] data_size     Size of the data in bytes.
@@ -143,6 +185,37 @@ int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 int event_log_measure(uintptr_t data_base, uint32_t data_size,
 		      unsigned char hash_data[CRYPTO_MD_MAX_SIZE]);
 
+/**
+ * Measure the input data for every PCR bank.
+ *
+ * Computes the digests of the specified memory region for all the hashing
+ * algorithms recorded in the Event Log, walking the data only once. The
+ * first digest uses the default algorithm, as returned by
+ * `event_log_measure()`.
+ *
+ * @param[in]  data_base  Pointer to the base of the data to be measured.
+ * @param[in]  data_size  Size of the data in bytes.
+ * @param[out] digests    One digest per PCR bank, in Event Log bank order.
+ *
+ * @return 0 on success, or an error code on failure.
+ */
+int event_log_measure_banks(uintptr_t data_base, uint32_t data_size,
+		unsigned char digests[HASH_ALG_COUNT][CRYPTO_MD_MAX_SIZE]);
+
+/**
+ * Get the TPM algorithm ID and the digest size of a recorded PCR bank.
+ *
+ * Lets a platform extend each bank of a discrete TPM with the digests
+ * returned by `event_log_measure_banks()`, so that the PCRs match the
+ * Event Log.
+ *
+ * @param[in]  bank          Index of the bank, below HASH_ALG_COUNT.
+ * @param[out] algorithm_id  TPM_ALG_ID of the bank.
+ * @param[out] digest_size   Size of the digests of the bank in bytes.
+ */
+void event_log_get_bank(unsigned int bank, uint16_t *algorithm_id,
+			uint16_t *digest_size);
+
 /**
  * Record a measurement event in the Event Log.
  *
@@ -150,7 +223,10 @@ int event_log_measure(uintptr_t data_base, uint32_t data_size,
  * provided hash and metadata. This function assumes the buffer
  * has enough space and that `event_log_buf_init()` has been called.
  *
- * @param[in] hash         Pointer to the digest (TCG_DIGEST_SIZE bytes).
+ * @param[in] hash         Pointer to HASH_ALG_COUNT digests, each stored in
+ *                         a CRYPTO_MD_MAX_SIZE bytes slot in bank order (as
+ *                         returned by `event_log_measure_banks()`). With a
+ *                         single bank this is the TCG_DIGEST_SIZE digest.
  * @param[in] event_type   Type of the event, as defined in tcg.h.
  * @param[in] metadata_ptr Pointer to an event_log_metadata_t structure
  *                         providing event-specific context (e.g., PCR index, name).
@@ -32,6 +32,8 @@ void rse_measured_boot_init(struct rse_mboot_metadata *metadata_ptr);
 int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
 				 uintptr_t data_base, uint32_t data_size,
 				 uint32_t data_id);
+int rse_mboot_record(struct rse_mboot_metadata *metadata_ptr,
+		     const uint8_t *hash, uint32_t data_id);
 
 int rse_mboot_set_signer_id(struct rse_mboot_metadata *metadata_ptr,
 			    const void *pk_oid, const void *pk_ptr,
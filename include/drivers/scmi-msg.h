@@ -17,19 +17,30 @@
 /* A channel abstract a communication path between agent and server */
 struct scmi_msg_channel;
 
+/* Maximum number of SMT slots in an agent-to-server channel */
+#define SMT_SLOT_COUNT_MAX	32U
+
 /*
  * struct scmi_msg_channel - Shared memory buffer for a agent-to-server channel
  *
  * @shm_addr: Address of the shared memory for the SCMI channel
- * @shm_size: Byte size of the shared memory for the SCMI channel
- * @busy: True when channel is busy, false when channel is free
+ * @shm_size: Byte size of the shared memory of each SMT slot of the channel
+ * @slot_count: Number of SMT slots laid out consecutively from @shm_addr,
+ *	up to SMT_SLOT_COUNT_MAX; 0 stands for a single slot
+ * @busy_slots: Bit flags of the slots being processed, managed by the server
  * @agent_name: Agent name, SCMI protocol exposes 16 bytes max, or NULL
+ * @p2a_shm_addr: Address of the SMT shared memory of the server-to-agent
+ *	channel carrying delayed responses, or 0 if the agent has none
+ * @p2a_shm_size: Byte size of the server-to-agent SMT shared memory
  */
 struct scmi_msg_channel {
 	uintptr_t shm_addr;
 	size_t shm_size;
-	bool busy;
+	unsigned int slot_count;
+	uint32_t busy_slots;
 	const char *agent_name;
+	uintptr_t p2a_shm_addr;
+	size_t p2a_shm_size;
 };
 
 /*
@@ -43,7 +54,8 @@ void scmi_smt_init_agent_channel(struct scmi_msg_channel *chan);
 /*
  * Process SMT formatted message in a fastcall SMC execution context.
  * Called by platform on SMC entry. When returning, output message is
- * available in shared memory for agent to read the response.
+ * available in shared memory for agent to read the response. On channels
+ * with several slots, all the pending messages are processed.
  *
  * @agent_id: SCMI agent ID the SMT belongs to
  */
@@ -52,12 +64,39 @@ void scmi_smt_fastcall_smc_entry(unsigned int agent_id);
 /*
  * Process SMT formatted message in a secure interrupt execution context.
  * Called by platform interrupt handler. When returning, output message is
- * available in shared memory for agent to read the response.
+ * available in shared memory for agent to read the response. On channels
+ * with several slots, all the pending messages are processed.
  *
  * @agent_id: SCMI agent ID the SMT belongs to
  */
 void scmi_smt_interrupt_entry(unsigned int agent_id);
 
+/*
+ * Post the next delayed response queued for an agent, if any, once the agent
+ * has freed its server-to-agent channel. Called by platform on the doorbell,
+ * SMC or interrupt, the agent uses to acknowledge a delayed response, so that
+ * queued responses do not wait for the next agent-to-server message.
+ *
+ * @agent_id: SCMI agent ID the server-to-agent channel belongs to
+ */
+void scmi_smt_p2a_ack_entry(unsigned int agent_id);
+
+/*
+ * Complete an asynchronous sensor reading started by
+ * plat_scmi_sensor_reading_start(), sending the delayed response to the
+ * agent. Called by platform once the reading is available, e.g. from an
+ * interrupt handler, but not from plat_scmi_sensor_reading_start().
+ *
+ * @agent_id: SCMI agent ID given to plat_scmi_sensor_reading_start()
+ * @sensor_id: SCMI sensor ID given to plat_scmi_sensor_reading_start()
+ * @token: Token given to plat_scmi_sensor_reading_start()
+ * @status: SCMI compliant error code of the reading
+ * @value: Sensor reading
+ */
+void scmi_sensor_reading_complete(unsigned int agent_id,
+				  unsigned int sensor_id, unsigned int token,
+				  int32_t status, uint64_t value);
+
 /* Platform callback functions */
 
 /*
@@ -82,6 +121,14 @@ size_t plat_scmi_protocol_count(void);
  */
 const uint8_t *plat_scmi_protocol_list(unsigned int agent_id);
 
+/*
+ * Signal an agent that its server-to-agent channel holds a delayed response,
+ * e.g. by raising an interrupt to the agent, which acknowledges it through
+ * scmi_smt_p2a_ack_entry(). Optional, the default does nothing.
+ * @agent_id: SCMI agent ID
+ */
+void plat_scmi_notify_agent(unsigned int agent_id);
+
 /* Get the name of the SCMI vendor for the platform */
 const char *plat_scmi_vendor_name(void);
 
@@ -206,4 +253,257 @@ int32_t plat_scmi_rstd_autonomous(unsigned int agent_id, unsigned int scmi_id,
 int32_t plat_scmi_rstd_set_state(unsigned int agent_id, unsigned int scmi_id,
 				 bool assert_not_deassert);
 
+/* Handlers for SCMI Sensor protocol services */
+
+/*
+ * Return number of sensors for an agent
+ * @agent_id: SCMI agent ID
+ * Return number of sensors
+ */
+uint16_t plat_scmi_sensor_count(unsigned int agent_id);
+
+/*
+ * Read a sensor
+ * @agent_id: SCMI agent ID
+ * @sensor_id: SCMI sensor ID
+ * @val: Output reading, laid out as struct scmi_sensor_val
+ * Return 0 on success, non-zero on failure
+ */
+int32_t plat_scmi_sensor_reading_get(uint32_t agent_id, uint16_t sensor_id,
+				     uint32_t *val);
+
+/*
+ * Start an asynchronous reading of a sensor, completed later with
+ * scmi_sensor_reading_complete(). Optional, the default does not support
+ * asynchronous readings.
+ * @agent_id: SCMI agent ID
+ * @sensor_id: SCMI sensor ID
+ * @token: Token of the request, to give back on completion
+ * Return an SCMI compliant error code
+ */
+int32_t plat_scmi_sensor_reading_start(unsigned int agent_id,
+				       unsigned int sensor_id,
+				       unsigned int token);
+
+/* Handlers for the batched query vendor protocol services */
+
+/*
+ * Read a range of consecutive sensors at once, e.g. with a single access to
+ * a hardware monitor. Optional, the default reads the sensors one by one
+ * with plat_scmi_sensor_reading_get().
+ * @agent_id: SCMI agent ID
+ * @first_id: SCMI ID of the first sensor to read
+ * @count: Number of sensors to read
+ * @values: Output array of @count sensor readings
+ * @status: Output array of @count SCMI compliant error codes, one per sensor
+ * Return an SCMI compliant error code for the whole request
+ */
+int32_t plat_scmi_sensor_readings_get(unsigned int agent_id,
+				      unsigned int first_id, size_t count,
+				      uint64_t *values, int32_t *status);
+
+/*
+ * Get the rates of a range of consecutive clocks at once. Optional, the
+ * default gets the rates one by one with plat_scmi_clock_get_rate().
+ * @agent_id: SCMI agent ID
+ * @first_id: SCMI ID of the first clock
+ * @count: Number of clocks
+ * @rates: Output array of @count clock rates in Hertz, 0 if not supported
+ * Return an SCMI compliant error code
+ */
+int32_t plat_scmi_clock_get_rates(unsigned int agent_id,
+				  unsigned int first_id, size_t count,
+				  unsigned long *rates);
+
+/* Handlers for SCMI Performance Domain protocol services */
+
+/*
+ * struct scmi_perf_level - Performance level (aka OPP) of a domain
+ *
+ * @level: Performance level value
+ * @power_cost: Power cost of the level, in the platform power unit
+ * @latency_us: Worst-case latency, in microseconds, of a change to this level
+ */
+struct scmi_perf_level {
+	uint32_t level;
+	uint32_t power_cost;
+	uint16_t latency_us;
+};
+
+/*
+ * struct scmi_perf_fc_shm - Fastchannels of a performance domain, laid out
+ * in memory shared with the agent
+ *
+ * @level_set: Performance level requested by the agent
+ * @level_get: Current performance level, written by the server
+ * @limits_set: Maximum and minimum levels requested by the agent
+ * @limits_get: Current maximum and minimum levels, written by the server
+ */
+struct scmi_perf_fc_shm {
+	uint32_t level_set;
+	uint32_t level_get;
+	uint32_t limits_set[2];
+	uint32_t limits_get[2];
+};
+
+/*
+ * struct scmi_perf_fastchannel - Fastchannels of a performance domain
+ *
+ * @shm_addr: Address of the struct scmi_perf_fc_shm of the domain
+ * @doorbell_addr: Address of the 32-bit doorbell register the agent writes
+ *	once it has updated a set fastchannel, or 0 if the server polls them
+ * @doorbell_set_mask: Bits the agent sets in the doorbell register
+ * @doorbell_preserve_mask: Bits the agent preserves in the doorbell register
+ * @rate_limit_us: Minimum interval, in microseconds, between two requests
+ * @level_seen: Last level request handled, managed by the server
+ * @limits_seen: Last limits request handled, managed by the server
+ */
+struct scmi_perf_fastchannel {
+	uintptr_t shm_addr;
+	uintptr_t doorbell_addr;
+	uint32_t doorbell_set_mask;
+	uint32_t doorbell_preserve_mask;
+	uint32_t rate_limit_us;
+	uint32_t level_seen;
+	uint32_t limits_seen[2];
+};
+
+/*
+ * struct scmi_perf_latency - Latency of the performance level changes
+ *
+ * @count: Number of level changes
+ * @total: Cumulated latency of the changes, in system counter ticks
+ * @max: Longest latency of a change, in system counter ticks
+ */
+struct scmi_perf_latency {
+	uint64_t count;
+	uint64_t total;
+	uint64_t max;
+};
+
+/*
+ * Initialize the fastchannels of the performance domains of an agent with
+ * the current levels and limits. Called by platform at init, once the
+ * fastchannel shared memory is mapped, for each agent using fastchannels.
+ *
+ * @agent_id: SCMI agent ID
+ */
+void scmi_perf_fastchannel_init(unsigned int agent_id);
+
+/*
+ * Process the level and limits requests the agent wrote in the fastchannels
+ * of its performance domains. Called by platform from the interrupt handler
+ * of the doorbell, or periodically when the fastchannels have no doorbell.
+ *
+ * @agent_id: SCMI agent ID the fastchannels belong to
+ */
+void scmi_perf_fastchannel_entry(unsigned int agent_id);
+
+/*
+ * Get the latency of the performance level changes requested through
+ * messages or through fastchannels, measured from the reception of the
+ * request to the return of plat_scmi_perf_set_level().
+ *
+ * @fastchannel: Latency of fastchannel requests if true, of messages otherwise
+ * @latency: Output latency
+ * @clear: Reset the latency counters once read if true
+ */
+void scmi_perf_get_latency(bool fastchannel, struct scmi_perf_latency *latency,
+			   bool clear);
+
+/*
+ * Return number of performance domains for an agent
+ * @agent_id: SCMI agent ID
+ * Return number of performance domains
+ */
+size_t plat_scmi_perf_count(unsigned int agent_id);
+
+/*
+ * Get performance domain string ID (aka name)
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * Return pointer to name or NULL
+ */
+const char *plat_scmi_perf_get_name(unsigned int agent_id,
+				    unsigned int scmi_id);
+
+/*
+ * Get the performance levels of a domain, sorted by increasing level
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * @levels: Output pointer to the array of levels
+ * @nb_levels: Output number of levels in @levels
+ * Return an SCMI compliant error code
+ */
+int32_t plat_scmi_perf_get_levels(unsigned int agent_id, unsigned int scmi_id,
+				  const struct scmi_perf_level **levels,
+				  size_t *nb_levels);
+
+/*
+ * Get the sustained performance level of a domain and its frequency in kHz.
+ * By default, the highest level is the sustained one and levels are
+ * frequencies in kHz.
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * @level: Output sustained performance level
+ * @freq_khz: Output sustained frequency in kHz
+ * Return an SCMI compliant error code
+ */
+int32_t plat_scmi_perf_get_sustained(unsigned int agent_id,
+				     unsigned int scmi_id, uint32_t *level,
+				     uint32_t *freq_khz);
+
+/*
+ * Get the current performance level of a domain
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * Return the current performance level
+ */
+uint32_t plat_scmi_perf_get_level(unsigned int agent_id, unsigned int scmi_id);
+
+/*
+ * Set the performance level of a domain. The server has checked that the
+ * level is one of the domain levels and lies within the domain limits.
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * @level: Target performance level
+ * Return a compliant SCMI error code
+ */
+int32_t plat_scmi_perf_set_level(unsigned int agent_id, unsigned int scmi_id,
+				 uint32_t level);
+
+/*
+ * Get the performance limits of a domain. By default, the limits are the
+ * lowest and highest levels of the domain.
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * @range_max: Output maximum level
+ * @range_min: Output minimum level
+ * Return a compliant SCMI error code
+ */
+int32_t plat_scmi_perf_get_limits(unsigned int agent_id, unsigned int scmi_id,
+				  uint32_t *range_max, uint32_t *range_min);
+
+/*
+ * Set the performance limits of a domain. The platform moves the current
+ * level within the new limits when it lies outside of them.
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * @range_max: Maximum level, not lower than @range_min
+ * @range_min: Minimum level
+ * Return a compliant SCMI error code
+ */
+int32_t plat_scmi_perf_set_limits(unsigned int agent_id, unsigned int scmi_id,
+				  uint32_t range_max, uint32_t range_min);
+
+/*
+ * Get the fastchannels of a performance domain
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * Return pointer to the fastchannels or NULL if the domain has none
+ */
+struct scmi_perf_fastchannel *plat_scmi_perf_get_fastchannel(
+						unsigned int agent_id,
+						unsigned int scmi_id);
+
 #endif /* SCMI_MSG_H */
@@ -13,6 +13,9 @@
 #define SCMI_PROTOCOL_ID_SENSOR			0x15U
 #define SCMI_PROTOCOL_ID_RESET_DOMAIN		0x16U
 
+/* Vendor protocol of the batched sensor and clock queries */
+#define SCMI_PROTOCOL_ID_BATCH			0x80U
+
 /* SCMI error codes reported to agent through server-to-agent messages */
 #define SCMI_SUCCESS			0
 #define SCMI_NOT_SUPPORTED		(-1)
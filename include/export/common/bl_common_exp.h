@@ -25,6 +25,7 @@
 
 #define IMAGE_ATTRIB_SKIP_LOADING	U(0x02)
 #define IMAGE_ATTRIB_PLAT_SETUP		U(0x04)
+#define IMAGE_ATTRIB_CONCURRENT		U(0x08)
 
 #define INVALID_IMAGE_ID		U(0xFFFFFFFF)
 
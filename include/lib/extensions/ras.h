@@ -55,6 +55,33 @@
 		ERR_RECORD_COMMON_(_probe, _handler, _aux) \
 	}
 
+#if RAS_ERR_SCAN
+/*
+ * Standard Error Record groups handled by the scanning engine: the records in
+ * error are found from a summary of the group, and the handler is called once
+ * for each of them with the index of the record as probe data.
+ */
+#define ERR_RECORD_SYSREG_SCAN_V1(_idx_start, _num_idx, _handler, _aux) \
+	{ \
+		.version = 1, \
+		.sysreg.idx_start = _idx_start, \
+		.sysreg.num_idx = _num_idx, \
+		.access = ERR_ACCESS_SYSREG, \
+		.summary = ras_err_ser_summary_sysreg, \
+		ERR_RECORD_COMMON_(ras_err_ser_probe_sysreg, _handler, _aux) \
+	}
+
+#define ERR_RECORD_MEMMAP_SCAN_V1(_base_addr, _size_num_k, _handler, _aux) \
+	{ \
+		.version = 1, \
+		.memmap.base_addr = _base_addr, \
+		.memmap.size_num_k = _size_num_k, \
+		.access = ERR_ACCESS_MEMMAP, \
+		.summary = ras_err_ser_summary_memmap, \
+		ERR_RECORD_COMMON_(ras_err_ser_probe_memmap, _handler, _aux) \
+	}
+#endif /* RAS_ERR_SCAN */
+
 /*
  * Macro to be used to name and declare an array of RAS interrupts along with
  * their handlers.
@@ -88,6 +115,41 @@ struct ras_interrupt {
 typedef int (*err_record_probe_t)(const struct err_record_info *info,
 		int *probe_data);
 
+#if RAS_ERR_SCAN
+/*
+ * Maximum number of groups of 64 error records a group summary describes, and
+ * so maximum number of error records of a group handled by the scanning engine.
+ */
+#ifndef PLAT_RAS_SCAN_MAX_GROUPS
+#define PLAT_RAS_SCAN_MAX_GROUPS	4U
+#endif
+
+/*
+ * Function to summarise the records in error of an error record group: bit n
+ * of pending[g] is set when record (64 * g + n) of the group is in error. It
+ * returns the number of entries of pending[] it filled, at most max_groups.
+ */
+typedef unsigned int (*err_record_summary_t)(const struct err_record_info *info,
+		uint64_t *pending, unsigned int max_groups);
+
+/* Scanning state of an error record group, maintained by the RAS framework */
+struct err_record_scan {
+	/* Start of the corrected error rate limiting window, in ticks */
+	uint64_t window_start;
+
+	/* Corrected errors handled and coalesced in the current window */
+	unsigned int ce_handled;
+	unsigned int ce_coalesced;
+
+	/* Handling statistics */
+	uint64_t n_scans;
+	uint64_t n_records;
+	uint64_t n_coalesced;
+	uint64_t ticks_total;
+	uint64_t ticks_max;
+};
+#endif /* RAS_ERR_SCAN */
+
 /* Data passed to error record group handler */
 struct err_handler_data {
 	/* Info passed on from top-level exception handler */
@@ -126,6 +188,14 @@ struct err_record_info {
 	/* Opaque group-specific data */
 	void *aux_data;
 
+#if RAS_ERR_SCAN
+	/* Optional function to summarise the group, used instead of probe */
+	err_record_summary_t summary;
+
+	/* Scanning state of the group */
+	struct err_record_scan scan;
+#endif
+
 	/* Additional information for Standard Error Records */
 	union {
 		struct {
@@ -193,6 +263,44 @@ static inline int ras_err_ser_probe_sysreg(const struct err_record_info *info,
 			probe_data);
 }
 
+#if RAS_ERR_SCAN
+/*
+ * Helper functions to summarise memory-mapped and system registers implemented
+ * in Standard Error Record format
+ */
+static inline unsigned int ras_err_ser_summary_memmap(
+		const struct err_record_info *info, uint64_t *pending,
+		unsigned int max_groups)
+{
+	assert(info->version == ERR_HANDLER_VERSION);
+
+	return ser_summary_memmap(info->memmap.base_addr,
+			info->memmap.size_num_k, pending, max_groups);
+}
+
+static inline unsigned int ras_err_ser_summary_sysreg(
+		const struct err_record_info *info, uint64_t *pending,
+		unsigned int max_groups)
+{
+	assert(info->version == ERR_HANDLER_VERSION);
+
+	return ser_summary_sysreg(info->sysreg.idx_start, info->sysreg.num_idx,
+			pending, max_groups);
+}
+
+/*
+ * Vendor-specific EL3 call returning the scanning statistics of the error
+ * record group of index x1, see ras_get_scan_stats(). The number of scans,
+ * records handled and corrected errors coalesced are returned in x1-x3, and
+ * the total and maximum handling times, in system counter ticks, in x4-x5.
+ */
+#define RAS_SCAN_STATS_GET_64		U(0xC7000090)
+#define is_ras_scan_stats_fid(_fid) \
+	((_fid) == RAS_SCAN_STATS_GET_64)
+
+int ras_get_scan_stats(unsigned int group, struct err_record_scan *stats);
+#endif /* RAS_ERR_SCAN */
+
 const char *ras_serr_to_str(unsigned int serr);
 int ras_ea_handler(unsigned int ea_reason, uint64_t syndrome, void *cookie,
 		void *handle, uint64_t flags);
@@ -265,6 +265,10 @@ static inline void ser_sys_select_record(unsigned int idx)
 /* Library functions to probe Standard Error Record */
 int ser_probe_memmap(uintptr_t base, unsigned int size_num_k, int *probe_data);
 int ser_probe_sysreg(unsigned int idx_start, unsigned int num_idx, int *probe_data);
+unsigned int ser_summary_memmap(uintptr_t base, unsigned int size_num_k,
+		uint64_t *pending, unsigned int max_groups);
+unsigned int ser_summary_sysreg(unsigned int idx_start, unsigned int num_idx,
+		uint64_t *pending, unsigned int max_groups);
 #endif /* __ASSEMBLER__ */
 
 #endif /* RAS_ARCH_H */
@@ -59,6 +59,17 @@
 
 #define PMF_SMC_VERSION			U(0x00000001)
 
+/*
+ * Defines for the PMF trace ring SMC function ids, in the same Vendor-Specific
+ * EL3 range.
+ */
+#define PMF_SMC_RING_SETUP_64		U(0xC7000022)
+#define PMF_SMC_RING_DRAIN_64		U(0xC7000023)
+
+/* Policies of the trace ring once it is full */
+#define PMF_RING_OVERWRITE		U(0)
+#define PMF_RING_STOP			U(1)
+
 /*
  * The macros below are used to identify
  * PMF calls from the SMC function ID.
@@ -71,6 +82,19 @@
 #define PMF_PSCI_STAT_SVC_ID	0
 #define PMF_RT_INSTR_SVC_ID	1
 
+#if PMF_RING
+/*
+ * Record of the trace ring, as copied to the Normal world buffer by
+ * PMF_SMC_RING_DRAIN_64. The tid holds the service id in the PMF_SVC_ID
+ * field and the local timestamp id in the PMF_TID field.
+ */
+typedef struct pmf_ring_rec {
+	uint32_t tid;
+	uint32_t arg;
+	uint64_t ts;
+} pmf_ring_rec_t;
+#endif /* PMF_RING */
+
 /*******************************************************************************
  * Function & variable prototypes
  ******************************************************************************/
@@ -89,4 +113,11 @@ uintptr_t pmf_smc_handler(unsigned int smc_fid,
 		void *handle,
 		u_register_t flags);
 
+#if PMF_RING
+/* PMF trace ring functions */
+int pmf_ring_setup(uintptr_t buf_pa, size_t buf_size, unsigned int policy);
+int pmf_ring_drain(u_register_t mpidr, unsigned int *count,
+		unsigned long long *lost);
+#endif /* PMF_RING */
+
 #endif /* PMF_H */
@@ -109,7 +109,7 @@ typedef struct pmf_svc_desc {
  */
 #define PMF_REGISTER_SERVICE(_name, _svcid, _totalid, _flags)	\
 	PMF_ALLOCATE_TIMESTAMP_MEMORY(_name, _totalid)		\
-	PMF_DEFINE_CAPTURE_TIMESTAMP(_name, _flags)		\
+	PMF_DEFINE_CAPTURE_TIMESTAMP(_name, _svcid, _flags)	\
 	PMF_DEFINE_GET_TIMESTAMP(_name)
 
 /*
@@ -145,6 +145,27 @@ typedef struct pmf_svc_desc {
 
 #endif /* ENABLE_PMF */
 
+/*
+ * Convenience macro to append a record to the trace ring of the calling CPU.
+ * The time-stamps stored by PMF services are appended to the ring as well,
+ * with a null argument. The ring only exists in BL31.
+ */
+#if ENABLE_PMF && PMF_RING && defined(IMAGE_BL31)
+void __pmf_ring_record(unsigned int tid, unsigned long long ts,
+		unsigned int arg, unsigned int flags);
+
+#define PMF_RING_RECORD(_svcid, _tid, _arg, _flags)			\
+	__pmf_ring_record(((unsigned int)(_svcid) << PMF_SVC_ID_SHIFT) | \
+			(unsigned int)(_tid), read_cntpct_el0(),	\
+			(unsigned int)(_arg), (_flags))
+#define PMF_RING_STORE_TIMESTAMP(_svcid, _tid, _ts, _flags)		\
+	__pmf_ring_record(((unsigned int)(_svcid) << PMF_SVC_ID_SHIFT) | \
+			(_tid), (_ts), 0U, (_flags))
+#else
+#define PMF_RING_RECORD(_svcid, _tid, _arg, _flags)
+#define PMF_RING_STORE_TIMESTAMP(_svcid, _tid, _ts, _flags)
+#endif
+
 /*
  * Convenience macro to allocate memory for a PMF service.
  *
@@ -168,7 +189,7 @@ typedef struct pmf_svc_desc {
  *
  * The extern declaration is there to satisfy MISRA C-2012 rule 8.4.
  */
-#define PMF_DEFINE_CAPTURE_TIMESTAMP(_name, _flags)			\
+#define PMF_DEFINE_CAPTURE_TIMESTAMP(_name, _svcid, _flags)		\
 	void pmf_capture_timestamp_ ## _name(				\
 			unsigned int tid,				\
 			unsigned long long ts)				\
@@ -176,9 +197,12 @@ typedef struct pmf_svc_desc {
 		CASSERT(_flags != 0, select_proper_config);		\
 		PMF_VALIDATE_TID(_name, (uint64_t)tid);			\
 		uintptr_t base_addr = (uintptr_t) pmf_ts_mem_ ## _name;	\
-		if (((_flags) & PMF_STORE_ENABLE) != 0)			\
+		if (((_flags) & PMF_STORE_ENABLE) != 0) {		\
 			__pmf_store_timestamp(base_addr,		\
 				(uint64_t)tid, ts);			\
+			PMF_RING_STORE_TIMESTAMP(_svcid, tid, ts,	\
+				PMF_NO_CACHE_MAINT);			\
+		}							\
 		if (((_flags) & PMF_DUMP_ENABLE) != 0)			\
 			__pmf_dump_timestamp((uint64_t)tid, ts);	\
 	}								\
@@ -189,9 +213,12 @@ typedef struct pmf_svc_desc {
 		CASSERT(_flags != 0, select_proper_config);		\
 		PMF_VALIDATE_TID(_name, (uint64_t)tid);			\
 		uintptr_t base_addr = (uintptr_t) pmf_ts_mem_ ## _name;	\
-		if (((_flags) & PMF_STORE_ENABLE) != 0)			\
+		if (((_flags) & PMF_STORE_ENABLE) != 0) {		\
 			__pmf_store_timestamp_with_cache_maint(		\
 				base_addr, (uint64_t)tid, ts);		\
+			PMF_RING_STORE_TIMESTAMP(_svcid, tid, ts,	\
+				PMF_CACHE_MAINT);			\
+		}							\
 		if (((_flags) & PMF_DUMP_ENABLE) != 0)			\
 			__pmf_dump_timestamp((uint64_t)tid, ts);	\
 	}
@@ -94,6 +94,39 @@
 #define is_psci_fid(_fid) \
 	(((_fid) & PSCI_FID_MASK) == PSCI_FID_VALUE)
 
+/*
+ * Vendor-specific EL3 extension powering on several CPUs in a single call,
+ * see psci_cpu_on_many().
+ */
+#define PSCI_CPU_ON_MANY_AARCH64	U(0xc7000050)
+#define is_psci_cpu_on_many_fid(_fid) \
+	((_fid) == PSCI_CPU_ON_MANY_AARCH64)
+
+/*
+ * Vendor-specific EL3 extension returning the distributions collected by
+ * PSCI_STAT_HIST, see psci_stat_hist().
+ */
+#define PSCI_STAT_HIST_AARCH64		U(0xc7000051)
+#define is_psci_stat_hist_fid(_fid) \
+	((_fid) == PSCI_STAT_HIST_AARCH64)
+
+/* Number of buckets of a distribution, returned in 7 registers by the call */
+#define PSCI_STAT_HIST_BUCKETS		U(14)
+
+/* Distributions returned by PSCI_STAT_HIST_AARCH64 */
+#define PSCI_STAT_HIST_RESIDENCY	U(0)
+#define PSCI_STAT_HIST_ENTRY_LATENCY	U(1)
+#define PSCI_STAT_HIST_EXIT_LATENCY	U(2)
+#define PSCI_STAT_HIST_ABORTED		U(3)
+
+/*
+ * Vendor-specific EL3 extension copying the distributions collected on all the
+ * CPUs to a Normal world buffer, see psci_stat_hist_dump().
+ */
+#define PSCI_STAT_HIST_DUMP_AARCH64	U(0xc7000052)
+#define is_psci_stat_hist_dump_fid(_fid) \
+	((_fid) == PSCI_STAT_HIST_DUMP_AARCH64)
+
 /*******************************************************************************
  * PSCI Migrate and friends
  ******************************************************************************/
@@ -310,6 +343,23 @@ typedef struct psci_cpu_data {
 	plat_local_state_t local_state;
 } psci_cpu_data_t;
 
+/*******************************************************************************
+ * Header of the buffer filled by PSCI_STAT_HIST_DUMP_AARCH64. It is followed by
+ * `cpu_count` records, in core position order, each made of the MPIDR of the
+ * CPU (64-bit), the count of aborted suspends and a reserved word (32-bit),
+ * then the entry latency, exit latency and residency distributions. There is a
+ * residency distribution for each of the `state_count` local states of each of
+ * the `pwr_lvl_count` power levels, indexed by power level first. Each
+ * distribution holds `bucket_count` 32-bit buckets.
+ ******************************************************************************/
+typedef struct psci_stat_hist_dump_hdr {
+	uint32_t cpu_count;
+	uint32_t pwr_lvl_count;
+	uint32_t state_count;
+	uint32_t bucket_count;
+	uint64_t rec_size;	/* Size of a CPU record in bytes */
+} psci_stat_hist_dump_hdr_t;
+
 /*******************************************************************************
  * Structure populated by platform specific code to export routines which
  * perform common low level power management functions
@@ -363,6 +413,14 @@ int psci_cpu_on(u_register_t target_cpu,
 int psci_cpu_suspend(unsigned int power_state,
 		     uintptr_t entrypoint,
 		     u_register_t context_id);
+#if PSCI_CPU_ON_MANY
+int psci_cpu_on_many(u_register_t base_mpidr,
+		     u_register_t target_list,
+		     unsigned int aff_lvl,
+		     uintptr_t entrypoint,
+		     u_register_t context_id,
+		     u_register_t *started);
+#endif
 int psci_system_suspend(uintptr_t entrypoint, u_register_t context_id);
 int psci_cpu_off(void);
 int psci_affinity_info(u_register_t target_affinity,
@@ -373,6 +431,11 @@ u_register_t psci_migrate_info_up_cpu(void);
 int psci_node_hw_state(u_register_t target_cpu,
 		       unsigned int power_level);
 int psci_features(unsigned int psci_fid);
+#if PSCI_STAT_HIST
+int psci_stat_hist(u_register_t target_cpu, unsigned int type,
+		   unsigned int power_state, uint32_t *buckets);
+int psci_stat_hist_dump(uintptr_t buf_pa, size_t buf_size, size_t *len);
+#endif
 #if PSCI_OS_INIT_MODE
 int psci_set_suspend_mode(unsigned int mode);
 #endif
@@ -99,6 +99,7 @@ void __dead2 psci_pwrdown_cpu_end_terminal(void);
 void psci_pwrdown_cpu_end_wakeup(unsigned int power_level);
 void psci_do_manage_extensions(void);
 unsigned int psci_num_cpus_running_on_safe(unsigned int this_core);
+void psci_set_cpu_running_safe(unsigned int this_core);
 
 #endif /* __ASSEMBLER__ */
 
@@ -9,9 +9,12 @@
 
 #ifndef __ASSEMBLER__
 
+#include <cdefs.h>
 #include <stdbool.h>
 #include <stdint.h>
 
+#include <lib/utils_def.h>
+
 typedef struct spinlock {
 	volatile uint32_t lock;
 } spinlock_t;
@@ -28,6 +31,74 @@ void bit_unlock(bitlock_t *lock, uint8_t mask);
 
 bool spin_trylock(spinlock_t *lock);
 
+/*
+ * Spinlocks whose contention is worth tracking are declared as
+ * stat_spinlock_t. With SPINLOCK_STATS, BL31 counts the acquisitions, the
+ * contended acquisitions, the spin iterations and the wait and hold times of
+ * every such lock registered with stat_spinlock_register(). Otherwise they are
+ * plain spinlocks.
+ */
+#if SPINLOCK_STATS && defined(IMAGE_BL31)
+typedef struct stat_spinlock {
+	spinlock_t lock;
+	/* Index of the lock in the registry plus one, 0 if not registered */
+	unsigned int id;
+	/* Time at which the holder acquired the lock */
+	uint64_t acquired_at;
+} stat_spinlock_t;
+
+void stat_spin_lock(stat_spinlock_t *lock);
+bool stat_spin_trylock(stat_spinlock_t *lock);
+void stat_spin_unlock(stat_spinlock_t *lock);
+void stat_spinlock_register(stat_spinlock_t *lock, const char *name);
+
+/*
+ * Vendor-specific EL3 call returning the statistics of the registered lock
+ * of index x1, summed over all CPUs, see stat_spinlock_get(). Bit 0 of x2
+ * requests the statistics of that lock to be cleared once read.
+ */
+#define SPINLOCK_STATS_GET_64		U(0xC7000060)
+#define is_spinlock_stats_fid(_fid) \
+	((_fid) == SPINLOCK_STATS_GET_64)
+
+#define SPINLOCK_STATS_CLEAR		U(1)
+
+/* Statistics of a lock, the times being in system counter ticks */
+typedef struct stat_spinlock_info {
+	uint64_t acquisitions;
+	uint64_t contended;
+	uint64_t spins;
+	uint64_t hold_total;
+	uint64_t hold_max;
+	uint64_t wait_max;
+} stat_spinlock_info_t;
+
+int stat_spinlock_get(unsigned int index, unsigned int flags,
+		      stat_spinlock_info_t *info, const char **name);
+#else
+typedef spinlock_t stat_spinlock_t;
+
+static inline void stat_spin_lock(stat_spinlock_t *lock)
+{
+	spin_lock(lock);
+}
+
+static inline bool stat_spin_trylock(stat_spinlock_t *lock)
+{
+	return spin_trylock(lock);
+}
+
+static inline void stat_spin_unlock(stat_spinlock_t *lock)
+{
+	spin_unlock(lock);
+}
+
+static inline void stat_spinlock_register(stat_spinlock_t *lock __unused,
+					  const char *name __unused)
+{
+}
+#endif /* SPINLOCK_STATS && IMAGE_BL31 */
+
 #else
 
 /* Spin lock definitions for use in assembly */
@@ -39,6 +39,22 @@ void clear_map_dyn_mem_regions(struct mem_region *regions,
 			       uintptr_t va,
 			       size_t chunk);
 
+/*
+ * zero_normalmem all the regions defined in regions, on all the CPUs which
+ * join the scrub. The regions are cut into slices of up to 'slice' bytes,
+ * which each CPU maps in its own window of 'slice' bytes within the 'va_size'
+ * bytes from 'va', in the order they join. The other CPUs are started through
+ * plat_mem_scrub_start_secondaries() and join by calling
+ * scrub_mem_regions_secondary(); without them this behaves as
+ * clear_map_dyn_mem_regions() with larger mappings.
+ */
+void scrub_map_dyn_mem_regions(struct mem_region *regions,
+			       size_t nregions,
+			       uintptr_t va,
+			       size_t va_size,
+			       size_t slice);
+void scrub_mem_regions_secondary(void);
+
 /*
  * checks that a region (addr + nbytes-1) of memory is totally covered by
  * one of the regions defined in tbl. Caller must ensure that (addr+nbytes-1)
@@ -7,6 +7,9 @@
 #ifndef PLAT_LFA_H
 #define PLAT_LFA_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <services/lfa_component_desc.h>
 #include <tools_share/uuid.h>
 
@@ -21,5 +24,8 @@ uint32_t plat_lfa_get_components(plat_lfa_component_info_t **components);
 bool is_plat_lfa_activation_pending(uint32_t lfa_component_id);
 int plat_lfa_cancel(uint32_t lfa_component_id);
 int plat_lfa_load_auth_image(uint32_t lfa_component_id);
+int plat_lfa_bl31_get_staged_image(uintptr_t *base, size_t *size,
+				   uintptr_t *entry, u_register_t *args);
+void *plat_lfa_bl31_get_handoff(size_t *size);
 
 #endif /* PLAT_LFA_H */
@@ -14,5 +14,6 @@
 extern uuid_t plat_trng_uuid;
 void plat_entropy_setup(void);
 bool plat_get_entropy(uint64_t *out);
+unsigned int plat_get_entropy_batch(uint64_t *out, unsigned int count);
 
 #endif /* PLAT_TRNG_H */
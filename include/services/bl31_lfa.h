@@ -7,8 +7,70 @@
 #ifndef BL31_LFA_H
 #define BL31_LFA_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <context.h>
+#include <lib/el3_runtime/cpu_data.h>
 #include <services/lfa_component_desc.h>
 
+#include <platform_def.h>
+
+/* "LFA_BL31" in ASCII */
+#define LFA_BL31_HANDOFF_MAGIC		ULL(0x31334c425f41464c)
+#define LFA_BL31_HANDOFF_VERSION	U(1)
+
+/*
+ * State shared between the running BL31 and the live activated BL31. It lives
+ * in platform memory outside of both images (see plat_lfa_bl31_get_handoff())
+ * and carries the per-CPU contexts of all the CPUs that took part in the
+ * rendezvous, the arguments the new image is entered with and the timestamps
+ * used to report the activation latency. No other runtime state is migrated. The layout is only guaranteed to be compatible between images
+ * built from the same TF-A version and build configuration, which is checked
+ * through the version and context size fields.
+ */
+struct lfa_bl31_handoff {
+	uint64_t magic;
+	uint32_t version;
+	uint32_t ctx_size;
+	uint32_t cpu_count;
+	uint32_t primary_idx;
+	u_register_t boot_args[4];
+
+	/* Entry points of the new image */
+	uintptr_t cold_entry;
+	volatile uintptr_t warm_entry;
+
+	/* Activation timestamps, in system counter ticks */
+	uint64_t ts_entry[PLATFORM_CORE_COUNT];
+	uint64_t ts_jump;
+	uint64_t ts_resume;
+
+	volatile uint32_t cpus_resumed;
+	bool cpu_valid[PLATFORM_CORE_COUNT];
+	bool ctx_valid[PLATFORM_CORE_COUNT][CPU_CONTEXT_NUM];
+	cpu_context_t ctx[PLATFORM_CORE_COUNT][CPU_CONTEXT_NUM];
+};
+
 struct lfa_component_ops *get_bl31_activator(void);
 
+/* Hooks used by the BL31 boot flow of a live activated image */
+#if LFA_SUPPORT
+bool lfa_bl31_activation_in_progress(void);
+void lfa_bl31_primary_finish(void);
+void lfa_bl31_release_secondaries(void);
+void lfa_bl31_warm_finish(void);
+#else
+static inline bool lfa_bl31_activation_in_progress(void)
+{
+	return false;
+}
+#endif /* LFA_SUPPORT */
+
+/* Assembly helpers */
+void bl31_lfa_warm_entrypoint(void);
+void __dead2 bl31_lfa_jump(uintptr_t entry, u_register_t arg0,
+			   u_register_t arg1, u_register_t arg2,
+			   u_register_t arg3);
+
 #endif /* BL31_LFA_H */
@@ -140,4 +140,19 @@ int sdei_dispatch_event(int ev_num);
 /* Public API to check how many SDEI events are registered. */
 int sdei_get_registered_event_count(void);
 
+#if SDEI_DISPATCH_STATS
+/*
+ * Vendor-specific EL3 call returning the dispatch statistics of the PE of
+ * index x1: the number of dispatches in x1, and the total and maximum
+ * latencies, in system counter ticks, in x2 and x3.
+ */
+#define SDEI_DISPATCH_STATS_GET_64		0xC7000080U
+#define is_sdei_dispatch_stats_fid(_fid) \
+	((_fid) == SDEI_DISPATCH_STATS_GET_64)
+
+/* Public API to read the dispatch statistics of a PE */
+int sdei_get_dispatch_stats(unsigned int cpu_idx, uint64_t *count,
+		uint64_t *ticks_total, uint64_t *ticks_max);
+#endif
+
 #endif /* SDEI_H */
@@ -30,6 +30,17 @@ uint64_t spmc_smc_handler(uint32_t smc_fid,
 			  void *handle,
 			  uint64_t flags);
 
+/*
+ * Vendor-specific EL3 call returning the number of memory transaction
+ * descriptors converted to the FF-A v1.0 format in x1, and of FF-A v1.0
+ * retrievals and fragments served from a descriptor converted earlier in x2.
+ */
+#define SPMC_SHMEM_STATS_GET_64		U(0xC70000A0)
+#define is_spmc_shmem_stats_fid(_fid) \
+	((_fid) == SPMC_SHMEM_STATS_GET_64)
+
+void spmc_shmem_get_stats(uint64_t *conversions, uint64_t *conversions_avoided);
+
 static inline bool is_spmc_at_el3(void)
 {
 	return SPMC_AT_EL3 == 1;
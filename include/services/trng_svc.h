@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, ARM Limited. All rights reserved.
+ * Copyright (c) 2021-2025, ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -30,13 +30,44 @@
 #define TRNG_E_NO_ENTROPY	(-3)
 #define TRNG_E_NOT_IMPLEMENTED	(-4)
 
+/*
+ * Vendor-specific EL3 call returning the entropy pool statistics of the CPU
+ * of index x1, see struct trng_pool_stats. The eight counters are returned in
+ * x1-x8, in the order of the structure.
+ */
+#define TRNG_POOL_STATS_GET_64	U(0xC7000070)
+#define is_trng_pool_stats_fid(_fid) \
+	((_fid) == TRNG_POOL_STATS_GET_64)
+
 /* TRNG Entropy Bit Numbers */
 #define TRNG_RND32_ENTROPY_MAXBITS	(96U)
 #define TRNG_RND64_ENTROPY_MAXBITS	(192U)
 
+/* Per-CPU statistics of the TRNG entropy pools */
+struct trng_pool_stats {
+	/* Number of requests and bits of entropy returned */
+	uint64_t requests;
+	uint64_t bits_served;
+	/* Requests served without reading the entropy source */
+	uint64_t pool_hits;
+	/* Batched reads of the entropy source and words they returned */
+	uint64_t refills;
+	uint64_t source_words;
+	/* Batched reads which returned fewer words than requested */
+	uint64_t source_failures;
+	/* Batched reads which had to wait for another CPU */
+	uint64_t source_contended;
+	/* Time spent reading the entropy source, in system counter ticks */
+	uint64_t source_ticks;
+};
+
 /* Public API to perform the initial TRNG entropy setup */
 void trng_setup(void);
 
+/* Public API to read the entropy pool statistics of a CPU */
+int trng_entropy_pool_get_stats(unsigned int cpu_idx,
+				struct trng_pool_stats *stats);
+
 /* Public API to verify function id is part of TRNG */
 bool is_trng_fid(uint32_t smc_fid);
 
@@ -28,6 +28,8 @@
 
 /* PMF_SMC_GET_TIMESTAMP_32	0x87000020U */
 /* PMF_SMC_GET_TIMESTAMP_64	0xC7000020U */
+/* PMF_SMC_RING_SETUP_64	0xC7000022U */
+/* PMF_SMC_RING_DRAIN_64	0xC7000023U */
 
 /* ACS_SMC_HANDLER_32           0x87000030U */
 /* ACS_SMC_HANDLER_64           0xC7000030U */
@@ -35,4 +37,18 @@
 /* TPM_START_SMC_32		0x87000040U */
 /* TPM_START_SMC_64		0xC7000040U */
 
+/* PSCI_CPU_ON_MANY_AARCH64	0xC7000050U */
+/* PSCI_STAT_HIST_AARCH64	0xC7000051U */
+/* PSCI_STAT_HIST_DUMP_AARCH64	0xC7000052U */
+
+/* SPINLOCK_STATS_GET_64	0xC7000060U */
+
+/* TRNG_POOL_STATS_GET_64	0xC7000070U */
+
+/* SDEI_DISPATCH_STATS_GET_64	0xC7000080U */
+
+/* RAS_SCAN_STATS_GET_64	0xC7000090U */
+
+/* SPMC_SHMEM_STATS_GET_64	0xC70000A0U */
+
 #endif /* VEN_EL3_SVC_H */
@@ -1117,3 +1117,13 @@ ERRATA_SPECULATIVE_AT	:= 1
 else
 ERRATA_SPECULATIVE_AT	:= 0
 endif
+
+# Revisions of the CPUs the platform is known to ship, as a list of
+# <cpu>:<rev_var> pairs, e.g. "neoverse_n1:0x41". The reset errata of a listed
+# CPU are pre-filtered at build time for that revision.
+ERRATA_KNOWN_REVS	?=
+
+ifneq ($(strip ${ERRATA_KNOWN_REVS}),)
+ERRATA_KNOWN_REVS_LIST	:= $(subst $(space),$(comma),$(subst :,$(comma),$(strip ${ERRATA_KNOWN_REVS})))
+$(eval $(call add_define,ERRATA_KNOWN_REVS_LIST))
+endif
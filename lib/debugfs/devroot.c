@@ -5,7 +5,9 @@
  */
 
 #include <assert.h>
+#include <common/boot_prof.h>
 #include <common/debug.h>
+#include <common/tf_log_ring.h>
 #include <lib/debugfs.h>
 
 #include "blobs.h"
@@ -17,7 +19,13 @@
 static const dirtab_t dirtab[] = {
 	{"dev",   CHDIR | DEV_ROOT_QDEV,   0, O_READ},
 	{"blobs", CHDIR | DEV_ROOT_QBLOBS, 0, O_READ},
-	{"fip",   CHDIR | DEV_ROOT_QFIP,   0, O_READ}
+	{"fip",   CHDIR | DEV_ROOT_QFIP,   0, O_READ},
+#if LOG_RING_BUFFER
+	{"log",   DEV_ROOT_QLOG,           0, O_READ},
+#endif
+#if BOOT_PROFILE
+	{"boot_prof", DEV_ROOT_QBOOTPROF,  0, O_READ},
+#endif
 };
 
 static const dirtab_t devfstab[] = {
@@ -72,6 +80,26 @@ static int rootread(chan_t *channel, void *buf, int size)
 		return dirread(channel, dir, NULL, 0, rootgen);
 	}
 
+#if LOG_RING_BUFFER
+	/* Content of the log rings, see tf_log_ring_read() */
+	if (channel->qid == DEV_ROOT_QLOG) {
+		size = (int)tf_log_ring_read((size_t)channel->offset, buf,
+					     (size_t)size);
+		channel->offset += size;
+		return size;
+	}
+#endif
+
+#if BOOT_PROFILE
+	/* Timeline of the boot images, see boot_prof_read() */
+	if (channel->qid == DEV_ROOT_QBOOTPROF) {
+		size = (int)boot_prof_read((size_t)channel->offset, buf,
+					   (size_t)size);
+		channel->offset += size;
+		return size;
+	}
+#endif
+
 	/* Only makes sense when using debug language */
 	assert(channel->qid != DEV_ROOT_QBLOBCTL);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2025, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2020, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -13,6 +13,7 @@
 #include <common/debug.h>
 #include <lib/extensions/ras.h>
 #include <lib/extensions/ras_arch.h>
+#include <lib/spinlock.h>
 #include <plat/common/platform.h>
 
 #ifndef PLAT_RAS_PRI
@@ -60,6 +61,172 @@ const char *ras_serr_to_str(unsigned int serr)
 	return str[serr];
 }
 
+#if RAS_ERR_SCAN
+/*
+ * Corrected errors of a group handled per rate limiting window. Beyond that,
+ * corrected errors are cleared and counted without calling the group handler,
+ * and reported in a single message when the window ends.
+ */
+#ifndef PLAT_RAS_CE_BUDGET
+#define PLAT_RAS_CE_BUDGET		16U
+#endif
+
+#ifndef PLAT_RAS_CE_WINDOW_MS
+#define PLAT_RAS_CE_WINDOW_MS		1000U
+#endif
+
+static spinlock_t ras_scan_lock;
+
+/*
+ * Return the status of a record of a Standard Error Record group, selecting it
+ * first for System Register records.
+ */
+static uint64_t ras_scan_get_status(const struct err_record_info *info,
+		unsigned int idx)
+{
+	if (info->access == ERR_ACCESS_MEMMAP) {
+		return ser_get_status(info->memmap.base_addr, idx);
+	}
+
+	ser_sys_select_record(info->sysreg.idx_start + idx);
+
+	return read_erxstatus_el1();
+}
+
+/*
+ * Rate limit the corrected errors of a group. Return true when the record in
+ * error only holds corrected errors beyond the budget of the current window,
+ * in which case it has been cleared and is coalesced into the window count.
+ */
+static bool ras_scan_coalesce(struct err_record_info *info, unsigned int idx)
+{
+	struct err_record_scan *scan = &info->scan;
+	uint64_t status, now, window;
+	unsigned int coalesced = 0U;
+	bool ce_only, drop = false;
+
+	status = ras_scan_get_status(info, idx);
+	ce_only = (ERR_STATUS_GET_FIELD(status, CE) != 0U) &&
+		  (ERR_STATUS_GET_FIELD(status, UE) == 0U) &&
+		  (ERR_STATUS_GET_FIELD(status, DE) == 0U);
+
+	if (!ce_only) {
+		return false;
+	}
+
+	now = read_cntpct_el0();
+	window = (read_cntfrq_el0() * PLAT_RAS_CE_WINDOW_MS) / 1000U;
+
+	spin_lock(&ras_scan_lock);
+
+	if ((now - scan->window_start) >= window) {
+		coalesced = scan->ce_coalesced;
+		scan->window_start = now;
+		scan->ce_handled = 0U;
+		scan->ce_coalesced = 0U;
+	}
+
+	if (scan->ce_handled < PLAT_RAS_CE_BUDGET) {
+		scan->ce_handled++;
+	} else {
+		scan->ce_coalesced++;
+		scan->n_coalesced++;
+		drop = true;
+	}
+
+	spin_unlock(&ras_scan_lock);
+
+	if (coalesced != 0U) {
+		NOTICE("RAS: %u corrected errors coalesced on group %p\n",
+		       coalesced, (void *)info);
+	}
+
+	if (drop) {
+		/* Clear the record, writing back the status read */
+		if (info->access == ERR_ACCESS_MEMMAP) {
+			ser_set_status(info->memmap.base_addr, idx, status);
+		} else {
+			write_erxstatus_el1(status);
+		}
+	}
+
+	return drop;
+}
+
+/*
+ * Handle the errors of a group from its summary: only the records flagged in
+ * error are accessed, each of them once. System Register records are selected
+ * before their handler is called, as the Standard Error Record probe does.
+ */
+static int ras_scan_group(struct err_record_info *info,
+		const struct err_handler_data *data, unsigned int *n_handled)
+{
+	uint64_t pending[PLAT_RAS_SCAN_MAX_GROUPS];
+	uint64_t start, ticks;
+	unsigned int num_groups, g, idx, n = 0U;
+	int ret = 0;
+
+	assert(info->handler != NULL);
+
+	start = read_cntpct_el0();
+	num_groups = info->summary(info, pending, PLAT_RAS_SCAN_MAX_GROUPS);
+
+	for (g = 0U; (g < num_groups) && (ret == 0); g++) {
+		while (pending[g] != 0ULL) {
+			idx = (g << 6U) + (unsigned int)__builtin_ctzll(pending[g]);
+			pending[g] &= pending[g] - 1ULL;
+
+			if (ras_scan_coalesce(info, idx)) {
+				continue;
+			}
+
+			if (info->access == ERR_ACCESS_SYSREG) {
+				ser_sys_select_record(info->sysreg.idx_start +
+						      idx);
+			}
+
+			ret = info->handler(info, (int)idx, data);
+			if (ret != 0) {
+				break;
+			}
+			n++;
+		}
+	}
+
+	ticks = read_cntpct_el0() - start;
+
+	spin_lock(&ras_scan_lock);
+	info->scan.n_scans++;
+	info->scan.n_records += n;
+	info->scan.ticks_total += ticks;
+	if (ticks > info->scan.ticks_max) {
+		info->scan.ticks_max = ticks;
+	}
+	spin_unlock(&ras_scan_lock);
+
+	*n_handled += n;
+
+	return ret;
+}
+
+/*
+ * Return the scanning statistics of the error record group at position 'group'
+ * of the registered error records.
+ */
+int ras_get_scan_stats(unsigned int group, struct err_record_scan *stats)
+{
+	if ((stats == NULL) || (group >= err_record_mappings.num_err_records)) {
+		return -1;
+	}
+
+	spin_lock(&ras_scan_lock);
+	*stats = err_record_mappings.err_records[group].scan;
+	spin_unlock(&ras_scan_lock);
+
+	return 0;
+}
+#endif /* RAS_ERR_SCAN */
+
 /* Handler that receives External Aborts on RAS-capable systems */
 int ras_ea_handler(unsigned int ea_reason, uint64_t syndrome, void *cookie,
 		void *handle, uint64_t flags)
@@ -79,6 +246,15 @@ int ras_ea_handler(unsigned int ea_reason, uint64_t syndrome, void *cookie,
 	};
 
 	for_each_err_record_info(i, info) {
+#if RAS_ERR_SCAN
+		if (info->summary != NULL) {
+			ret = ras_scan_group(info, &err_data, &n_handled);
+			if (ret != 0) {
+				return ret;
+			}
+			continue;
+		}
+#endif
 		assert(info->probe != NULL);
 		assert(info->handler != NULL);
 
@@ -159,6 +335,16 @@ static int ras_interrupt_handler(uint32_t intr_raw, uint32_t flags,
 		panic();
 	}
 
+#if RAS_ERR_SCAN
+	if (selected->err_record->summary != NULL) {
+		unsigned int n_handled = 0U;
+
+		(void) ras_scan_group(selected->err_record, &err_data,
+				&n_handled);
+		return 0;
+	}
+#endif
+
 	if (selected->err_record->probe != NULL) {
 		ret = selected->err_record->probe(selected->err_record, &probe_data);
 		assert(ret != 0);
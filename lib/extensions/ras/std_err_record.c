@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2025, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -77,3 +77,118 @@ int ser_probe_sysreg(unsigned int idx_start, unsigned int num_idx, int *probe_da
 
 	return 0;
 }
+
+/*
+ * Summarise the records in error of memory-mapped registers implemented in
+ * Standard Error Record format, from their group status registers: a single
+ * read gives the status of 2^6 error records. Set bit n of pending[g] when
+ * record (64 * g + n) is in error, and return the number of group status
+ * registers read.
+ */
+unsigned int ser_summary_memmap(uintptr_t base, unsigned int size_num_k,
+		uint64_t *pending, unsigned int max_groups)
+{
+	unsigned int num_records, num_group_regs, i;
+
+	assert(base != 0UL);
+	assert(pending != NULL);
+
+	/* Only 4K supported for now */
+	assert(size_num_k == STD_ERR_NODE_SIZE_NUM_K);
+
+	num_records = (unsigned int)
+		(mmio_read_32(ERR_DEVID(base, size_num_k)) & ERR_DEVID_MASK);
+
+	/* A group register shows error status for 2^6 error records */
+	num_group_regs = (num_records + 63U) >> 6U;
+	assert(num_group_regs <= max_groups);
+	if (num_group_regs > max_groups) {
+		num_group_regs = max_groups;
+	}
+
+	for (i = 0U; i < num_group_regs; i++) {
+		pending[i] = mmio_read_64(ERR_GSR(base, size_num_k, i));
+	}
+
+	return num_group_regs;
+}
+
+/* Whether ERXGSR_EL1 gives the status of a group of System Register records */
+static bool ser_sys_has_group_status(void)
+{
+	return ((read_id_aa64pfr0_el1() >> ID_AA64PFR0_RAS_SHIFT) &
+		ID_AA64PFR0_RAS_MASK) >= ID_AA64PFR0_RAS_V2;
+}
+
+/*
+ * Summarise the records in error of System Registers where error records are
+ * implemented in Standard Error Record format. Set bit n of pending[g] when
+ * record (idx_start + 64 * g + n) is in error, and return the number of
+ * entries of pending[] filled.
+ *
+ * With FEAT_RASv2, ERXGSR_EL1 gives the status of the 64 records of the group
+ * of the selected record, so a single read covers each group of 64 records
+ * and the status of the records is only read once they are handled. Otherwise
+ * the status of each record is read in a single pass over the records.
+ */
+unsigned int ser_summary_sysreg(unsigned int idx_start, unsigned int num_idx,
+		uint64_t *pending, unsigned int max_groups)
+{
+	unsigned int i, num_groups, grp, rel;
+	uint64_t status, gsr;
+	unsigned int max_idx __unused =
+		((unsigned int) read_erridr_el1()) & ERRIDR_MASK;
+
+	assert(pending != NULL);
+	assert(idx_start < max_idx);
+	assert(check_u32_overflow(idx_start, num_idx) == 0);
+	assert((idx_start + num_idx - 1U) < max_idx);
+
+	num_groups = (num_idx + 63U) >> 6U;
+	assert(num_groups <= max_groups);
+	if (num_groups > max_groups) {
+		num_groups = max_groups;
+		num_idx = max_groups << 6U;
+	}
+
+	for (i = 0U; i < num_groups; i++) {
+		pending[i] = 0ULL;
+	}
+
+	if (ser_sys_has_group_status()) {
+		/*
+		 * The hardware groups are aligned on 64 records, which the
+		 * range of the group of records may not be.
+		 */
+		for (grp = idx_start & ~63U; grp < (idx_start + num_idx);
+		     grp += 64U) {
+			ser_sys_select_record(grp);
+			gsr = read_erxgsr_el1();
+
+			while (gsr != 0ULL) {
+				i = grp + (unsigned int)__builtin_ctzll(gsr);
+				gsr &= gsr - 1ULL;
+
+				if ((i < idx_start) ||
+				    (i >= (idx_start + num_idx))) {
+					continue;
+				}
+
+				rel = i - idx_start;
+				pending[rel >> 6U] |= 1ULL << (rel & 63U);
+			}
+		}
+
+		return num_groups;
+	}
+
+	for (i = 0U; i < num_idx; i++) {
+		ser_sys_select_record(idx_start + i);
+		status = read_erxstatus_el1();
+		if (ERR_STATUS_GET_FIELD(status, V) != 0U) {
+			pending[i >> 6U] |= 1ULL << (i & 63U);
+		}
+	}
+
+	return num_groups;
+}
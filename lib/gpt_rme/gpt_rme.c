@@ -131,7 +131,7 @@ static uintptr_t gpt_l1_tbl;
  * The GPTs are protected by a global spinlock to ensure
  * that multiple CPUs do not attempt to change the descriptors at once.
  */
-static spinlock_t gpt_lock;
+static stat_spinlock_t gpt_lock;
 
 /* Lock/unlock macros for GPT entries
  *
@@ -139,8 +139,8 @@ static spinlock_t gpt_lock;
  * that no more than one CPU is allowed to make changes at any
  * given time.
  */
-#define GPT_LOCK	spin_lock(&gpt_lock)
-#define GPT_UNLOCK	spin_unlock(&gpt_lock)
+#define GPT_LOCK	stat_spin_lock(&gpt_lock)
+#define GPT_UNLOCK	stat_spin_unlock(&gpt_lock)
 #else
 
 /* Base address of bitlocks array */
@@ -1321,6 +1321,8 @@ int gpt_runtime_init(uintptr_t l1_bitlocks_base, size_t l1_bitlocks_size)
 
 	/* Flush GPT bitlocks to memory */
 	flush_dcache_range((uintptr_t)gpt_bitlock, locks_size);
+#else
+	stat_spinlock_register(&gpt_lock, "gpt");
 #endif /* RME_GPT_BITLOCK_BLOCK */
 
 	VERBOSE("GPT: Runtime Configuration\n");
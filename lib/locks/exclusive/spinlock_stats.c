@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+/*
+ * Instrumented spinlocks. The lock word is the one of a plain spinlock, so
+ * acquisitions without contention cost a single trylock. The statistics are
+ * kept per CPU, like the PMF time-stamps, so that the counting does not add
+ * contention of its own: a CPU only updates its own counters, and readers sum
+ * them. The hold time is measured by the holder, from the acquisition of the
+ * lock to its release.
+ */
+#ifndef PLAT_SPINLOCK_STATS_MAX
+#define PLAT_SPINLOCK_STATS_MAX		16U
+#endif
+
+typedef struct stat_spinlock_cpu {
+	uint64_t acquisitions;
+	uint64_t contended;
+	uint64_t spins;
+	uint64_t hold_total;
+	uint64_t hold_max;
+	uint64_t wait_max;
+} __aligned(CACHE_WRITEBACK_GRANULE) stat_spinlock_cpu_t;
+
+static struct {
+	stat_spinlock_t *lock;
+	const char *name;
+} stat_spinlocks[PLAT_SPINLOCK_STATS_MAX];
+
+static stat_spinlock_cpu_t
+	stat_spinlock_cpus[PLAT_SPINLOCK_STATS_MAX][PLATFORM_CORE_COUNT];
+
+static unsigned int stat_spinlock_count;
+static spinlock_t stat_spinlock_registry_lock;
+
+/* Counters of the calling CPU for 'lock', NULL if the lock is not tracked */
+static stat_spinlock_cpu_t *stat_spinlock_my_cpu(const stat_spinlock_t *lock)
+{
+	if (lock->id == 0U) {
+		return NULL;
+	}
+
+	return &stat_spinlock_cpus[lock->id - 1U][plat_my_core_pos()];
+}
+
+static void stat_spinlock_acquired(stat_spinlock_t *lock, uint64_t spins,
+				   uint64_t wait)
+{
+	stat_spinlock_cpu_t *cpu = stat_spinlock_my_cpu(lock);
+
+	lock->acquired_at = read_cntpct_el0();
+
+	if (cpu == NULL) {
+		return;
+	}
+
+	cpu->acquisitions++;
+	if (spins != 0U) {
+		cpu->contended++;
+		cpu->spins += spins;
+		if (wait > cpu->wait_max) {
+			cpu->wait_max = wait;
+		}
+	}
+}
+
+void stat_spin_lock(stat_spinlock_t *lock)
+{
+	uint64_t start, spins = 0U, wait = 0U;
+
+	if (!spin_trylock(&lock->lock)) {
+		start = read_cntpct_el0();
+
+		/*
+		 * Poll the lock word rather than waiting for an event, so that
+		 * every failed look at the lock is accounted for.
+		 */
+		do {
+			spins++;
+			while (lock->lock.lock != 0U) {
+				spins++;
+			}
+		} while (!spin_trylock(&lock->lock));
+
+		wait = read_cntpct_el0() - start;
+	}
+
+	stat_spinlock_acquired(lock, spins, wait);
+}
+
+bool stat_spin_trylock(stat_spinlock_t *lock)
+{
+	if (!spin_trylock(&lock->lock)) {
+		return false;
+	}
+
+	stat_spinlock_acquired(lock, 0U, 0U);
+
+	return true;
+}
+
+void stat_spin_unlock(stat_spinlock_t *lock)
+{
+	stat_spinlock_cpu_t *cpu = stat_spinlock_my_cpu(lock);
+	uint64_t hold = read_cntpct_el0() - lock->acquired_at;
+
+	spin_unlock(&lock->lock);
+
+	if (cpu != NULL) {
+		cpu->hold_total += hold;
+		if (hold > cpu->hold_max) {
+			cpu->hold_max = hold;
+		}
+	}
+}
+
+/*
+ * Start tracking 'lock' under 'name', which must remain valid. Locks are
+ * registered once, at the initialisation of their owner; once the registry
+ * is full further locks are left untracked.
+ */
+void stat_spinlock_register(stat_spinlock_t *lock, const char *name)
+{
+	assert(lock != NULL);
+	assert(name != NULL);
+
+	spin_lock(&stat_spinlock_registry_lock);
+
+	if (lock->id == 0U) {
+		if (stat_spinlock_count < PLAT_SPINLOCK_STATS_MAX) {
+			stat_spinlocks[stat_spinlock_count].lock = lock;
+			stat_spinlocks[stat_spinlock_count].name = name;
+			stat_spinlock_count++;
+			lock->id = stat_spinlock_count;
+		} else {
+			WARN("Spinlock stats: no room to track \"%s\"\n", name);
+		}
+	}
+
+	spin_unlock(&stat_spinlock_registry_lock);
+}
+
+/*
+ * Return in 'info' the statistics of the registered lock of index 'index',
+ * summed over all CPUs, and its name in 'name'. Registered locks have
+ * consecutive indices from 0, so that callers can enumerate them until
+ * -EINVAL is returned.
+ *
+ * The counters are read while the CPUs may update them, so a read racing
+ * with an acquisition may miss it. With SPINLOCK_STATS_CLEAR in 'flags' the
+ * counters are cleared once read, which may lose the updates of such an
+ * acquisition.
+ */
+int stat_spinlock_get(unsigned int index, unsigned int flags,
+		      stat_spinlock_info_t *info, const char **name)
+{
+	stat_spinlock_cpu_t *cpu;
+	unsigned int i;
+
+	assert(info != NULL);
+	assert(name != NULL);
+
+	if (index >= stat_spinlock_count) {
+		return -EINVAL;
+	}
+
+	zeromem(info, sizeof(*info));
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		cpu = &stat_spinlock_cpus[index][i];
+
+		info->acquisitions += cpu->acquisitions;
+		info->contended += cpu->contended;
+		info->spins += cpu->spins;
+		info->hold_total += cpu->hold_total;
+		if (cpu->hold_max > info->hold_max) {
+			info->hold_max = cpu->hold_max;
+		}
+		if (cpu->wait_max > info->wait_max) {
+			info->wait_max = cpu->wait_max;
+		}
+
+		if ((flags & SPINLOCK_STATS_CLEAR) != 0U) {
+			zeromem(cpu, sizeof(*cpu));
+		}
+	}
+
+	*name = stat_spinlocks[index].name;
+
+	return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/pmf/pmf.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+/*
+ * The PMF trace ring keeps every time-stamp captured by BL31, rather than the
+ * last one per timestamp id, so that sequences of events can be traced over
+ * time. Each CPU appends records to its own ring without taking any lock: the
+ * owning CPU is the only writer of the records and of the head index, while
+ * the drain, serialised by a lock, is the only writer of the tail index.
+ *
+ * With the PMF_RING_OVERWRITE policy the oldest records are overwritten once
+ * the ring is full, and the drain accounts for them as lost. With the
+ * PMF_RING_STOP policy new records are dropped instead, and counted.
+ */
+#ifndef PLAT_PMF_RING_ENTRIES
+#define PLAT_PMF_RING_ENTRIES		256U
+#endif
+
+CASSERT((PLAT_PMF_RING_ENTRIES != 0U) &&
+	((PLAT_PMF_RING_ENTRIES & (PLAT_PMF_RING_ENTRIES - 1U)) == 0U),
+	assert_pmf_ring_entries_power_of_two);
+
+#define PMF_RING_MASK			(PLAT_PMF_RING_ENTRIES - 1U)
+
+typedef struct pmf_ring {
+	pmf_ring_rec_t rec[PLAT_PMF_RING_ENTRIES];
+
+	/* Written by the owning CPU only */
+	volatile uint64_t head;
+	volatile uint64_t dropped;
+
+	/* Written by the drain only */
+	volatile uint64_t tail __aligned(CACHE_WRITEBACK_GRANULE);
+	uint64_t dropped_seen;
+} __aligned(CACHE_WRITEBACK_GRANULE) pmf_ring_t;
+
+static pmf_ring_t pmf_rings[PLATFORM_CORE_COUNT];
+static unsigned int pmf_ring_policy = PMF_RING_OVERWRITE;
+
+/* Normal world buffer the records are drained to */
+static pmf_ring_rec_t *pmf_ring_buf;
+static size_t pmf_ring_buf_size;
+static spinlock_t pmf_ring_lock;
+
+void __pmf_ring_record(unsigned int tid, unsigned long long ts,
+		unsigned int arg, unsigned int flags)
+{
+	pmf_ring_t *ring = &pmf_rings[plat_my_core_pos()];
+	uint64_t head = ring->head;
+	pmf_ring_rec_t *rec;
+
+	if ((pmf_ring_policy == PMF_RING_STOP) &&
+	    ((head - ring->tail) >= PLAT_PMF_RING_ENTRIES)) {
+		ring->dropped++;
+		return;
+	}
+
+	rec = &ring->rec[head & PMF_RING_MASK];
+	rec->tid = tid;
+	rec->arg = arg;
+	rec->ts = ts;
+
+	/* Publish the record before the head moves past it */
+	dmbishst();
+	ring->head = head + 1U;
+
+	/*
+	 * Callers asking for cache maintenance run with the data cache off,
+	 * so push the record and the head to memory for the drain to see.
+	 */
+	if ((flags & PMF_CACHE_MAINT) != 0U) {
+		flush_dcache_range((uintptr_t)rec, sizeof(*rec));
+		flush_dcache_range((uintptr_t)&ring->head, sizeof(ring->head));
+	}
+}
+
+/*
+ * Map the Normal world buffer the records are drained to, and select the
+ * policy of the rings. The buffer is only mapped once; later calls may only
+ * change the policy.
+ */
+int pmf_ring_setup(uintptr_t buf_pa, size_t buf_size, unsigned int policy)
+{
+	int rc = 0;
+
+	if ((policy != PMF_RING_OVERWRITE) && (policy != PMF_RING_STOP)) {
+		return -EINVAL;
+	}
+
+	spin_lock(&pmf_ring_lock);
+
+	if (pmf_ring_buf == NULL) {
+		if ((buf_pa == 0U) || (buf_size == 0U) ||
+		    !is_aligned(buf_pa, PAGE_SIZE_4KB) ||
+		    !is_aligned(buf_size, PAGE_SIZE_4KB)) {
+			rc = -EINVAL;
+		} else {
+			/*
+			 * The buffer is identity mapped as Normal world memory,
+			 * so it cannot be used to reach Secure memory.
+			 */
+			rc = mmap_add_dynamic_region(buf_pa, buf_pa, buf_size,
+					MT_MEMORY | MT_RW | MT_NS);
+		}
+
+		if (rc == 0) {
+			pmf_ring_buf = (pmf_ring_rec_t *)buf_pa;
+			pmf_ring_buf_size = buf_size;
+		}
+	} else if ((buf_pa != (uintptr_t)pmf_ring_buf) ||
+		   (buf_size != pmf_ring_buf_size)) {
+		rc = -EPERM;
+	}
+
+	if (rc == 0) {
+		pmf_ring_policy = policy;
+	}
+
+	spin_unlock(&pmf_ring_lock);
+
+	return rc;
+}
+
+/*
+ * Copy the records of the ring of the CPU 'mpidr' to the Normal world buffer,
+ * oldest first, and consume them. On return 'count' holds the number of
+ * records copied, and 'lost' the number of records overwritten or dropped
+ * since the previous drain of that ring.
+ */
+int pmf_ring_drain(u_register_t mpidr, unsigned int *count,
+		unsigned long long *lost)
+{
+	pmf_ring_t *ring;
+	uint64_t head, tail, stale, dropped, n, i;
+	unsigned long long missed = 0ULL;
+	int cpu_idx;
+
+	assert(count != NULL);
+	assert(lost != NULL);
+
+	cpu_idx = plat_core_pos_by_mpidr(mpidr);
+	if (cpu_idx < 0) {
+		return -EINVAL;
+	}
+
+	ring = &pmf_rings[cpu_idx];
+
+	spin_lock(&pmf_ring_lock);
+
+	if (pmf_ring_buf == NULL) {
+		spin_unlock(&pmf_ring_lock);
+		return -ENOMEM;
+	}
+
+	head = ring->head;
+	dmbishld();
+	tail = ring->tail;
+
+	/* Skip the records overwritten since the previous drain */
+	if ((head - tail) > PLAT_PMF_RING_ENTRIES) {
+		missed += head - tail - PLAT_PMF_RING_ENTRIES;
+		tail = head - PLAT_PMF_RING_ENTRIES;
+	}
+
+	n = head - tail;
+	if (n > (pmf_ring_buf_size / sizeof(pmf_ring_rec_t))) {
+		n = pmf_ring_buf_size / sizeof(pmf_ring_rec_t);
+	}
+
+	for (i = 0U; i < n; i++) {
+		pmf_ring_buf[i] = ring->rec[(tail + i) & PMF_RING_MASK];
+	}
+
+	/*
+	 * When the owning CPU runs ahead of the copy, the first records copied
+	 * may have been overwritten while being read, including the slot of
+	 * a record still being written. Discard them.
+	 */
+	dmbishld();
+	head = ring->head;
+	if ((pmf_ring_policy == PMF_RING_OVERWRITE) &&
+	    ((head - tail) >= PLAT_PMF_RING_ENTRIES)) {
+		stale = head - tail - PLAT_PMF_RING_ENTRIES + 1U;
+		if (stale > n) {
+			stale = n;
+		}
+		(void)memmove(pmf_ring_buf, &pmf_ring_buf[stale],
+			      (size_t)(n - stale) * sizeof(pmf_ring_rec_t));
+		missed += stale;
+		tail += stale;
+		n -= stale;
+	}
+
+	ring->tail = tail + n;
+
+	dropped = ring->dropped;
+	missed += dropped - ring->dropped_seen;
+	ring->dropped_seen = dropped;
+
+	spin_unlock(&pmf_ring_lock);
+
+	*count = (unsigned int)n;
+	*lost = missed;
+
+	return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2025, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -26,6 +26,40 @@ uintptr_t pmf_smc_handler(unsigned int smc_fid,
 	int rc;
 	unsigned long long ts_value;
 
+#if PMF_RING
+	unsigned long long lost;
+	unsigned int count;
+
+	if (smc_fid == PMF_SMC_RING_SETUP_64) {
+		/*
+		 * x1 --> physical address of the Normal world buffer.
+		 * x2 --> size of the buffer.
+		 * x3 --> policy of the rings once full.
+		 */
+		if (is_caller_secure(flags)) {
+			SMC_RET1(handle, SMC_UNK);
+		}
+
+		rc = pmf_ring_setup((uintptr_t)x1, (size_t)x2,
+				(unsigned int)x3);
+		SMC_RET1(handle, rc);
+	}
+
+	if (smc_fid == PMF_SMC_RING_DRAIN_64) {
+		/*
+		 * x1 --> MPIDR of the CPU whose ring is drained.
+		 * Return the error code, the number of records copied to the
+		 * buffer and the number of records lost.
+		 */
+		if (is_caller_secure(flags)) {
+			SMC_RET1(handle, SMC_UNK);
+		}
+
+		rc = pmf_ring_drain(x1, &count, &lost);
+		SMC_RET3(handle, rc, count, lost);
+	}
+#endif /* PMF_RING */
+
 	/* Determine if the cpu exists of not */
 	if (!is_valid_mpidr(x2))
 		return PSCI_E_INVALID_PARAMS;
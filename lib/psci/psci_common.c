@@ -1002,6 +1002,10 @@ void psci_warmboot_entrypoint(void)
 	unsigned int cpu_idx = plat_my_core_pos();
 	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
 	psci_power_state_t state_info = { {PSCI_LOCAL_STATE_RUN} };
+#if PSCI_STAT_HIST
+	unsigned long long wake_ts = read_cntpct_el0();
+	bool from_suspend = false;
+#endif
 
 	/* Init registers that never change for the lifetime of TF-A */
 	cm_manage_extensions_el3(cpu_idx);
@@ -1056,6 +1060,9 @@ void psci_warmboot_entrypoint(void)
 
 		assert(max_off_lvl != PSCI_INVALID_PWR_LVL);
 		psci_cpu_suspend_to_powerdown_finish(cpu_idx, max_off_lvl, &state_info);
+#if PSCI_STAT_HIST
+		from_suspend = true;
+#endif
 	}
 
 	/*
@@ -1087,6 +1094,12 @@ void psci_warmboot_entrypoint(void)
 	 * in the reverse order to which they were acquired.
 	 */
 	psci_release_pwr_domain_locks(end_pwrlvl, parent_nodes);
+
+#if PSCI_STAT_HIST
+	if (from_suspend) {
+		psci_stats_suspend_exit(cpu_idx, wake_ts);
+	}
+#endif
 }
 
 /*******************************************************************************
@@ -1425,3 +1438,26 @@ unsigned int psci_num_cpus_running_on_safe(unsigned int this_core)
 
 	return no_of_cpus;
 }
+
+/*******************************************************************************
+ * Safely marks the calling CPU and all its ancestor power domains as running.
+ *
+ * This is used when a CPU starts executing a new BL31 image without going
+ * through a PSCI power on or resume sequence, e.g. after a live firmware
+ * activation, so that the PSCI state of the new image matches the hardware.
+ *
+ * @param this_core The index of the current core.
+ ******************************************************************************/
+void psci_set_cpu_running_safe(unsigned int this_core)
+{
+	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
+
+	psci_get_parent_pwr_domain_nodes(this_core, PLAT_MAX_PWR_LVL, parent_nodes);
+
+	psci_acquire_pwr_domain_locks(PLAT_MAX_PWR_LVL, parent_nodes);
+
+	psci_set_aff_info_state(AFF_STATE_ON);
+	psci_set_pwr_domains_to_run(this_core, PLAT_MAX_PWR_LVL);
+
+	psci_release_pwr_domain_locks(PLAT_MAX_PWR_LVL, parent_nodes);
+}
@@ -50,6 +50,72 @@ int psci_cpu_on(u_register_t target_cpu,
 	return psci_cpu_on_start(target_cpu, ep);
 }
 
+#if PSCI_CPU_ON_MANY
+/*******************************************************************************
+ * Vendor extension of CPU_ON, powering on a list of CPUs which share the same
+ * entry point and context id. Bit n of 'target_list' selects the CPU whose
+ * MPIDR is 'base_mpidr' with the affinity field at level 'aff_lvl' set to n.
+ *
+ * The entry point is validated once, then the power on of every target is
+ * requested back to back. A target that can't be powered on doesn't stop the
+ * others: the status of the first failure is returned, and 'started' holds
+ * the targets for which the power on was issued.
+ ******************************************************************************/
+int psci_cpu_on_many(u_register_t base_mpidr,
+		     u_register_t target_list,
+		     unsigned int aff_lvl,
+		     uintptr_t entrypoint,
+		     u_register_t context_id,
+		     u_register_t *started)
+{
+	entry_point_info_t ep_info;
+	entry_point_info_t *ep;
+	u_register_t pending, target_cpu, mask;
+	unsigned int target_idx, bit, shift;
+	int rc, ret = PSCI_E_SUCCESS;
+
+	*started = 0U;
+
+	if ((target_list == 0U) || (aff_lvl > MPIDR_AFFLVL3)) {
+		return PSCI_E_INVALID_PARAMS;
+	}
+
+	shift = (aff_lvl == MPIDR_AFFLVL3) ? MPIDR_AFF3_SHIFT :
+		(aff_lvl * MPIDR_AFFINITY_BITS);
+	mask = ~(MPIDR_AFFLVL_MASK << shift);
+
+	/* Validate the lower EL entry point common to all the targets */
+	rc = psci_validate_entry_point(&ep_info, entrypoint, context_id);
+	if (rc != PSCI_E_SUCCESS) {
+		return rc;
+	}
+
+	for (pending = target_list; pending != 0U; pending &= pending - 1U) {
+		bit = (unsigned int)__builtin_ctzll(pending);
+		target_cpu = (base_mpidr & mask) | ((u_register_t)bit << shift);
+
+		if (!is_valid_mpidr(target_cpu)) {
+			rc = PSCI_E_INVALID_PARAMS;
+		} else {
+			target_idx = (unsigned int)plat_core_pos_by_mpidr(
+								target_cpu);
+			ep = get_cpu_data_by_index(target_idx, warmboot_ep_info);
+			*ep = ep_info;
+
+			rc = psci_cpu_on_start(target_cpu, ep);
+		}
+
+		if (rc == PSCI_E_SUCCESS) {
+			*started |= (u_register_t)1U << bit;
+		} else if (ret == PSCI_E_SUCCESS) {
+			ret = rc;
+		}
+	}
+
+	return ret;
+}
+#endif /* PSCI_CPU_ON_MANY */
+
 unsigned int psci_version(void)
 {
 	return PSCI_MAJOR_VER | PSCI_MINOR_VER;
@@ -64,6 +130,11 @@ int psci_cpu_suspend(unsigned int power_state,
 	psci_power_state_t state_info = { {PSCI_LOCAL_STATE_RUN} };
 	plat_local_state_t cpu_pd_state;
 	unsigned int cpu_idx = plat_my_core_pos();
+#if PSCI_STAT_HIST
+	unsigned long long wake_ts;
+
+	psci_stats_suspend_start(cpu_idx);
+#endif
 
 #if ERRATA_SME_POWER_DOWN
 	/*
@@ -123,8 +194,16 @@ int psci_cpu_suspend(unsigned int power_state,
 		    PMF_NO_CACHE_MAINT);
 #endif
 
+#if PSCI_STAT_HIST
+		psci_stats_suspend_wfi(cpu_idx);
+#endif
+
 		psci_plat_pm_ops->cpu_standby(cpu_pd_state);
 
+#if PSCI_STAT_HIST
+		wake_ts = read_cntpct_el0();
+#endif
+
 		/* Upon exit from standby, set the state back to RUN. */
 		psci_set_cpu_local_state(PSCI_LOCAL_STATE_RUN);
 
@@ -141,6 +220,10 @@ int psci_cpu_suspend(unsigned int power_state,
 		psci_stats_update_pwr_up(cpu_idx, PSCI_CPU_PWR_LVL, &state_info);
 #endif
 
+#if PSCI_STAT_HIST
+		psci_stats_suspend_exit(cpu_idx, wake_ts);
+#endif
+
 		return PSCI_E_SUCCESS;
 	}
 
@@ -14,10 +14,20 @@
 #include <drivers/arm/gic.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/pubsub_events.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <plat/common/platform.h>
 
 #include "psci_private.h"
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+/*
+ * Time at which the power on of each CPU was last requested. The target CPU
+ * copies it to its boot-phase trace once it runs with the caches enabled.
+ */
+static unsigned long long psci_on_request_ts[PLATFORM_CORE_COUNT];
+#endif
+
 /*
  * Helper functions for the CPU level spinlocks
  */
@@ -139,6 +149,12 @@ int psci_cpu_on_start(u_register_t target_cpu,
 	 * of the target cpu to allow it to perform the necessary
 	 * steps to power on.
 	 */
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	psci_on_request_ts[target_idx] = read_cntpct_el0();
+	flush_dcache_range((uintptr_t)&psci_on_request_ts[target_idx],
+			   sizeof(psci_on_request_ts[target_idx]));
+#endif
+
 	rc = psci_plat_pm_ops->pwr_domain_on(target_cpu);
 	assert((rc == PSCI_E_SUCCESS) || (rc == PSCI_E_INTERN_FAIL));
 
@@ -191,6 +207,21 @@ void psci_cpu_on_finish(unsigned int cpu_idx, const psci_power_state_t *state_in
 	gic_cpuif_enable(cpu_idx);
 #endif /* USE_GIC_DRIVER */
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	/*
+	 * Boot-phase trace of this CPU: the power on request, the warm entry
+	 * (RT_INSTR_EXIT_HW_LOW_PWR), the completion of the platform and
+	 * interrupt controller setup, and the end of the PSCI finisher.
+	 */
+	PMF_WRITE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_CPU_ON_REQUEST,
+	    PMF_NO_CACHE_MAINT,
+	    psci_on_request_ts[cpu_idx]);
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_CPU_ON_PLAT_DONE,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/*
 	 * All the platform specific actions for turning this cpu
 	 * on have completed. Perform enough arch.initialization
@@ -223,4 +254,10 @@ void psci_cpu_on_finish(unsigned int cpu_idx, const psci_power_state_t *state_in
 	/* Populate the mpidr field within the cpu node array */
 	/* This needs to be done only once */
 	psci_cpu_pd_nodes[cpu_idx].mpidr = read_mpidr() & MPIDR_AFFINITY_MASK;
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_CPU_ON_DONE,
+	    PMF_NO_CACHE_MAINT);
+#endif
 }
@@ -364,6 +364,12 @@ void psci_stats_update_pwr_down(unsigned int cpu_idx, unsigned int end_pwrlvl,
 			const psci_power_state_t *state_info);
 void psci_stats_update_pwr_up(unsigned int cpu_idx, unsigned int end_pwrlvl,
 			const psci_power_state_t *state_info);
+#if PSCI_STAT_HIST
+void psci_stats_suspend_start(unsigned int cpu_idx);
+void psci_stats_suspend_abort(unsigned int cpu_idx);
+void psci_stats_suspend_wfi(unsigned int cpu_idx);
+void psci_stats_suspend_exit(unsigned int cpu_idx, unsigned long long wake_ts);
+#endif
 u_register_t psci_stat_residency(u_register_t target_cpu,
 			unsigned int power_state);
 u_register_t psci_stat_count(u_register_t target_cpu,
@@ -1,14 +1,18 @@
 /*
- * Copyright (c) 2016-2019, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2025, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include <platform_def.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
+#include <lib/spinlock.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
 #include <plat/common/platform.h>
 
 #include "psci_private.h"
@@ -39,6 +43,117 @@ static psci_stat_t psci_cpu_stat[PLATFORM_CORE_COUNT]
 static psci_stat_t psci_non_cpu_stat[PSCI_NUM_NON_CPU_PWR_DOMAINS]
 				[PLAT_MAX_PWR_LVL_STATES];
 
+#if PSCI_STAT_HIST
+/*
+ * Log2 of the ratio between the bounds of consecutive histogram buckets.
+ * Bucket 0 counts zero values, and bucket n values in [2^(s*(n-1)), 2^(s*n))
+ * microseconds, the last bucket also counting anything above.
+ */
+#define RESIDENCY_HIST_LOG2_STEP	2U
+#define LATENCY_HIST_LOG2_STEP		1U
+
+/*
+ * Following structure holds the distributions collected on a CPU. Each CPU
+ * only updates its own entry, aligned so as not to share a cache line with
+ * another CPU. The residency of a non CPU power domain is accounted to the
+ * CPU which wakes it up.
+ */
+typedef struct psci_stat_hist {
+	uint32_t residency[PLAT_MAX_PWR_LVL + 1U][PLAT_MAX_PWR_LVL_STATES]
+			  [PSCI_STAT_HIST_BUCKETS];
+	uint32_t entry_latency[PSCI_STAT_HIST_BUCKETS];
+	uint32_t exit_latency[PSCI_STAT_HIST_BUCKETS];
+	uint32_t aborted;
+
+	/* Timestamps of the suspend in progress */
+	unsigned long long suspend_ts;
+	unsigned long long wfi_ts;
+} __aligned(CACHE_WRITEBACK_GRANULE) psci_stat_hist_t;
+
+static psci_stat_hist_t psci_cpu_hist[PLATFORM_CORE_COUNT];
+
+/* Record of a CPU following psci_stat_hist_dump_hdr_t in a dump */
+typedef struct psci_stat_hist_dump_rec {
+	uint64_t mpidr;
+	uint32_t aborted;
+	uint32_t reserved;
+	uint32_t entry_latency[PSCI_STAT_HIST_BUCKETS];
+	uint32_t exit_latency[PSCI_STAT_HIST_BUCKETS];
+	uint32_t residency[PLAT_MAX_PWR_LVL + 1U][PLAT_MAX_PWR_LVL_STATES]
+			  [PSCI_STAT_HIST_BUCKETS];
+} psci_stat_hist_dump_rec_t;
+
+/* Serialises the mapping of the Normal world buffers dumps are copied to */
+static spinlock_t psci_hist_dump_lock;
+
+static void hist_record(uint32_t *hist, unsigned long long us,
+			unsigned int log2_step)
+{
+	unsigned int bucket = 0U;
+
+	if (us != 0ULL) {
+		bucket = (64U - (unsigned int)__builtin_clzll(us) +
+			  log2_step - 1U) / log2_step;
+		if (bucket >= PSCI_STAT_HIST_BUCKETS) {
+			bucket = PSCI_STAT_HIST_BUCKETS - 1U;
+		}
+	}
+
+	hist[bucket]++;
+}
+
+static unsigned long long ticks_to_us(unsigned long long ticks)
+{
+	return (ticks * 1000000ULL) / read_cntfrq_el0();
+}
+
+/*
+ * Record the start of a suspend request on this CPU, i.e. the entry into the
+ * PSCI CPU_SUSPEND handling.
+ */
+void psci_stats_suspend_start(unsigned int cpu_idx)
+{
+	psci_cpu_hist[cpu_idx].suspend_ts = read_cntpct_el0();
+}
+
+/* Account a suspend request abandoned before reaching the low power state */
+void psci_stats_suspend_abort(unsigned int cpu_idx)
+{
+	psci_cpu_hist[cpu_idx].aborted++;
+}
+
+/*
+ * Record that this CPU is about to enter the low power state. This may run
+ * with the data cache disabled, so both timestamps of the suspend are cleaned
+ * to memory for the CPU to read them back on wake up.
+ */
+void psci_stats_suspend_wfi(unsigned int cpu_idx)
+{
+	psci_stat_hist_t *hist = &psci_cpu_hist[cpu_idx];
+
+	hist->wfi_ts = read_cntpct_el0();
+	flush_dcache_range((uintptr_t)&hist->suspend_ts,
+			   sizeof(hist->suspend_ts) + sizeof(hist->wfi_ts));
+}
+
+/*
+ * Account the entry latency of the suspend this CPU woke up from, and the exit
+ * latency from 'wake_ts' to now, just ahead of the return to the caller. This
+ * is called with the data cache enabled.
+ */
+void psci_stats_suspend_exit(unsigned int cpu_idx, unsigned long long wake_ts)
+{
+	psci_stat_hist_t *hist = &psci_cpu_hist[cpu_idx];
+
+	hist_record(hist->entry_latency,
+		    ticks_to_us(hist->wfi_ts - hist->suspend_ts),
+		    LATENCY_HIST_LOG2_STEP);
+	hist_record(hist->exit_latency,
+		    ticks_to_us(read_cntpct_el0() - wake_ts),
+		    LATENCY_HIST_LOG2_STEP);
+}
+#endif /* PSCI_STAT_HIST */
+
 /*
  * This functions returns the index into the `psci_stat_t` array given the
  * local power state and power domain level. If the platform implements the
@@ -127,6 +242,10 @@ void psci_stats_update_pwr_up(unsigned int cpu_idx, unsigned int end_pwrlvl,
 	/* Update CPU stats. */
 	psci_cpu_stat[cpu_idx][stat_idx].residency += residency;
 	psci_cpu_stat[cpu_idx][stat_idx].count++;
+#if PSCI_STAT_HIST
+	hist_record(psci_cpu_hist[cpu_idx].residency[PSCI_CPU_PWR_LVL][stat_idx],
+		    residency, RESIDENCY_HIST_LOG2_STEP);
+#endif
 
 	/*
 	 * Check what power domains above CPU were off
@@ -159,6 +278,10 @@ void psci_stats_update_pwr_up(unsigned int cpu_idx, unsigned int end_pwrlvl,
 		/* Update non cpu stats */
 		psci_non_cpu_stat[parent_idx][stat_idx].residency += residency;
 		psci_non_cpu_stat[parent_idx][stat_idx].count++;
+#if PSCI_STAT_HIST
+		hist_record(psci_cpu_hist[cpu_idx].residency[lvl][stat_idx],
+			    residency, RESIDENCY_HIST_LOG2_STEP);
+#endif
 
 		parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
 	}
@@ -166,22 +289,17 @@ void psci_stats_update_pwr_up(unsigned int cpu_idx, unsigned int end_pwrlvl,
 }
 
 /*******************************************************************************
- * This function returns the appropriate count and residency time of the
- * local state for the highest power level expressed in the `power_state`
- * for the node represented by `target_cpu`.
+ * This function returns the highest power level expressed in the
+ * `power_state` for the node represented by `target_cpu`, along with the
+ * index of its local state into the stats arrays.
  ******************************************************************************/
-static int psci_get_stat(u_register_t target_cpu, unsigned int power_state,
-			 psci_stat_t *psci_stat)
+static int psci_get_stat_idx(u_register_t target_cpu, unsigned int power_state,
+			     unsigned int *pwrlvl, int *stat_idx)
 {
 	int rc;
-	unsigned int pwrlvl, lvl, parent_idx, target_idx;
-	int stat_idx;
 	psci_power_state_t state_info = { {PSCI_LOCAL_STATE_RUN} };
 	plat_local_state_t local_state;
 
-	/* Determine the cpu index */
-	target_idx = (unsigned int) plat_core_pos_by_mpidr(target_cpu);
-
 	/* Validate the power_state parameter */
 	if (psci_plat_pm_ops->translate_power_state_by_mpidr == NULL)
 		rc = psci_validate_power_state(power_state, &state_info);
@@ -193,15 +311,37 @@ static int psci_get_stat(u_register_t target_cpu, unsigned int power_state,
 		return PSCI_E_INVALID_PARAMS;
 
 	/* Find the highest power level */
-	pwrlvl = psci_find_target_suspend_lvl(&state_info);
-	if (pwrlvl == PSCI_INVALID_PWR_LVL) {
+	*pwrlvl = psci_find_target_suspend_lvl(&state_info);
+	if (*pwrlvl == PSCI_INVALID_PWR_LVL) {
 		ERROR("Invalid target power level for PSCI statistics operation\n");
 		panic();
 	}
 
 	/* Get the index into the stats array */
-	local_state = state_info.pwr_domain_state[pwrlvl];
-	stat_idx = get_stat_idx(local_state, pwrlvl);
+	local_state = state_info.pwr_domain_state[*pwrlvl];
+	*stat_idx = get_stat_idx(local_state, *pwrlvl);
+
+	return PSCI_E_SUCCESS;
+}
+
+/*******************************************************************************
+ * This function returns the appropriate count and residency time of the
+ * local state for the highest power level expressed in the `power_state`
+ * for the node represented by `target_cpu`.
+ ******************************************************************************/
+static int psci_get_stat(u_register_t target_cpu, unsigned int power_state,
+			 psci_stat_t *psci_stat)
+{
+	int rc;
+	unsigned int pwrlvl, lvl, parent_idx, target_idx;
+	int stat_idx;
+
+	/* Determine the cpu index */
+	target_idx = (unsigned int) plat_core_pos_by_mpidr(target_cpu);
+
+	rc = psci_get_stat_idx(target_cpu, power_state, &pwrlvl, &stat_idx);
+	if (rc != PSCI_E_SUCCESS)
+		return rc;
 
 	if (pwrlvl > PSCI_CPU_PWR_LVL) {
 		/* Get the power domain index */
@@ -254,3 +394,125 @@ u_register_t psci_stat_count(u_register_t target_cpu,
 	else
 		return 0;
 }
+
+#if PSCI_STAT_HIST
+/*******************************************************************************
+ * This function copies one of the distributions collected on `target_cpu` to
+ * `buckets`, which holds PSCI_STAT_HIST_BUCKETS entries. For the residency,
+ * the distribution is the one of the local state for the highest power level
+ * expressed in `power_state`. For the aborted suspend count, only the first
+ * entry is meaningful.
+ ******************************************************************************/
+int psci_stat_hist(u_register_t target_cpu, unsigned int type,
+		   unsigned int power_state, uint32_t *buckets)
+{
+	const psci_stat_hist_t *hist;
+	unsigned int pwrlvl, target_idx, i;
+	int stat_idx, rc;
+
+	/* Validate the target cpu */
+	if (!is_valid_mpidr(target_cpu))
+		return PSCI_E_INVALID_PARAMS;
+
+	target_idx = (unsigned int) plat_core_pos_by_mpidr(target_cpu);
+	hist = &psci_cpu_hist[SPECULATION_SAFE_VALUE(target_idx)];
+
+	for (i = 0U; i < PSCI_STAT_HIST_BUCKETS; i++)
+		buckets[i] = 0U;
+
+	switch (type) {
+	case PSCI_STAT_HIST_RESIDENCY:
+		rc = psci_get_stat_idx(target_cpu, power_state, &pwrlvl,
+				       &stat_idx);
+		if (rc != PSCI_E_SUCCESS)
+			return rc;
+
+		for (i = 0U; i < PSCI_STAT_HIST_BUCKETS; i++)
+			buckets[i] = hist->residency[pwrlvl][stat_idx][i];
+		break;
+	case PSCI_STAT_HIST_ENTRY_LATENCY:
+		for (i = 0U; i < PSCI_STAT_HIST_BUCKETS; i++)
+			buckets[i] = hist->entry_latency[i];
+		break;
+	case PSCI_STAT_HIST_EXIT_LATENCY:
+		for (i = 0U; i < PSCI_STAT_HIST_BUCKETS; i++)
+			buckets[i] = hist->exit_latency[i];
+		break;
+	case PSCI_STAT_HIST_ABORTED:
+		buckets[0] = hist->aborted;
+		break;
+	default:
+		return PSCI_E_INVALID_PARAMS;
+	}
+
+	return PSCI_E_SUCCESS;
+}
+
+/*******************************************************************************
+ * This function copies the distributions collected on all the CPUs to the
+ * Normal world buffer at `buf_pa`, in the layout described alongside
+ * psci_stat_hist_dump_hdr_t. The buffer, 4KB aligned, is only mapped for the
+ * duration of the copy. `len` returns the size of the dump, also when the
+ * buffer is too small to hold it.
+ ******************************************************************************/
+int psci_stat_hist_dump(uintptr_t buf_pa, size_t buf_size, size_t *len)
+{
+	psci_stat_hist_dump_hdr_t *hdr;
+	psci_stat_hist_dump_rec_t *rec;
+	const psci_stat_hist_t *hist;
+	unsigned int i;
+	int rc;
+
+	*len = sizeof(*hdr) + (PLATFORM_CORE_COUNT * sizeof(*rec));
+
+	if ((buf_pa == 0U) || (buf_size < *len) ||
+	    !is_aligned(buf_pa, PAGE_SIZE_4KB) ||
+	    !is_aligned(buf_size, PAGE_SIZE_4KB))
+		return PSCI_E_INVALID_PARAMS;
+
+	spin_lock(&psci_hist_dump_lock);
+
+	/*
+	 * The buffer is identity mapped as Normal world memory, so it cannot
+	 * be used to reach Secure memory.
+	 */
+	rc = mmap_add_dynamic_region(buf_pa, buf_pa, buf_size,
+				     MT_MEMORY | MT_RW | MT_NS);
+	if (rc != 0) {
+		spin_unlock(&psci_hist_dump_lock);
+		return PSCI_E_INVALID_ADDRESS;
+	}
+
+	hdr = (psci_stat_hist_dump_hdr_t *)buf_pa;
+	hdr->cpu_count = PLATFORM_CORE_COUNT;
+	hdr->pwr_lvl_count = PLAT_MAX_PWR_LVL + 1U;
+	hdr->state_count = PLAT_MAX_PWR_LVL_STATES;
+	hdr->bucket_count = PSCI_STAT_HIST_BUCKETS;
+	hdr->rec_size = sizeof(*rec);
+
+	/*
+	 * The other CPUs keep updating their distributions, so each one is a
+	 * snapshot taken at a slightly different time.
+	 */
+	rec = (psci_stat_hist_dump_rec_t *)(hdr + 1);
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++, rec++) {
+		hist = &psci_cpu_hist[i];
+		rec->mpidr = psci_cpu_pd_nodes[i].mpidr;
+		rec->aborted = hist->aborted;
+		rec->reserved = 0U;
+		(void)memcpy(rec->entry_latency, hist->entry_latency,
+			     sizeof(rec->entry_latency));
+		(void)memcpy(rec->exit_latency, hist->exit_latency,
+			     sizeof(rec->exit_latency));
+		(void)memcpy(rec->residency, hist->residency,
+			     sizeof(rec->residency));
+	}
+
+	rc = mmap_remove_dynamic_region(buf_pa, buf_size);
+	assert(rc == 0);
+
+	spin_unlock(&psci_hist_dump_lock);
+
+	return PSCI_E_SUCCESS;
+}
+#endif /* PSCI_STAT_HIST */
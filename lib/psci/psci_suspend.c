@@ -117,6 +117,9 @@ int psci_cpu_suspend_start(unsigned int idx,
 	int rc = PSCI_E_SUCCESS;
 	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
 	unsigned int max_off_lvl = 0;
+#if PSCI_STAT_HIST
+	unsigned long long wake_ts = 0ULL;
+#endif
 
 	/*
 	 * This function must only be called on platforms where the
@@ -141,6 +144,9 @@ int psci_cpu_suspend_start(unsigned int idx,
 	 * detection that a wake-up interrupt has fired.
 	 */
 	if (read_isr_el1() != 0U) {
+#if PSCI_STAT_HIST
+		psci_stats_suspend_abort(idx);
+#endif
 		goto suspend_exit;
 	}
 
@@ -152,6 +158,9 @@ int psci_cpu_suspend_start(unsigned int idx,
 		 */
 		rc = psci_validate_state_coordination(idx, end_pwrlvl, state_info);
 		if (rc != PSCI_E_SUCCESS) {
+#if PSCI_STAT_HIST
+			psci_stats_suspend_abort(idx);
+#endif
 			goto suspend_exit;
 		}
 	} else {
@@ -170,6 +179,9 @@ int psci_cpu_suspend_start(unsigned int idx,
 	if (psci_plat_pm_ops->pwr_domain_validate_suspend != NULL) {
 		rc = psci_plat_pm_ops->pwr_domain_validate_suspend(state_info);
 		if (rc != PSCI_E_SUCCESS) {
+#if PSCI_STAT_HIST
+			psci_stats_suspend_abort(idx);
+#endif
 			goto suspend_exit;
 		}
 	}
@@ -234,6 +246,10 @@ int psci_cpu_suspend_start(unsigned int idx,
 	    PMF_NO_CACHE_MAINT);
 #endif
 
+#if PSCI_STAT_HIST
+	psci_stats_suspend_wfi(idx);
+#endif
+
 	if (is_power_down_state != 0U) {
 		if (psci_plat_pm_ops->pwr_domain_pwr_down != NULL) {
 			/* This function may not return */
@@ -250,6 +266,10 @@ int psci_cpu_suspend_start(unsigned int idx,
 		wfi();
 	}
 
+#if PSCI_STAT_HIST
+	wake_ts = read_cntpct_el0();
+#endif
+
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
 	    RT_INSTR_EXIT_HW_LOW_PWR,
@@ -299,6 +319,13 @@ int psci_cpu_suspend_start(unsigned int idx,
 suspend_exit:
 	psci_release_pwr_domain_locks(end_pwrlvl, parent_nodes);
 
+#if PSCI_STAT_HIST
+	/* Account the suspend unless it was given up before the low power state */
+	if (wake_ts != 0ULL) {
+		psci_stats_suspend_exit(idx, wake_ts);
+	}
+#endif
+
 	return rc;
 }
 
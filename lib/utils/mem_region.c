@@ -1,14 +1,18 @@
 /*
- * Copyright (c) 2017-2020, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2025, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
+#include <lib/spinlock.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_compat.h>
+#include <plat/common/platform.h>
 
 /*
  * All the regions defined in mem_region_t must have the following properties
@@ -98,6 +102,194 @@ void clear_map_dyn_mem_regions(struct mem_region *regions,
 		}
 	}
 }
+
+/*
+ * State of the parallel scrub. The CPUs claim the slices in turn, and take
+ * the lock as well to update the translation tables, which the xlat library
+ * does not serialise. The zeroing itself runs without the lock.
+ */
+static struct {
+	struct mem_region *regions;
+	size_t nregions;
+	uintptr_t va;
+	size_t slice;
+	/* Number of windows of 'slice' bytes from 'va' */
+	unsigned int nwindows;
+	/* Next slice to claim */
+	size_t region;
+	size_t offset;
+	/* Progress, in bytes */
+	unsigned long long total;
+	unsigned long long done;
+	/* Number of CPUs which joined, and of those still scrubbing */
+	unsigned int joined;
+	unsigned int active;
+} scrub_job;
+
+static spinlock_t scrub_lock;
+
+/* Claim the next slice, with the lock held */
+static bool scrub_claim(uintptr_t *base, size_t *size)
+{
+	struct mem_region *region;
+
+	if (scrub_job.region == scrub_job.nregions) {
+		return false;
+	}
+
+	region = &scrub_job.regions[scrub_job.region];
+	*base = region->base + scrub_job.offset;
+	*size = MIN(region->nbytes - scrub_job.offset, scrub_job.slice);
+
+	scrub_job.offset += *size;
+	if (scrub_job.offset == region->nbytes) {
+		scrub_job.region++;
+		scrub_job.offset = 0U;
+	}
+
+	return true;
+}
+
+static void scrub_map(uintptr_t base, uintptr_t va, size_t size, bool map)
+{
+	const unsigned int attr = MT_MEMORY | MT_RW | MT_NS;
+	int r;
+
+	if (map) {
+		r = mmap_add_dynamic_region(base, va, size, attr);
+	} else {
+		r = mmap_remove_dynamic_region(va, size);
+	}
+
+	if (r != 0) {
+		INFO("PSCI: %s failed with %d\n", map ?
+		     "mmap_add_dynamic_region" : "mmap_remove_dynamic_region",
+		     r);
+		panic();
+	}
+}
+
+/*
+ * Scrub slices until none is left. When 'report' is set, the progress is
+ * logged every tenth of the total.
+ */
+static void scrub_work(bool report)
+{
+	uintptr_t va, base;
+	size_t size;
+	unsigned int step = 0U;
+
+	spin_lock(&scrub_lock);
+
+	/* Nothing to do if the scrub is over or all the windows are taken */
+	if ((scrub_job.regions == NULL) ||
+	    (scrub_job.joined == scrub_job.nwindows)) {
+		spin_unlock(&scrub_lock);
+		return;
+	}
+
+	va = scrub_job.va + (scrub_job.joined * scrub_job.slice);
+	scrub_job.joined++;
+	scrub_job.active++;
+
+	while (scrub_claim(&base, &size)) {
+		scrub_map(base, va, size, true);
+		spin_unlock(&scrub_lock);
+
+		zero_normalmem((void *)va, size);
+
+		spin_lock(&scrub_lock);
+		scrub_map(base, va, size, false);
+		scrub_job.done += size;
+
+		if (report && ((scrub_job.done * 10U) >=
+			       ((step + 1U) * scrub_job.total))) {
+			step = (unsigned int)((scrub_job.done * 10U) /
+					      scrub_job.total);
+			INFO("PSCI: Overwritten %llu of %llu MB\n",
+			     scrub_job.done >> 20, scrub_job.total >> 20);
+		}
+	}
+
+	scrub_job.active--;
+	spin_unlock(&scrub_lock);
+}
+
+void scrub_map_dyn_mem_regions(struct mem_region *regions,
+			       size_t nregions,
+			       uintptr_t va,
+			       size_t va_size,
+			       size_t slice)
+{
+	unsigned long long total = 0ULL, ticks, freq;
+	unsigned int joined, active;
+	uint64_t start;
+
+	assert(regions != NULL);
+	assert(nregions != 0U);
+	assert(slice != 0U);
+	assert((slice & PAGE_SIZE_MASK) == 0U);
+	assert(va_size >= slice);
+
+	for (unsigned int i = 0U; i < nregions; i++) {
+		if (((regions[i].base & PAGE_SIZE_MASK) != 0U) ||
+		    ((regions[i].nbytes & PAGE_SIZE_MASK) != 0U) ||
+		    (regions[i].nbytes == 0U)) {
+			INFO("PSCI: Not correctly aligned region\n");
+			panic();
+		}
+		total += regions[i].nbytes;
+	}
+
+	start = read_cntpct_el0();
+
+	spin_lock(&scrub_lock);
+	scrub_job.regions = regions;
+	scrub_job.nregions = nregions;
+	scrub_job.va = va;
+	scrub_job.slice = slice;
+	scrub_job.nwindows = (unsigned int)(va_size / slice);
+	scrub_job.region = 0U;
+	scrub_job.offset = 0U;
+	scrub_job.total = total;
+	scrub_job.done = 0ULL;
+	scrub_job.joined = 0U;
+	scrub_job.active = 0U;
+	spin_unlock(&scrub_lock);
+
+	plat_mem_scrub_start_secondaries();
+
+	scrub_work(true);
+
+	/* Wait for the other CPUs to complete their last slice */
+	do {
+		spin_lock(&scrub_lock);
+		active = scrub_job.active;
+		joined = scrub_job.joined;
+		if (active == 0U) {
+			scrub_job.regions = NULL;
+		}
+		spin_unlock(&scrub_lock);
+	} while (active != 0U);
+
+	ticks = read_cntpct_el0() - start;
+	freq = read_cntfrq_el0();
+	if ((ticks != 0ULL) && (freq != 0ULL)) {
+		INFO("PSCI: Overwritten %llu MB with %u CPUs in %llu ms "
+		     "(%llu MB/s)\n", total >> 20, joined,
+		     (ticks * 1000ULL) / freq, ((total >> 20) * freq) / ticks);
+	}
+}
+
+/*
+ * Join the parallel scrub in progress, if any, and return once there is no
+ * slice left to claim. This must be called with the MMU and data cache
+ * enabled, using the translation tables of the primary CPU.
+ */
+void scrub_mem_regions_secondary(void)
+{
+	scrub_work(false);
+}
 #endif
 
 /*
@@ -34,6 +34,16 @@ else # if AArch64
                  attributes, which is not possible once the translation tables \
                  have been made read-only.")
     endif
+    ifeq (${PMF_RING},1)
+        $(error "PMF_RING requires functionality from the dynamic \
+                 translation library and is incompatible with \
+                 ALLOW_RO_XLAT_TABLES.")
+    endif
+    ifeq (${PSCI_STAT_HIST},1)
+        $(error "PSCI_STAT_HIST requires functionality from the dynamic \
+                 translation library and is incompatible with \
+                 ALLOW_RO_XLAT_TABLES.")
+    endif
     ifeq (${SPMC_AT_EL3},1)
         $(error "EL3 SPMC requires functionality from the dynamic translation \
                  library and is incompatible with ALLOW_RO_XLAT_TABLES.")
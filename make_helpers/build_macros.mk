@@ -333,6 +333,9 @@ endef
 #   $(2) = source file (%.c)
 #   $(3) = library name
 #   $(4) = uppercase name of the library
+# The flags listed in <output directory name>_CFLAGS_REMOVE are removed from
+# TF_CFLAGS for the library, and the ones in <output directory name>_CFLAGS are
+# added to them.
 define MAKE_C_LIB
 $(eval OBJ := $(1)/$(patsubst %.c,%.o,$(notdir $(2))))
 $(eval DEP := $(patsubst %.o,%.d,$(OBJ)))
@@ -340,7 +343,7 @@ $(eval LIB := $(notdir $(1)))
 
 $(OBJ): $(2) $(filter-out %.d,$(MAKEFILE_LIST)) | $$$$(@D)/
 	$$(s)echo "  CC      $$<"
-	$$(q)$($(ARCH)-cc) $$($(LIB)_CFLAGS) $$(TF_CFLAGS) $$(CFLAGS) $(call MAKE_DEP,$(DEP),$(OBJ)) -c $$< -o $$@
+	$$(q)$($(ARCH)-cc) $$($(LIB)_CFLAGS) $$(filter-out $$($(LIB)_CFLAGS_REMOVE),$$(TF_CFLAGS)) $$(CFLAGS) $(call MAKE_DEP,$(DEP),$(OBJ)) -c $$< -o $$@
 
 -include $(DEP)
 
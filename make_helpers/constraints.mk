@@ -93,6 +93,30 @@ ifeq (${USE_DEBUGFS},1)
         endif
 endif #(USE_DEBUGFS)
 
+# PSCI_STAT_HIST extends the PSCI stats and exports them through a vendor
+# specific EL3 call
+ifeq (${PSCI_STAT_HIST},1)
+        ifneq (${ENABLE_PSCI_STAT}-${ARCH},1-aarch64)
+                $(error PSCI_STAT_HIST requires ENABLE_PSCI_STAT and AArch64)
+        endif
+endif #(PSCI_STAT_HIST)
+
+# PMF_RING records the PMF time-stamps of BL31 and drains them through a vendor
+# specific EL3 call
+ifeq (${PMF_RING},1)
+        ifneq (${ENABLE_PMF}-${ARCH},1-aarch64)
+                $(error PMF_RING requires ENABLE_PMF and AArch64)
+        endif
+endif #(PMF_RING)
+
+# SPINLOCK_STATS instruments the spinlocks of BL31 and exports the statistics
+# through a vendor specific EL3 call
+ifeq (${SPINLOCK_STATS},1)
+        ifneq (${ARCH},aarch64)
+                $(error SPINLOCK_STATS requires AArch64)
+        endif
+endif #(SPINLOCK_STATS)
+
 # USE_SPINLOCK_CAS requires AArch64 build
 ifeq (${USE_SPINLOCK_CAS},1)
         ifneq (${ARCH},aarch64)
@@ -151,6 +175,13 @@ ifeq ($(FAULT_INJECTION_SUPPORT),1)
 	endif
 endif #(FAULT_INJECTION_SUPPORT)
 
+# RAS_ERR_SCAN extends the RAS framework, which requires FEAT_RAS
+ifeq ($(RAS_ERR_SCAN),1)
+	ifeq ($(ENABLE_FEAT_RAS),0)
+                $(error For RAS_ERR_SCAN, ENABLE_FEAT_RAS must not be 0)
+	endif
+endif #(RAS_ERR_SCAN)
+
 # DYN_DISABLE_AUTH can be set only when TRUSTED_BOARD_BOOT=1
 ifeq ($(DYN_DISABLE_AUTH), 1)
 	ifeq (${TRUSTED_BOARD_BOOT}, 0)
@@ -232,6 +263,10 @@ ifneq (${DECRYPTION_SUPPORT},none)
                 $(error TRUSTED_BOARD_BOOT must be enabled for DECRYPTION_SUPPORT \
                 to be set)
 	endif
+	# The IO layer would use the crypto library while images are authenticated
+	ifeq (${BL2_CONCURRENT_LOAD}, 1)
+                $(error BL2_CONCURRENT_LOAD is not supported with DECRYPTION_SUPPORT)
+	endif
 endif #(DECRYPTION_SUPPORT)
 
 # Ensure that no Aarch64-only features are enabled in Aarch32 build
@@ -382,4 +417,17 @@ endif
 
 ifeq (${LFA_SUPPORT},1)
         $(warning LFA_SUPPORT is an experimental feature)
+
+        # The live activated BL31 initialises the runtime services again and
+        # only migrates the per-CPU contexts. The dispatchers below keep state
+        # beyond those, and the GIC is only reattached to by the generic driver.
+        ifeq (${USE_GIC_DRIVER},0)
+                $(error LFA_SUPPORT requires USE_GIC_DRIVER)
+        endif
+        ifneq (${SPD},none)
+                $(error LFA_SUPPORT cannot be used with SPD=${SPD})
+        endif
+        ifneq ($(filter 1,${ENABLE_RME} ${SDEI_SUPPORT} ${DRTM_SUPPORT} ${SPM_MM}),)
+                $(error LFA_SUPPORT cannot be used with ENABLE_RME, SDEI_SUPPORT, DRTM_SUPPORT or SPM_MM)
+        endif
 endif #(LFA_SUPPORT)
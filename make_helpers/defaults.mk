@@ -35,6 +35,9 @@ BASE_COMMIT			:= origin/master
 # Execute BL2 at EL3
 RESET_TO_BL2			:= 0
 
+# Load the images marked as independent concurrently on several CPUs in BL2
+BL2_CONCURRENT_LOAD		:= 0
+
 # Only use SP packages if SP layout JSON is defined
 BL2_ENABLE_SP_LOAD		:= 0
 
@@ -45,6 +48,9 @@ BL2_IN_XIP_MEM			:= 0
 # Do dcache invalidate upon BL2 entry at EL3
 BL2_INV_DCACHE			:= 1
 
+# Record the duration of the boot phases of BL1, BL2 and BL31
+BOOT_PROFILE			:= 0
+
 # Select the branch protection features to use.
 BRANCH_PROTECTION		:= 0
 
@@ -97,6 +103,9 @@ ENABLE_PIE			:= 0
 # Flag to enable Performance Measurement Framework
 ENABLE_PMF			:= 0
 
+# Flag to keep the PMF time-stamps captured by BL31 in per-CPU trace rings
+PMF_RING			:= 0
+
 # Flag to enable PSCI STATs functionality
 ENABLE_PSCI_STAT		:= 0
 
@@ -195,6 +204,9 @@ ifeq ($(KEY_ALG),rsa)
 KEY_SIZE			:= 2048
 endif
 
+# Capture log messages into per-CPU memory rings and defer their console output
+LOG_RING_BUFFER			:= 0
+
 # Option to build TF with Measured Boot support
 MEASURED_BOOT			:= 0
 
@@ -223,6 +235,12 @@ PSCI_EXTENDED_STATE_ID		:= 0
 # Enable PSCI OS-initiated mode support
 PSCI_OS_INIT_MODE		:= 0
 
+# Enable the vendor-specific EL3 call powering on several CPUs at once
+PSCI_CPU_ON_MANY		:= 0
+
+# Collect PSCI residency and latency histograms
+PSCI_STAT_HIST			:= 0
+
 # SMCCC_ARCH_FEATURE_AVAILABILITY support
 ARCH_FEATURE_AVAILABILITY	:= 0
 
@@ -235,6 +253,12 @@ SAVE_KEYS			:= 0
 # Software Delegated Exception support
 SDEI_SUPPORT			:= 0
 
+# Measure the SDEI dispatch latency
+SDEI_DISPATCH_STATS		:= 0
+
+# Collect the contention statistics of the instrumented spinlocks
+SPINLOCK_STATS			:= 0
+
 # True Random Number firmware Interface support
 TRNG_SUPPORT			:= 0
 
@@ -321,6 +345,10 @@ ALLOW_RO_XLAT_TABLES		:= 0
 # Chain of trust.
 COT				:= tbbr
 
+# Offload the crypto module operations to a platform registered hardware
+# accelerator, and account for the time spent in each operation.
+CRYPTO_ACCEL			:= 0
+
 # Use tbbr_oid.h instead of platform_oid.h
 USE_TBBR_DEFS			:= 1
 
@@ -358,6 +386,10 @@ ERRATA_SME_POWER_DOWN		:= 0
 # Trap RAS error record access from Non secure
 RAS_TRAP_NS_ERR_REC_ACCESS	:= 0
 
+# Handle Standard Error Record groups from summaries, rate limiting the
+# corrected errors
+RAS_ERR_SCAN			:= 0
+
 # Build option to create cot descriptors using fconf
 COT_DESC_IN_DTB			:= 0
 
@@ -1,13 +1,29 @@
 /*
- * Copyright (c) 2017, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2025, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <arch_helpers.h>
+#include <common/bl_common.h>
+#include <drivers/arm/fvp/fvp_pwrc.h>
+#include <plat/arm/common/arm_config.h>
 #include <plat/arm/common/plat_arm.h>
+#include <plat/common/platform.h>
 
 #include "fvp_private.h"
 
+#if BL2_CONCURRENT_LOAD
+/*
+ * The storage reads and the authentication of the images are each done by one
+ * CPU at a time, so one CPU helping the primary one is enough.
+ */
+#define FVP_BL2_LOAD_WORKERS	U(1)
+
+static u_register_t fvp_bl2_workers[FVP_BL2_LOAD_WORKERS];
+static unsigned int fvp_bl2_worker_count;
+#endif /* BL2_CONCURRENT_LOAD */
+
 void bl2_el3_early_platform_setup(u_register_t arg0 __unused,
 				  u_register_t arg1 __unused,
 				  u_register_t arg2 __unused,
@@ -28,3 +44,91 @@ void bl2_el3_early_platform_setup(u_register_t arg0 __unused,
 	 */
 	fvp_interconnect_enable();
 }
+
+#if BL2_CONCURRENT_LOAD
+/* Return the MPIDR of the CPU at a core position, see plat_arm_calc_core_pos */
+static u_register_t fvp_bl2_core_mpidr(unsigned int pos)
+{
+	unsigned int thread_id = pos % FVP_MAX_PE_PER_CPU;
+	unsigned int cpu_id = (pos / FVP_MAX_PE_PER_CPU) %
+			      FVP_MAX_CPUS_PER_CLUSTER;
+	unsigned int clus_id = pos / (FVP_MAX_PE_PER_CPU *
+				      FVP_MAX_CPUS_PER_CLUSTER);
+
+	if ((arm_config.flags & ARM_CONFIG_FVP_SHIFTED_AFF) != 0U) {
+		return ((u_register_t)clus_id << MPIDR_AFF2_SHIFT) |
+		       ((u_register_t)cpu_id << MPIDR_AFF1_SHIFT) |
+		       ((u_register_t)thread_id << MPIDR_AFF0_SHIFT);
+	}
+
+	return ((u_register_t)clus_id << MPIDR_AFF1_SHIFT) |
+	       ((u_register_t)cpu_id << MPIDR_AFF0_SHIFT);
+}
+
+/*
+ * Power on secondary CPUs to help the primary one load images. They enter
+ * BL2 at its entrypoint, which finds fvp_bl2_load_worker_entrypoint() in the
+ * trusted mailbox.
+ */
+unsigned int plat_bl2_start_load_workers(void)
+{
+	uintptr_t *mailbox = (void *)PLAT_ARM_TRUSTED_MAILBOX_BASE;
+	u_register_t mpidr, self = read_mpidr_el1() & MPIDR_AFFINITY_MASK;
+	unsigned int pos;
+
+	*mailbox = (uintptr_t)fvp_bl2_load_worker_entrypoint;
+	flush_dcache_range((uintptr_t)mailbox, sizeof(*mailbox));
+
+	for (pos = 0U; (pos < PLATFORM_CORE_COUNT) &&
+		       (fvp_bl2_worker_count < FVP_BL2_LOAD_WORKERS); pos++) {
+		/* Without the MT bit, each CPU has a single thread */
+		if (((arm_config.flags & ARM_CONFIG_FVP_SHIFTED_AFF) == 0U) &&
+		    ((pos % FVP_MAX_PE_PER_CPU) != 0U)) {
+			continue;
+		}
+
+		mpidr = fvp_bl2_core_mpidr(pos);
+		if ((mpidr == self) ||
+		    (fvp_pwrc_read_psysr(mpidr) == PSYSR_INVALID)) {
+			continue;
+		}
+
+		/* Let the CPU complete its power off from cold boot first */
+		while ((fvp_pwrc_read_psysr(mpidr) & PSYSR_AFF_L0) != 0U) {
+		}
+
+		fvp_pwrc_write_pponr(mpidr);
+		fvp_bl2_workers[fvp_bl2_worker_count] = mpidr;
+		fvp_bl2_worker_count++;
+	}
+
+	return fvp_bl2_worker_count;
+}
+
+/*
+ * Called by fvp_bl2_load_worker_entrypoint() on its stack. The CPU enters
+ * the coherency domain of the primary one and uses its translation tables.
+ */
+void fvp_bl2_load_worker(void)
+{
+	fvp_interconnect_enable();
+	enable_mmu_el3(0);
+
+	bl2_load_images_secondary();
+}
+
+/*
+ * BL31 may use the memory of BL2 once the CPUs which helped loading images
+ * are powered off.
+ */
+void bl2_el3_plat_prepare_exit(void)
+{
+	unsigned int i;
+
+	for (i = 0U; i < fvp_bl2_worker_count; i++) {
+		while ((fvp_pwrc_read_psysr(fvp_bl2_workers[i]) &
+			PSYSR_AFF_L0) != 0U) {
+		}
+	}
+}
+#endif /* BL2_CONCURRENT_LOAD */
@@ -22,4 +22,9 @@ void fvp_timer_init(void);
 void fvp_pcpu_init(void);
 void fvp_gic_driver_pre_init(void);
 
+#if BL2_CONCURRENT_LOAD
+void fvp_bl2_load_worker_entrypoint(void);
+void fvp_bl2_load_worker(void);
+#endif
+
 #endif /* FVP_PRIVATE_H */
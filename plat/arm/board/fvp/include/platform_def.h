@@ -200,6 +200,13 @@ SPD（Secure Payload Dispatcher）参数用于选择安全世界的管理组件
  */
 #define PLAT_ARM_MEM_PROTEC_VA_FRAME	UL(0xc0000000)
 
+/*
+ * Scrub the Non-secure memory for MEM_PROTECT in slices of 32MB. They are
+ * mapped with 2MB blocks in the level 2 table already covering the VA frame,
+ * so that no additional translation table is needed either.
+ */
+#define PLAT_ARM_MEM_PROT_SCRUB_SLICE	(UL(1) << 25)
+
 /* No SCP in FVP */
 /*
  * FVP 平台没有 SCP（System Control Processor），因此相关的宏定义被设置为 0。
@@ -852,6 +859,14 @@ V2M是Versatile Express Memory Map的缩写，特指ARM开发板的标准内存
 /* Mailbox base address */
 #define PLAT_ARM_TRUSTED_MAILBOX_BASE	ARM_TRUSTED_SRAM_BASE
 
+/*
+ * Boot profile records, in the second half of the shared RAM which BL1, BL2
+ * and BL31 all map. The mailbox is at the start of the shared RAM.
+ */
+#define PLAT_BOOT_PROF_BASE		(ARM_SHARED_RAM_BASE + \
+					 (ARM_SHARED_RAM_SIZE / 2U))
+#define PLAT_BOOT_PROF_SIZE		(ARM_SHARED_RAM_SIZE / 2U)
+
 /* PCIe memory region 1 (Base Platform RevC only) */
 #define PLAT_ARM_PCI_MEM_1_BASE		(ULL(0x50000000))
 #define PLAT_ARM_PCI_MEM_1_SIZE		(SZ_256M) /* 256MB */
@@ -317,6 +317,14 @@ BL2_SOURCES		+=	plat/arm/board/fvp/${ARCH}/fvp_helpers.S	\
 				${FVP_INTERCONNECT_SOURCES}
 endif
 
+# The CPUs helping BL2 to load images are powered on and run BL2 at EL3
+ifeq (${BL2_CONCURRENT_LOAD},1)
+ifneq (${RESET_TO_BL2},1)
+$(error "BL2_CONCURRENT_LOAD on FVP requires RESET_TO_BL2=1")
+endif
+BL2_SOURCES		+=	drivers/arm/fvp/fvp_pwrc.c
+endif
+
 ifeq (${USE_SP804_TIMER},1)
 BL2_SOURCES		+=	drivers/arm/sp804/sp804_delay_timer.c
 endif
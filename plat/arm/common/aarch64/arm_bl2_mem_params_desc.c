@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2025, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,6 +16,11 @@
  * populating the images in required loading order. The image execution
  * sequence is managed by populating the `next_handoff_image_id` with
  * the next executable image id.
+ *
+ * With BL2_CONCURRENT_LOAD, the images with IMAGE_ATTRIB_CONCURRENT are loaded
+ * concurrently: their load address and pre-load handling do not depend on the
+ * post-load handling of the images before them. The BL32 extra images depend
+ * on the BL32 post-load handling with OP-TEE, so they are loaded on their own.
  ******************************************************************************/
 static bl_mem_params_node_t bl2_mem_params_descs[] = {
 #ifdef SCP_BL2_BASE
@@ -71,7 +76,8 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 #endif
 
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_EP,
-			VERSION_2, image_info_t, IMAGE_ATTRIB_PLAT_SETUP),
+			VERSION_2, image_info_t,
+			IMAGE_ATTRIB_PLAT_SETUP | IMAGE_ATTRIB_CONCURRENT),
 		.image_info.image_base = BL31_BASE,
 		.image_info.image_max_size = BL31_LIMIT - BL31_BASE,
 
@@ -90,7 +96,8 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 			VERSION_2, entry_point_info_t,
 			NON_SECURE | NON_EXECUTABLE),
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_IMAGE_BINARY,
-			VERSION_2, image_info_t, IMAGE_ATTRIB_SKIP_LOADING),
+			VERSION_2, image_info_t,
+			IMAGE_ATTRIB_SKIP_LOADING | IMAGE_ATTRIB_CONCURRENT),
 		.next_handoff_image_id = INVALID_IMAGE_ID,
 	},
 	/* Fill SOC_FW_CONFIG related information */
@@ -99,7 +106,8 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 		SET_STATIC_PARAM_HEAD(ep_info, PARAM_IMAGE_BINARY,
 			VERSION_2, entry_point_info_t, SECURE | NON_EXECUTABLE),
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_IMAGE_BINARY,
-			VERSION_2, image_info_t, IMAGE_ATTRIB_SKIP_LOADING),
+			VERSION_2, image_info_t,
+			IMAGE_ATTRIB_SKIP_LOADING | IMAGE_ATTRIB_CONCURRENT),
 		.next_handoff_image_id = INVALID_IMAGE_ID,
 	},
 
@@ -111,7 +119,7 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 			VERSION_2, entry_point_info_t, EP_REALM | EXECUTABLE),
 		.ep_info.pc = RMM_BASE,
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_EP,
-			VERSION_2, image_info_t, 0),
+			VERSION_2, image_info_t, IMAGE_ATTRIB_CONCURRENT),
 		.image_info.image_base = RMM_BASE,
 		.image_info.image_max_size = RMM_LIMIT - RMM_BASE,
 		.next_handoff_image_id = BL33_IMAGE_ID,
@@ -128,7 +136,7 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 		.ep_info.pc = BL32_BASE,
 
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_EP,
-			VERSION_2, image_info_t, 0),
+			VERSION_2, image_info_t, IMAGE_ATTRIB_CONCURRENT),
 		.image_info.image_base = BL32_BASE,
 		.image_info.image_max_size = BL32_LIMIT - BL32_BASE,
 
@@ -203,7 +211,7 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 		.ep_info.pc = PLAT_ARM_NS_IMAGE_BASE,
 
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_EP,
-			VERSION_2, image_info_t, 0),
+			VERSION_2, image_info_t, IMAGE_ATTRIB_CONCURRENT),
 		.image_info.image_base = PLAT_ARM_NS_IMAGE_BASE,
 		.image_info.image_max_size = ARM_DRAM1_BASE + ARM_DRAM1_SIZE
 			- PLAT_ARM_NS_IMAGE_BASE,
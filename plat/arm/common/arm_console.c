@@ -8,6 +8,7 @@
 
 #include <platform_def.h>
 
+#include <common/boot_prof.h>
 #include <common/debug.h>
 #include <drivers/arm/pl011.h>
 #include <drivers/console.h>
@@ -30,10 +31,12 @@ void __init arm_console_boot_init(void)
 		return;
 	}
 
+	unsigned int prof = boot_prof_begin(BOOT_PROF_CONSOLE_INIT, 0U);
 	int rc = console_pl011_register(PLAT_ARM_BOOT_UART_BASE,
 					PLAT_ARM_BOOT_UART_CLK_IN_HZ,
 					ARM_CONSOLE_BAUDRATE,
 					&arm_boot_console);
+	boot_prof_end(prof);
 	if (rc == 0) {
 		/*
 		 * The crash console doesn't use the multi console API, it uses
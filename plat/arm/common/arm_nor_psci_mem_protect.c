@@ -92,6 +92,13 @@ int arm_nor_psci_write_mem_protect(int val)
  * 0xc0000000 is not used.
  */
 #if defined(PLAT_XLAT_TABLES_DYNAMIC)
+
+/* By default, only the primary CPU scrubs */
+#if defined(PLAT_ARM_MEM_PROT_SCRUB_SLICE) && \
+	!defined(PLAT_ARM_MEM_PROT_SCRUB_VA_SIZE)
+#define PLAT_ARM_MEM_PROT_SCRUB_VA_SIZE	PLAT_ARM_MEM_PROT_SCRUB_SLICE
+#endif
+
 void arm_nor_psci_do_dyn_mem_protect(void)
 {
 	int enable;
@@ -101,10 +108,23 @@ void arm_nor_psci_do_dyn_mem_protect(void)
 		return;
 
 	INFO("PSCI: Overwriting non secure memory\n");
+#if defined(PLAT_ARM_MEM_PROT_SCRUB_SLICE)
+	/*
+	 * Each CPU taking part in the scrub maps its slices in its own window
+	 * of PLAT_ARM_MEM_PROT_SCRUB_SLICE bytes from the VA frame, which
+	 * holds PLAT_ARM_MEM_PROT_SCRUB_VA_SIZE bytes.
+	 */
+	scrub_map_dyn_mem_regions(arm_ram_ranges,
+				  ARRAY_SIZE(arm_ram_ranges),
+				  PLAT_ARM_MEM_PROTEC_VA_FRAME,
+				  PLAT_ARM_MEM_PROT_SCRUB_VA_SIZE,
+				  PLAT_ARM_MEM_PROT_SCRUB_SLICE);
+#else
 	clear_map_dyn_mem_regions(arm_ram_ranges,
 				  ARRAY_SIZE(arm_ram_ranges),
 				  PLAT_ARM_MEM_PROTEC_VA_FRAME,
 				  1 << TWO_MB_SHIFT);
+#endif
 }
 #endif
 
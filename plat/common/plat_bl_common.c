@@ -31,6 +31,8 @@
 #pragma weak plat_is_smccc_feature_available
 #pragma weak plat_get_soc_version
 #pragma weak plat_get_soc_revision
+#pragma weak plat_mem_scrub_start_secondaries
+#pragma weak plat_bl2_start_load_workers
 
 int32_t plat_get_soc_version(void)
 {
@@ -51,6 +53,23 @@ void bl2_el3_plat_prepare_exit(void)
 {
 }
 
+/*
+ * Start the CPUs helping the primary one to scrub memory, see
+ * scrub_map_dyn_mem_regions(). By default the primary CPU scrubs alone.
+ */
+void plat_mem_scrub_start_secondaries(void)
+{
+}
+
+/*
+ * Start the CPUs helping the primary one to load images, see
+ * bl2_load_images(). By default the primary CPU loads all the images.
+ */
+unsigned int plat_bl2_start_load_workers(void)
+{
+	return 0U;
+}
+
 void __dead2 plat_error_handler(int err)
 {
 	while (1) {
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025, Rockchip, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+
+#include <common/debug.h>
+#include <drivers/scmi-msg.h>
+#include <drivers/scmi.h>
+
+#include "scmi_perf.h"
+
+#pragma weak rockchip_scmi_perf_count
+#pragma weak rockchip_scmi_perf_get_clock_id
+
+struct rk_scmi_perf {
+	struct scmi_perf_level levels[RK_SCMI_PERF_MAX_LEVELS];
+	unsigned long rates[RK_SCMI_PERF_MAX_LEVELS];
+	size_t nb_levels;
+};
+
+static struct rk_scmi_perf perf_table[RK_SCMI_PERF_MAX_DOMAINS];
+
+size_t rockchip_scmi_perf_count(unsigned int agent_id __unused)
+{
+	return 0;
+}
+
+uint32_t rockchip_scmi_perf_get_clock_id(unsigned int agent_id __unused,
+					 unsigned int scmi_id __unused)
+{
+	return 0;
+}
+
+/* The levels are the same for all agents, only agent 0 is described */
+static struct rk_scmi_perf *rockchip_scmi_get_perf(unsigned int agent_id,
+						   unsigned int scmi_id)
+{
+	if (scmi_id >= rockchip_scmi_perf_count(agent_id) ||
+	    perf_table[scmi_id].nb_levels == 0U)
+		return NULL;
+
+	return &perf_table[scmi_id];
+}
+
+void rockchip_init_scmi_perf(void)
+{
+	struct rk_scmi_perf *perf;
+	size_t count = rockchip_scmi_perf_count(0);
+	uint32_t clock_id;
+	size_t i, n;
+
+	assert(count <= RK_SCMI_PERF_MAX_DOMAINS);
+
+	for (i = 0U; i < count; i++) {
+		perf = &perf_table[i];
+		clock_id = rockchip_scmi_perf_get_clock_id(0, i);
+
+		if (plat_scmi_clock_rates_array(0, clock_id, NULL, &n, 0) !=
+		    SCMI_SUCCESS || n == 0U || n > RK_SCMI_PERF_MAX_LEVELS) {
+			WARN("SCMI perf %zu: clock %u has no usable rates\n",
+			     i, clock_id);
+			continue;
+		}
+
+		if (plat_scmi_clock_rates_array(0, clock_id, perf->rates, &n,
+						0) != SCMI_SUCCESS)
+			continue;
+
+		/* Rate tables are sorted by increasing rate */
+		for (perf->nb_levels = 0U; perf->nb_levels < n;
+		     perf->nb_levels++) {
+			perf->levels[perf->nb_levels].level =
+				perf->rates[perf->nb_levels] / 1000U;
+		}
+	}
+}
+
+size_t plat_scmi_perf_count(unsigned int agent_id)
+{
+	return rockchip_scmi_perf_count(agent_id);
+}
+
+const char *plat_scmi_perf_get_name(unsigned int agent_id,
+				    unsigned int scmi_id)
+{
+	if (rockchip_scmi_get_perf(agent_id, scmi_id) == NULL)
+		return NULL;
+
+	return plat_scmi_clock_get_name(agent_id,
+			rockchip_scmi_perf_get_clock_id(agent_id, scmi_id));
+}
+
+int32_t plat_scmi_perf_get_levels(unsigned int agent_id, unsigned int scmi_id,
+				  const struct scmi_perf_level **levels,
+				  size_t *nb_levels)
+{
+	struct rk_scmi_perf *perf;
+
+	perf = rockchip_scmi_get_perf(agent_id, scmi_id);
+	if (perf == NULL)
+		return SCMI_NOT_FOUND;
+
+	*levels = perf->levels;
+	*nb_levels = perf->nb_levels;
+
+	return SCMI_SUCCESS;
+}
+
+uint32_t plat_scmi_perf_get_level(unsigned int agent_id, unsigned int scmi_id)
+{
+	if (rockchip_scmi_get_perf(agent_id, scmi_id) == NULL)
+		return 0;
+
+	return plat_scmi_clock_get_rate(agent_id,
+			rockchip_scmi_perf_get_clock_id(agent_id, scmi_id)) /
+	       1000U;
+}
+
+int32_t plat_scmi_perf_set_level(unsigned int agent_id, unsigned int scmi_id,
+				 uint32_t level)
+{
+	struct rk_scmi_perf *perf;
+	size_t i;
+
+	perf = rockchip_scmi_get_perf(agent_id, scmi_id);
+	if (perf == NULL)
+		return SCMI_NOT_FOUND;
+
+	/* Use the exact rate of the table the level was derived from */
+	for (i = 0U; i < perf->nb_levels; i++) {
+		if (perf->levels[i].level == level)
+			return plat_scmi_clock_set_rate(agent_id,
+				rockchip_scmi_perf_get_clock_id(agent_id,
+								scmi_id),
+				perf->rates[i]);
+	}
+
+	return SCMI_OUT_OF_RANGE;
+}
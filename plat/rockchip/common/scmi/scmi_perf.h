@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, Rockchip, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RK_SCMI_PERF_H
+#define RK_SCMI_PERF_H
+
+#include <stdint.h>
+
+#include <common.h>
+
+/* Performance domains are backed by SCMI clocks with a rate table */
+#define RK_SCMI_PERF_MAX_DOMAINS	4U
+#define RK_SCMI_PERF_MAX_LEVELS		16U
+
+/*
+ * Return number of performance domains for an agent
+ * @agent_id: SCMI agent ID
+ * Return number of performance domains
+ */
+size_t rockchip_scmi_perf_count(unsigned int agent_id);
+
+/*
+ * Get the SCMI clock backing a performance domain. The performance levels of
+ * the domain are the rates of the clock, in kHz.
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI performance domain ID
+ * Return the SCMI clock ID
+ */
+uint32_t rockchip_scmi_perf_get_clock_id(unsigned int agent_id,
+					 unsigned int scmi_id);
+
+/* Build the performance levels of the domains from the clock rate tables */
+void rockchip_init_scmi_perf(void);
+
+#endif /* RK_SCMI_PERF_H */
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025, Rockchip, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <drivers/scmi-msg.h>
+#include <drivers/scmi.h>
+#include <lib/utils_def.h>
+
+#include "rk3588_clk.h"
+#include <scmi_perf.h>
+
+#define MAX_PROTOCOL_IN_LIST		8U
+
+const uint8_t rockchip_scmi_protocol_table[1][MAX_PROTOCOL_IN_LIST] = {
+	{
+		SCMI_PROTOCOL_ID_CLOCK,
+		SCMI_PROTOCOL_ID_RESET_DOMAIN,
+		SCMI_PROTOCOL_ID_PERF,
+		0
+	}
+};
+
+/* One performance domain per CPU cluster */
+static const uint32_t perf_clock_table[] = {
+	SCMI_CLK_CPUL,
+	SCMI_CLK_CPUB01,
+	SCMI_CLK_CPUB23,
+};
+
+size_t rockchip_scmi_perf_count(unsigned int agent_id __unused)
+{
+	return ARRAY_SIZE(perf_clock_table);
+}
+
+uint32_t rockchip_scmi_perf_get_clock_id(unsigned int agent_id __unused,
+					 unsigned int scmi_id)
+{
+	return perf_clock_table[scmi_id];
+}
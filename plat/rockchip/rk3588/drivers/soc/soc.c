@@ -20,6 +20,7 @@
 
 #include <plat_private.h>
 #include <rk3588_clk.h>
+#include <scmi_perf.h>
 #include <secure.h>
 #include <soc.h>
 
@@ -96,4 +97,5 @@ void plat_rockchip_soc_init(void)
 	system_reset_init();
 	sgrf_init();
 	rockchip_init_scmi_server();
+	rockchip_init_scmi_perf();
 }
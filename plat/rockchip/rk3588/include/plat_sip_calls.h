@@ -7,6 +7,14 @@
 #ifndef __PLAT_SIP_CALLS_H__
 #define __PLAT_SIP_CALLS_H__
 
-#define RK_PLAT_SIP_NUM_CALLS	0
+#define RK_PLAT_SIP_NUM_CALLS	1
+
+/*
+ * Get the latency of the SCMI performance level changes requested through
+ * messages if x1 is 0, or through fastchannels otherwise. The counters are
+ * reset once read if x2 is not 0. Returns the number of changes, and their
+ * total and maximum latency in system counter ticks, in x1-x3.
+ */
+#define RK_SIP_SCMI_PERF_LATENCY	0xC2000011
 
 #endif /* __PLAT_SIP_CALLS_H__ */
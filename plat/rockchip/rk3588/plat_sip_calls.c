@@ -25,6 +25,14 @@ uintptr_t rockchip_plat_sip_handler(uint32_t smc_fid,
 		scmi_smt_fastcall_smc_entry(0);
 		SMC_RET1(handle, 0);
 
+	case RK_SIP_SCMI_PERF_LATENCY: {
+		struct scmi_perf_latency latency;
+
+		scmi_perf_get_latency(x1 != 0U, &latency, x2 != 0U);
+		SMC_RET4(handle, RK_SIP_E_SUCCESS, latency.count,
+			 latency.total, latency.max);
+	}
+
 	default:
 		ERROR("%s: unhandled SMC (0x%x)\n", __func__, smc_fid);
 		SMC_RET1(handle, SMC_UNK);
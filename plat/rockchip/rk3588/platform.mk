@@ -56,6 +56,7 @@ BL31_SOURCES		+=	${RK_GIC_SOURCES}				\
 				drivers/scmi-msg/base.c				\
 				drivers/scmi-msg/clock.c			\
 				drivers/scmi-msg/entry.c			\
+				drivers/scmi-msg/perf.c				\
 				drivers/scmi-msg/reset_domain.c			\
 				drivers/scmi-msg/smt.c				\
 				lib/cpus/aarch64/cortex_a55.S			\
@@ -71,6 +72,7 @@ BL31_SOURCES		+=	${RK_GIC_SOURCES}				\
 				${RK_PLAT_COMMON}/rockchip_sip_svc.c		\
 				${RK_PLAT_COMMON}/scmi/scmi.c			\
 				${RK_PLAT_COMMON}/scmi/scmi_clock.c		\
+				${RK_PLAT_COMMON}/scmi/scmi_perf.c		\
 				${RK_PLAT_COMMON}/scmi/scmi_rstd.c		\
 				${RK_PLAT_SOC}/plat_sip_calls.c         	\
 				${RK_PLAT_SOC}/drivers/secure/secure.c		\
@@ -78,6 +80,7 @@ BL31_SOURCES		+=	${RK_GIC_SOURCES}				\
 				${RK_PLAT_SOC}/drivers/pmu/pmu.c		\
 				${RK_PLAT_SOC}/drivers/pmu/pm_pd_regs.c		\
 				${RK_PLAT_SOC}/drivers/scmi/rk3588_clk.c	\
+				${RK_PLAT_SOC}/drivers/scmi/rk3588_perf.c	\
 				${RK_PLAT_SOC}/drivers/scmi/rk3588_rstd.c
 
 CTX_INCLUDE_AARCH32_REGS :=     0
@@ -122,20 +122,30 @@ int plat_mboot_measure_image(unsigned int image_id, image_info_t *image_data)
 {
 	int rc = 0;
 
-	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
+	unsigned char digests[HASH_ALG_COUNT][CRYPTO_MD_MAX_SIZE];
 	const event_log_metadata_t *metadata_ptr = rpi3_event_log_metadata;
+#if DISCRETE_TPM
+	uint16_t alg_id, digest_size;
+	unsigned int bank;
+#endif
 
-	/* Measure the payload with algorithm selected by EventLog driver */
-	rc = event_log_measure(image_data->image_base, image_data->image_size, hash_data);
+	/* Measure the payload with algorithms selected by EventLog driver */
+	rc = event_log_measure_banks(image_data->image_base, image_data->image_size, digests);
 	if (rc != 0) {
 		return rc;
 	}
 
 #if DISCRETE_TPM
-	rc = tpm_pcr_extend(&tpm_chip_data, 0, TPM_ALG_ID, hash_data, TCG_DIGEST_SIZE);
-	if (rc != 0) {
-		ERROR("BL2: TPM PCR-0 extend failed\n");
-		panic();
+	/* Extend every bank recorded in the Event Log */
+	for (bank = 0U; bank < HASH_ALG_COUNT; bank++) {
+		event_log_get_bank(bank, &alg_id, &digest_size);
+		rc = tpm_pcr_extend(&tpm_chip_data, 0, alg_id, digests[bank],
+				    digest_size);
+		if (rc != 0) {
+			ERROR("BL2: TPM PCR-0 extend failed (alg 0x%x)\n",
+			      alg_id);
+			panic();
+		}
 	}
 #endif
 
@@ -145,7 +155,7 @@ int plat_mboot_measure_image(unsigned int image_id, image_info_t *image_data)
 	}
 	assert(metadata_ptr->id != EVLOG_INVALID_ID);
 
-	event_log_record(hash_data, EV_POST_CODE, metadata_ptr);
+	event_log_record(&digests[0][0], EV_POST_CODE, metadata_ptr);
 
 	return rc;
 }
@@ -660,7 +660,11 @@ REGISTER_CRYPTO_LIB("stm32_crypto_lib",
 		    crypto_verify_signature,
 		    crypto_verify_hash,
 		    NULL,
+		    NULL,
 		    crypto_auth_decrypt,
+		    NULL,
+		    NULL,
+		    NULL,
 		    crypto_convert_pk,
 		    NULL);
 
@@ -671,6 +675,10 @@ REGISTER_CRYPTO_LIB("stm32_crypto_lib",
 		    crypto_verify_hash,
 		    NULL,
 		    NULL,
+		    NULL,
+		    NULL,
+		    NULL,
+		    NULL,
 		    crypto_convert_pk,
 		    NULL);
 #endif
@@ -9,11 +9,17 @@
 #include <common/debug.h>
 #include <common/runtime_svc.h>
 #include <lib/debugfs.h>
+#include <lib/extensions/ras.h>
 #include <lib/pmf/pmf.h>
+#include <lib/psci/psci.h>
+#include <lib/spinlock.h>
 #if PLAT_ARM_ACS_SMC_HANDLER
 #include <plat/arm/common/plat_acs_smc_handler.h>
 #endif /* PLAT_ARM_ACS_SMC_HANDLER */
+#include <services/sdei.h>
 #include <services/spm_mm_svc.h>
+#include <services/spmc_svc.h>
+#include <services/trng_svc.h>
 #include <services/ven_el3_svc.h>
 #include <tools_share/uuid.h>
 
@@ -75,6 +81,142 @@ static uintptr_t ven_el3_svc_handler(unsigned int smc_fid,
 
 #endif /* ENABLE_PMF */
 
+#if PSCI_CPU_ON_MANY
+	/*
+	 * Power on the requested CPUs, returning the targets for which the
+	 * power on was issued alongside the PSCI status.
+	 */
+	if (is_psci_cpu_on_many_fid(smc_fid)) {
+		u_register_t started;
+		int rc;
+
+		/* Like PSCI, only serve the Normal world */
+		if (is_caller_secure(flags)) {
+			SMC_RET1(handle, SMC_UNK);
+		}
+
+		rc = psci_cpu_on_many(x1, x2,
+			(unsigned int)SMC_GET_GP(handle, CTX_GPREG_X5),
+			x3, x4, &started);
+		SMC_RET2(handle, (u_register_t)rc, started);
+	}
+#endif /* PSCI_CPU_ON_MANY */
+
+#if PSCI_STAT_HIST
+	/*
+	 * Return a whole distribution collected on a CPU, packing two 32-bit
+	 * buckets per register.
+	 */
+	if (is_psci_stat_hist_fid(smc_fid)) {
+		uint32_t b[PSCI_STAT_HIST_BUCKETS];
+		int rc;
+
+		rc = psci_stat_hist(x1, (unsigned int)x2, (unsigned int)x3, b);
+		SMC_RET8(handle, (u_register_t)rc,
+			 ((u_register_t)b[1] << 32) | b[0],
+			 ((u_register_t)b[3] << 32) | b[2],
+			 ((u_register_t)b[5] << 32) | b[4],
+			 ((u_register_t)b[7] << 32) | b[6],
+			 ((u_register_t)b[9] << 32) | b[8],
+			 ((u_register_t)b[11] << 32) | b[10],
+			 ((u_register_t)b[13] << 32) | b[12]);
+	}
+
+	/*
+	 * Copy the distributions of all the CPUs to a Normal world buffer,
+	 * returning the size of the dump.
+	 */
+	if (is_psci_stat_hist_dump_fid(smc_fid)) {
+		size_t len;
+		int rc;
+
+		rc = psci_stat_hist_dump((uintptr_t)x1, (size_t)x2, &len);
+		SMC_RET2(handle, (u_register_t)rc, len);
+	}
+#endif /* PSCI_STAT_HIST */
+
+#if SPINLOCK_STATS
+	/*
+	 * Return the statistics of a registered lock, with the first eight
+	 * characters of its name.
+	 */
+	if (is_spinlock_stats_fid(smc_fid)) {
+		stat_spinlock_info_t info;
+		const char *name;
+		u_register_t tag = 0U;
+		unsigned int i;
+
+		if (stat_spinlock_get((unsigned int)x1, (unsigned int)x2,
+				      &info, &name) != 0) {
+			SMC_RET1(handle, SMC_INVALID_PARAM);
+		}
+
+		for (i = 0U; (i < sizeof(tag)) && (name[i] != '\0'); i++) {
+			tag |= (u_register_t)(uint8_t)name[i] << (i * 8U);
+		}
+
+		SMC_RET8(handle, SMC_OK, info.acquisitions, info.contended,
+			 info.spins, info.hold_total, info.hold_max,
+			 info.wait_max, tag);
+	}
+#endif /* SPINLOCK_STATS */
+
+#if SDEI_SUPPORT && SDEI_DISPATCH_STATS
+	/* Return the SDEI dispatch statistics of a PE */
+	if (is_sdei_dispatch_stats_fid(smc_fid)) {
+		uint64_t count, ticks_total, ticks_max;
+
+		if (sdei_get_dispatch_stats((unsigned int)x1, &count,
+					    &ticks_total, &ticks_max) != 0) {
+			SMC_RET1(handle, SMC_INVALID_PARAM);
+		}
+
+		SMC_RET4(handle, SMC_OK, count, ticks_total, ticks_max);
+	}
+#endif /* SDEI_SUPPORT && SDEI_DISPATCH_STATS */
+
+#if RAS_ERR_SCAN
+	/* Return the scanning statistics of an error record group */
+	if (is_ras_scan_stats_fid(smc_fid)) {
+		struct err_record_scan stats;
+
+		if (ras_get_scan_stats((unsigned int)x1, &stats) != 0) {
+			SMC_RET1(handle, SMC_INVALID_PARAM);
+		}
+
+		SMC_RET6(handle, SMC_OK, stats.n_scans, stats.n_records,
+			 stats.n_coalesced, stats.ticks_total,
+			 stats.ticks_max);
+	}
+#endif /* RAS_ERR_SCAN */
+
+#if SPMC_AT_EL3
+	/* Return the FF-A v1.0 descriptor conversion statistics of the SPMC */
+	if (is_spmc_shmem_stats_fid(smc_fid)) {
+		uint64_t conversions, conversions_avoided;
+
+		spmc_shmem_get_stats(&conversions, &conversions_avoided);
+
+		SMC_RET3(handle, SMC_OK, conversions, conversions_avoided);
+	}
+#endif /* SPMC_AT_EL3 */
+
+#if TRNG_SUPPORT
+	/* Return the entropy pool statistics of a CPU */
+	if (is_trng_pool_stats_fid(smc_fid)) {
+		struct trng_pool_stats stats;
+
+		if (trng_entropy_pool_get_stats((unsigned int)x1, &stats) != 0) {
+			SMC_RET1(handle, SMC_INVALID_PARAM);
+		}
+
+		SMC_SET_GP(handle, CTX_GPREG_X8, stats.source_ticks);
+		SMC_RET8(handle, SMC_OK, stats.requests, stats.bits_served,
+			 stats.pool_hits, stats.refills, stats.source_words,
+			 stats.source_failures, stats.source_contended);
+	}
+#endif /* TRNG_SUPPORT */
+
 #if PLAT_ARM_ACS_SMC_HANDLER
 	/*
 	 * Dispatch ACS calls to ACS SMC handler and return its return value
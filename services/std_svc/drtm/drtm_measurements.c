@@ -40,7 +40,7 @@ static int drtm_event_log_measure_and_record(uintptr_t data_base,
 					     unsigned int pcr)
 {
 	int rc;
-	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
+	unsigned char digests[HASH_ALG_COUNT][CRYPTO_MD_MAX_SIZE];
 	event_log_metadata_t metadata = {0};
 
 	metadata.name = event_name;
@@ -48,15 +48,15 @@ static int drtm_event_log_measure_and_record(uintptr_t data_base,
 
 	/*
 	 * Measure the payloads requested by D-CRTM and DCE components
-	 * Hash algorithm decided by the Event Log driver at build-time
+	 * Hash algorithms decided by the Event Log driver at build-time
 	 */
-	rc = event_log_measure(data_base, data_size, hash_data);
+	rc = event_log_measure_banks(data_base, data_size, digests);
 	if (rc != 0) {
 		return rc;
 	}
 
 	/* Record the mesasurement in the EventLog buffer */
-	rc = event_log_record(hash_data, event_type, &metadata);
+	rc = event_log_record(&digests[0][0], event_type, &metadata);
 	if (rc != 0) {
 		return rc;
 	}
@@ -4,19 +4,356 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <bl31/bl31.h>
+#include <common/debug.h>
+#include <drivers/arm/gic.h>
+#include <drivers/console.h>
+#include <lib/el3_runtime/context_mgmt.h>
+#include <lib/psci/psci_lib.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
 #include <services/bl31_lfa.h>
+#include <services/lfa_holding_pen.h>
 #include <services/lfa_svc.h>
 
+#pragma weak plat_lfa_bl31_get_staged_image
+#pragma weak plat_lfa_bl31_get_handoff
+
+/* Cold entry point of the image validated by the last PRIME call */
+static uintptr_t staged_entry;
+
+/* Set on the new image once the migrated state has been restored */
+static bool activation_resumed;
+static spinlock_t resume_lock;
+
+/*
+ * Default implementations for platforms that do not support live activation
+ * of BL31. A platform that does must provide both functions.
+ */
+int plat_lfa_bl31_get_staged_image(uintptr_t *base, size_t *size,
+				   uintptr_t *entry, u_register_t *args)
+{
+	return -ENOTSUP;
+}
+
+void *plat_lfa_bl31_get_handoff(size_t *size)
+{
+	return NULL;
+}
+
+static struct lfa_bl31_handoff *lfa_bl31_get_handoff(void)
+{
+	size_t size = 0U;
+	void *handoff = plat_lfa_bl31_get_handoff(&size);
+
+	if ((handoff == NULL) || (size < sizeof(struct lfa_bl31_handoff))) {
+		return NULL;
+	}
+
+	return handoff;
+}
+
+static unsigned long long lfa_bl31_ticks_to_us(uint64_t ticks)
+{
+	return (ticks * 1000000ULL) / read_cntfrq_el0();
+}
+
+/*
+ * Copy the contexts of all the security states of the calling CPU into the
+ * handoff. The non-secure context is updated so that the LFA_ACTIVATE call
+ * completes successfully once it is resumed by the new image.
+ */
+static void lfa_bl31_save_cpu(struct lfa_bl31_handoff *handoff,
+			      unsigned int cpu_idx)
+{
+	cpu_context_t *ctx;
+	unsigned int ss;
+
+	for (ss = 0U; ss < CPU_CONTEXT_NUM; ss++) {
+		ctx = cm_get_context_by_index(cpu_idx, ss);
+		handoff->ctx_valid[cpu_idx][ss] = (ctx != NULL);
+		if (ctx == NULL) {
+			continue;
+		}
+
+		(void)memcpy(&handoff->ctx[cpu_idx][ss], ctx, sizeof(*ctx));
+	}
+
+	ctx = &handoff->ctx[cpu_idx][NON_SECURE];
+	write_ctx_reg(get_gpregs_ctx(ctx), CTX_GPREG_X0, LFA_SUCCESS);
+	write_ctx_reg(get_gpregs_ctx(ctx), CTX_GPREG_X1, 0ULL);
+
+	handoff->cpu_valid[cpu_idx] = true;
+}
+
+static void lfa_bl31_restore_cpu(struct lfa_bl31_handoff *handoff,
+				 unsigned int cpu_idx)
+{
+	cpu_context_t *ctx;
+	unsigned int ss;
+
+	for (ss = 0U; ss < CPU_CONTEXT_NUM; ss++) {
+		if (!handoff->ctx_valid[cpu_idx][ss]) {
+			continue;
+		}
+
+		ctx = cm_get_context_by_index(cpu_idx, ss);
+		if (ctx == NULL) {
+			WARN("LFA: no context for CPU%u security state %u\n",
+			     cpu_idx, ss);
+			continue;
+		}
+
+		(void)memcpy(ctx, &handoff->ctx[cpu_idx][ss], sizeof(*ctx));
+	}
+}
+
+/*
+ * Account for a CPU which completed the activation. The last one reports the
+ * activation latency and retires the handoff.
+ */
+static void lfa_bl31_cpu_resumed(struct lfa_bl31_handoff *handoff)
+{
+	uint64_t ts_first = UINT64_MAX;
+	uint64_t ts_last = 0ULL;
+	uint64_t ts_done;
+	unsigned int i;
+	bool done;
+
+	spin_lock(&resume_lock);
+	handoff->cpus_resumed += 1U;
+	done = (handoff->cpus_resumed == handoff->cpu_count);
+	spin_unlock(&resume_lock);
+
+	if (!done) {
+		return;
+	}
+
+	ts_done = read_cntpct_el0();
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (!handoff->cpu_valid[i]) {
+			continue;
+		}
+
+		ts_first = MIN(ts_first, handoff->ts_entry[i]);
+		ts_last = MAX(ts_last, handoff->ts_entry[i]);
+	}
+
+	NOTICE("LFA: BL31 activated on %u CPUs in %lluus\n",
+	       handoff->cpu_count,
+	       lfa_bl31_ticks_to_us(ts_done - ts_first));
+	INFO("LFA:  rendezvous %lluus, handoff %lluus, jump %lluus, resume %lluus\n",
+	     lfa_bl31_ticks_to_us(ts_last - ts_first),
+	     lfa_bl31_ticks_to_us(handoff->ts_jump - ts_last),
+	     lfa_bl31_ticks_to_us(handoff->ts_resume - handoff->ts_jump),
+	     lfa_bl31_ticks_to_us(ts_done - handoff->ts_resume));
+
+	handoff->magic = 0ULL;
+	flush_dcache_range((uintptr_t)handoff, sizeof(*handoff));
+}
+
+/*
+ * Called on the cold boot path of a BL31 image to find out whether it has
+ * been entered through a live activation rather than a regular boot.
+ */
+bool lfa_bl31_activation_in_progress(void)
+{
+	struct lfa_bl31_handoff *handoff = lfa_bl31_get_handoff();
+
+	return (handoff != NULL) &&
+	       (handoff->magic == LFA_BL31_HANDOFF_MAGIC) &&
+	       (handoff->cold_entry == (uintptr_t)bl31_entrypoint);
+}
+
+/*
+ * Restore the state migrated from the previous image on the new image. This
+ * runs on the primary CPU once the runtime services have been initialised, so
+ * that all the per-CPU contexts have been allocated.
+ */
+void lfa_bl31_primary_finish(void)
+{
+	struct lfa_bl31_handoff *handoff = lfa_bl31_get_handoff();
+	unsigned int i;
+
+	assert(handoff != NULL);
+
+	handoff->ts_resume = read_cntpct_el0();
+
+	if ((handoff->version != LFA_BL31_HANDOFF_VERSION) ||
+	    (handoff->ctx_size != (uint32_t)sizeof(cpu_context_t))) {
+		ERROR("LFA: incompatible BL31 handoff (version %u, ctx %u)\n",
+		      handoff->version, handoff->ctx_size);
+		panic();
+	}
+
+	assert(handoff->primary_idx == plat_my_core_pos());
+
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (handoff->cpu_valid[i]) {
+			lfa_bl31_restore_cpu(handoff, i);
+		}
+	}
+
+	/* Resume the LFA_ACTIVATE call of the normal world */
+	cm_set_next_eret_context(NON_SECURE);
+
+	activation_resumed = true;
+	lfa_bl31_cpu_resumed(handoff);
+}
+
+/*
+ * Called from bl31_entrypoint() once the primary CPU has cleaned the data of
+ * the new image, at which point the secondary CPUs can safely enter it.
+ */
+void lfa_bl31_release_secondaries(void)
+{
+	struct lfa_bl31_handoff *handoff;
+
+	if (!activation_resumed) {
+		return;
+	}
+
+	handoff = lfa_bl31_get_handoff();
+	assert(handoff != NULL);
+
+	handoff->warm_entry = (uintptr_t)bl31_lfa_warm_entrypoint;
+	dsbish();
+	sev();
+}
+
+/*
+ * Entered by the secondary CPUs on the new image, with the MMU enabled.
+ */
+void lfa_bl31_warm_finish(void)
+{
+	struct lfa_bl31_handoff *handoff = lfa_bl31_get_handoff();
+	unsigned int cpu_idx = plat_my_core_pos();
+
+	assert(handoff != NULL);
+	assert(handoff->cpu_valid[cpu_idx]);
+
+	/* Init registers that never change for the lifetime of TF-A */
+	cm_manage_extensions_el3(cpu_idx);
+
+#if USE_GIC_DRIVER
+	/* The redistributor of this CPU is still configured, only locate it */
+	gic_pcpu_attach(cpu_idx);
+#endif
+
+	psci_set_cpu_running_safe(cpu_idx);
+
+	cm_set_next_eret_context(NON_SECURE);
+
+	lfa_bl31_cpu_resumed(handoff);
+}
+
 static int32_t lfa_bl31_prime(struct lfa_component_status *activation)
 {
-	return LFA_WRONG_STATE;
+	struct lfa_bl31_handoff *handoff;
+	u_register_t args[4] = { 0U };
+	uintptr_t base, entry;
+	size_t size;
+	int ret;
+
+	handoff = lfa_bl31_get_handoff();
+	if (handoff == NULL) {
+		ERROR("LFA: no handoff region for BL31 activation\n");
+		return LFA_NO_MEMORY;
+	}
+
+	/*
+	 * The new image has been loaded and authenticated by
+	 * plat_lfa_load_auth_image(), only locate it here.
+	 */
+	ret = plat_lfa_bl31_get_staged_image(&base, &size, &entry, args);
+	if (ret != 0) {
+		return (ret == -ENOTSUP) ? LFA_NOT_SUPPORTED : LFA_DEVICE_ERROR;
+	}
+
+	if ((size == 0U) || (entry < base) || ((entry - base) >= size)) {
+		ERROR("LFA: invalid staged BL31 image\n");
+		return LFA_INVALID_ADDRESS;
+	}
+
+	/* The running image is not overwritten, it is needed until the jump */
+	if ((base < BL31_LIMIT) && ((base + size) > BL31_BASE)) {
+		ERROR("LFA: staged BL31 image overlaps the running image\n");
+		return LFA_INVALID_ADDRESS;
+	}
+
+	/* The new image is entered with the MMU and caches disabled */
+	flush_dcache_range(base, size);
+
+	zeromem(handoff, sizeof(*handoff));
+	(void)memcpy(handoff->boot_args, args, sizeof(handoff->boot_args));
+	staged_entry = entry;
+
+	return LFA_SUCCESS;
 }
 
 static int32_t lfa_bl31_activate(struct lfa_component_status *activation,
 		uint64_t ep_address,
 		uint64_t context_id)
 {
-	return LFA_WRONG_STATE;
+	struct lfa_bl31_handoff *handoff = lfa_bl31_get_handoff();
+	unsigned int cpu_idx = plat_my_core_pos();
+	enum lfa_retc ret;
+	unsigned int i;
+
+	if ((handoff == NULL) || (staged_entry == 0U)) {
+		return LFA_WRONG_STATE;
+	}
+
+	handoff->ts_entry[cpu_idx] = read_cntpct_el0();
+	lfa_bl31_save_cpu(handoff, cpu_idx);
+
+	if (!lfa_holding_start()) {
+		ret = lfa_holding_wait();
+		if (ret != LFA_SUCCESS) {
+			return ret;
+		}
+
+		/* Wait for the new image to be ready for the secondary CPUs */
+		while (handoff->warm_entry == 0U) {
+			wfe();
+		}
+
+		bl31_lfa_jump(handoff->warm_entry, 0U, 0U, 0U, 0U);
+	}
+
+	/* Last CPU to enter the holding pen, finalise the handoff */
+	handoff->magic = LFA_BL31_HANDOFF_MAGIC;
+	handoff->version = LFA_BL31_HANDOFF_VERSION;
+	handoff->ctx_size = (uint32_t)sizeof(cpu_context_t);
+	handoff->primary_idx = cpu_idx;
+	handoff->cold_entry = staged_entry;
+	handoff->warm_entry = 0U;
+	handoff->cpus_resumed = 0U;
+	handoff->cpu_count = 0U;
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		if (handoff->cpu_valid[i]) {
+			handoff->cpu_count++;
+		}
+	}
+	INFO("LFA: activating BL31 at 0x%lx on %u CPUs\n", staged_entry,
+	     handoff->cpu_count);
+	console_flush();
+
+	handoff->ts_jump = read_cntpct_el0();
+	flush_dcache_range((uintptr_t)handoff, sizeof(*handoff));
+
+	lfa_holding_release(LFA_SUCCESS);
+
+	bl31_lfa_jump(staged_entry, handoff->boot_args[0],
+		      handoff->boot_args[1], handoff->boot_args[2],
+		      handoff->boot_args[3]);
 }
 
 static struct lfa_component_ops bl31_activator = {
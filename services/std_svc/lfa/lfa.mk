@@ -7,6 +7,7 @@
 LFA_SOURCES	+=	$(addprefix services/std_svc/lfa/, \
 			  lfa_main.c \
 			  bl31_lfa.c \
+			  aarch64/bl31_lfa_helpers.S \
 			  lfa_holding_pen.c)
 
 ifeq (${ENABLE_RME}, 1)
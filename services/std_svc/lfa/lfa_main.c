@@ -188,6 +188,9 @@ static int lfa_prime(uint32_t component_id, uint64_t *flags)
 
 	ret = plat_lfa_load_auth_image(component_id);
 	ret = convert_to_lfa_error(ret);
+	if (ret != LFA_SUCCESS) {
+		return ret;
+	}
 
 	activator = lfa_components[component_id].activator;
 	if (activator->prime != NULL) {
@@ -94,6 +94,81 @@ uint64_t target_pe)
 	return &cpu_priv_base[idx];
 }
 
+/*
+ * Index of the mappings by interrupt number, covering the SGI, PPI and SPI
+ * ranges. An entry holds the position of the mapping in its table plus one, or
+ * zero when no mapping is bound to the interrupt. The table a position refers
+ * to follows from the interrupt type: SPIs only back shared events, SGIs and
+ * PPIs only back private ones.
+ *
+ * SDEI_DYN_IRQ, which marks free dynamic slots and explicit events, is never
+ * indexed.
+ */
+static uint8_t intr_index[PLAT_SDEI_INTR_INDEX_SIZE];
+
+static bool is_intr_indexed(unsigned int intr_num)
+{
+	return (intr_num != SDEI_DYN_IRQ) &&
+		(intr_num < PLAT_SDEI_INTR_INDEX_SIZE);
+}
+
+/* Record that 'map' is now bound to its interrupt */
+void sdei_index_bind(const sdei_ev_map_t *map)
+{
+	const sdei_mapping_t *mapping;
+	uint8_t *entry;
+
+	if (!is_intr_indexed(map->intr))
+		return;
+
+	/* Keep the first mapping of an interrupt, as a linear search would */
+	entry = &intr_index[map->intr];
+	if (*entry != 0U)
+		return;
+
+	mapping = ((map->map_flags & BIT_32(SDEI_MAPF_PRIVATE_SHIFT_)) != 0U) ?
+		SDEI_PRIVATE_MAPPING() : SDEI_SHARED_MAPPING();
+	*entry = (uint8_t) (MAP_OFF(map, mapping) + 1);
+}
+
+/* Drop 'map' from the index ahead of releasing its interrupt */
+void sdei_index_release(const sdei_ev_map_t *map)
+{
+	const sdei_mapping_t *mapping;
+	unsigned int pos;
+
+	if (!is_intr_indexed(map->intr))
+		return;
+
+	mapping = ((map->map_flags & BIT_32(SDEI_MAPF_PRIVATE_SHIFT_)) != 0U) ?
+		SDEI_PRIVATE_MAPPING() : SDEI_SHARED_MAPPING();
+	pos = intr_index[map->intr];
+	if ((pos != 0U) && (&mapping->map[pos - 1U] == map))
+		intr_index[map->intr] = 0U;
+}
+
+/*
+ * Build the interrupt index from the platform mappings. This must run once the
+ * platform has populated its mappings, and before any event is bound.
+ */
+void sdei_index_init(void)
+{
+	const sdei_mapping_t *mapping;
+	sdei_ev_map_t *map;
+	unsigned int i, j;
+
+	zeromem(intr_index, sizeof(intr_index));
+
+	for_each_mapping_type(i, mapping) {
+		/* Positions must fit in an index entry */
+		assert(mapping->num_maps < UINT8_MAX);
+
+		iterate_mapping(mapping, j, map) {
+			sdei_index_bind(map);
+		}
+	}
+}
+
 /*
  * Find event mapping for a given interrupt number: On success, returns pointer
  * to the event mapping. On error, returns NULL.
@@ -102,14 +177,30 @@ sdei_ev_map_t *find_event_map_by_intr(unsigned int intr_num, bool shared)
 {
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
-	unsigned int i;
+	unsigned int i, pos;
+
+	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
+
+	/*
+	 * Interrupts in the indexed range are looked up directly. A binding
+	 * that races with this lookup may leave the entry momentarily empty or
+	 * out of step with the mapping, in which case the linear search
+	 * decides.
+	 */
+	if (is_intr_indexed(intr_num)) {
+		pos = intr_index[intr_num];
+		if ((pos != 0U) && (pos <= mapping->num_maps)) {
+			map = &mapping->map[pos - 1U];
+			if (map->intr == intr_num)
+				return map;
+		}
+	}
 
 	/*
 	 * Look for a match in private and shared mappings, as requested. This
-	 * is a linear search. However, if the mappings are required to be
-	 * sorted, for large maps, we could consider binary search.
+	 * is a linear search, used for the interrupts out of the indexed range,
+	 * when the index misses and for the free dynamic slots.
 	 */
-	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
 	iterate_mapping(mapping, i, map) {
 		if (map->intr == intr_num)
 			return map;
@@ -126,17 +217,26 @@ sdei_ev_map_t *find_event_map(int ev_num)
 {
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
-	unsigned int i, j;
+	unsigned int i;
+	size_t lo, hi, mid;
 
 	/*
-	 * Iterate through mappings to find a match. This is a linear search.
-	 * However, if the mappings are required to be sorted, for large maps,
-	 * we could consider binary search.
+	 * Both mappings are sorted in the increasing order of event number, so
+	 * each is looked up with a binary search.
 	 */
 	for_each_mapping_type(i, mapping) {
-		iterate_mapping(mapping, j, map) {
+		lo = 0U;
+		hi = mapping->num_maps;
+		while (lo < hi) {
+			mid = lo + ((hi - lo) / 2U);
+			map = &mapping->map[mid];
 			if (map->ev_num == ev_num)
 				return map;
+
+			if (map->ev_num < ev_num)
+				lo = mid + 1U;
+			else
+				hi = mid;
 		}
 	}
 
@@ -5,6 +5,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <stdint.h>
 #include <string.h>
@@ -54,11 +55,66 @@ typedef struct sdei_cpu_state {
 	unsigned short stack_top; /* Empty ascending */
 	bool pe_masked;
 	bool pending_enables;
+#if SDEI_DISPATCH_STATS
+	/* Latency from SDEI entry to the hand-off to the client, in ticks */
+	uint64_t dispatch_count;
+	uint64_t dispatch_ticks_total;
+	uint64_t dispatch_ticks_max;
+#endif
 } sdei_cpu_state_t;
 
 /* SDEI states for all cores in the system */
 static sdei_cpu_state_t cpu_state[PLATFORM_CORE_COUNT];
 
+#if SDEI_DISPATCH_STATS
+static uint64_t ticks_to_us(uint64_t ticks)
+{
+	return (ticks * 1000000ULL) / read_cntfrq_el0();
+}
+
+/* Account a dispatch that began at 'start' and is about to leave EL3 */
+static void account_dispatch(sdei_cpu_state_t *state,
+		const sdei_ev_map_t *map, uint64_t start)
+{
+	uint64_t ticks = read_cntpct_el0() - start;
+
+	state->dispatch_count++;
+	state->dispatch_ticks_total += ticks;
+	if (ticks > state->dispatch_ticks_max)
+		state->dispatch_ticks_max = ticks;
+
+	SDEI_LOG("ev:0x%x dispatch latency %lluus (max %lluus avg %lluus)\n",
+		 map->ev_num, (unsigned long long) ticks_to_us(ticks),
+		 (unsigned long long) ticks_to_us(state->dispatch_ticks_max),
+		 (unsigned long long) ticks_to_us(state->dispatch_ticks_total /
+			 state->dispatch_count));
+}
+
+/*
+ * Return the dispatch statistics of a PE. These are updated without any
+ * synchronisation by their PE, so the values read from another PE may be
+ * slightly out of date.
+ */
+int sdei_get_dispatch_stats(unsigned int cpu_idx, uint64_t *count,
+		uint64_t *ticks_total, uint64_t *ticks_max)
+{
+	const sdei_cpu_state_t *state;
+
+	assert((count != NULL) && (ticks_total != NULL) &&
+	       (ticks_max != NULL));
+
+	if (cpu_idx >= PLATFORM_CORE_COUNT)
+		return -EINVAL;
+
+	state = &cpu_state[cpu_idx];
+	*count = state->dispatch_count;
+	*ticks_total = state->dispatch_ticks_total;
+	*ticks_max = state->dispatch_ticks_max;
+
+	return 0;
+}
+#endif
+
 bool sdei_is_target_pe_masked(uint64_t target_pe)
 {
 	int errstat = plat_core_pos_by_mpidr(target_pe);
@@ -376,6 +432,9 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	uint32_t intr;
 	jmp_buf dispatch_jmp;
 	const uint64_t mpidr = read_mpidr_el1();
+#if SDEI_DISPATCH_STATS
+	const uint64_t start = read_cntpct_el0();
+#endif
 
 	/*
 	 * To handle an event, the following conditions must be true:
@@ -509,6 +568,9 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 
 	/* Synchronously dispatch event */
 	setup_ns_dispatch(map, se, ctx, &dispatch_jmp);
+#if SDEI_DISPATCH_STATS
+	account_dispatch(state, map, start);
+#endif
 	begin_sdei_synchronous_dispatch(&dispatch_jmp);
 
 	/*
@@ -557,6 +619,9 @@ int sdei_dispatch_event(int ev_num)
 	sdei_dispatch_context_t *disp_ctx;
 	sdei_cpu_state_t *state;
 	jmp_buf dispatch_jmp;
+#if SDEI_DISPATCH_STATS
+	const uint64_t start = read_cntpct_el0();
+#endif
 
 	/* Can't dispatch if events are masked on this PE */
 	state = sdei_get_this_pe_state();
@@ -609,6 +674,9 @@ int sdei_dispatch_event(int ev_num)
 
 	/* Dispatch event synchronously */
 	setup_ns_dispatch(map, se, ns_ctx, &dispatch_jmp);
+#if SDEI_DISPATCH_STATS
+	account_dispatch(state, map, start);
+#endif
 	begin_sdei_synchronous_dispatch(&dispatch_jmp);
 
 	/*
@@ -34,6 +34,15 @@
 # error Platform must define SDEI normal priority value
 #endif
 
+/*
+ * Interrupts below this number are mapped to their event through a direct
+ * index. The default covers the SGI, PPI and SPI ranges; mappings to other
+ * interrupts are found with a linear search.
+ */
+#ifndef PLAT_SDEI_INTR_INDEX_SIZE
+# define PLAT_SDEI_INTR_INDEX_SIZE	1020U
+#endif
+
 /* Output SDEI logs as verbose */
 #define SDEI_LOG(...)	VERBOSE("SDEI: " __VA_ARGS__)
 
@@ -230,6 +239,9 @@ extern sdei_entry_t sdei_shared_event_table[];
 
 void init_sdei_state(void);
 
+void sdei_index_init(void);
+void sdei_index_bind(const sdei_ev_map_t *map);
+void sdei_index_release(const sdei_ev_map_t *map);
 sdei_ev_map_t *find_event_map_by_intr(unsigned int intr_num, bool shared);
 sdei_ev_map_t *find_event_map(int ev_num);
 sdei_entry_t *get_event_entry(const sdei_ev_map_t *map);
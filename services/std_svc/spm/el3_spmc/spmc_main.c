@@ -316,10 +316,11 @@ static bool direct_msg_validate_lp_resp(uint16_t origin_id, uint16_t lp_id,
 	}
 
 	/*
-	 * Check the destination ID is valid and ensure the LP is responding to
-	 * the original request.
+	 * Ensure the LP is responding to the original request. The origin has
+	 * been validated with the request, so this also ensures the
+	 * destination ID is valid.
 	 */
-	if ((!direct_msg_validate_dst_id(dst_id)) || (dst_id != origin_id)) {
+	if (dst_id != origin_id) {
 		ERROR("Invalid EL3 LP destination ID (0x%x).\n", dst_id);
 		return false;
 	}
@@ -347,6 +348,63 @@ static bool direct_msg_receivable(uint32_t properties, uint16_t dir_req_fnum)
 	return true;
 }
 
+/*******************************************************************************
+ * EL3 Logical Partitions are the target of frequent direct requests from the
+ * normal world. Their descriptors are condensed at init into a table of
+ * receivers holding only what the request path needs, with the direct message
+ * properties precomputed into flags. The table is written once on the primary
+ * CPU before any direct request can be received, so no lock is required.
+ ******************************************************************************/
+#define LP_RECV_DIRECT_REQ		BIT(0)
+#define LP_RECV_DIRECT_REQ2		BIT(1)
+
+struct el3_lp_receiver {
+	uint16_t sp_id;
+	uint16_t recv_flags;
+	direct_msg_handler direct_req;
+};
+
+static struct el3_lp_receiver el3_lp_receivers[MAX_EL3_LP_DESCS_COUNT];
+static unsigned int el3_lp_receiver_count;
+
+static void el3_lp_receivers_init(void)
+{
+	struct el3_lp_desc *el3_lp_descs = get_el3_lp_array();
+	struct el3_lp_receiver *recv;
+
+	for (unsigned int i = 0U; i < EL3_LP_DESCS_COUNT; i++) {
+		recv = &el3_lp_receivers[i];
+		recv->sp_id = el3_lp_descs[i].sp_id;
+		recv->direct_req = el3_lp_descs[i].direct_req;
+		recv->recv_flags = 0U;
+
+		if (recv->direct_req == NULL) {
+			continue;
+		}
+		if (direct_msg_receivable(el3_lp_descs[i].properties,
+					  FFA_FNUM_MSG_SEND_DIRECT_REQ)) {
+			recv->recv_flags |= LP_RECV_DIRECT_REQ;
+		}
+		if (direct_msg_receivable(el3_lp_descs[i].properties,
+					  FFA_FNUM_MSG_SEND_DIRECT_REQ2)) {
+			recv->recv_flags |= LP_RECV_DIRECT_REQ2;
+		}
+	}
+
+	el3_lp_receiver_count = EL3_LP_DESCS_COUNT;
+}
+
+static struct el3_lp_receiver *el3_lp_receiver_get(uint16_t sp_id)
+{
+	for (unsigned int i = 0U; i < el3_lp_receiver_count; i++) {
+		if (el3_lp_receivers[i].sp_id == sp_id) {
+			return &el3_lp_receivers[i];
+		}
+	}
+
+	return NULL;
+}
+
 /*******************************************************************************
  * Handle direct request messages and route to the appropriate destination.
  ******************************************************************************/
@@ -363,12 +421,19 @@ static uint64_t direct_req_smc_handler(uint32_t smc_fid,
 	uint16_t src_id = ffa_endpoint_source(x1);
 	uint16_t dst_id = ffa_endpoint_destination(x1);
 	uint16_t dir_req_funcid;
-	struct el3_lp_desc *el3_lp_descs;
+	uint16_t lp_recv_flag;
+	struct el3_lp_receiver *lp;
 	struct secure_partition_desc *sp;
 	unsigned int idx;
+	uint64_t ret;
 
-	dir_req_funcid = (smc_fid != FFA_MSG_SEND_DIRECT_REQ2_SMC64) ?
-		FFA_FNUM_MSG_SEND_DIRECT_REQ : FFA_FNUM_MSG_SEND_DIRECT_REQ2;
+	if (smc_fid != FFA_MSG_SEND_DIRECT_REQ2_SMC64) {
+		dir_req_funcid = FFA_FNUM_MSG_SEND_DIRECT_REQ;
+		lp_recv_flag = LP_RECV_DIRECT_REQ;
+	} else {
+		dir_req_funcid = FFA_FNUM_MSG_SEND_DIRECT_REQ2;
+		lp_recv_flag = LP_RECV_DIRECT_REQ2;
+	}
 
 	/*
 	 * Sanity check for DIRECT_REQ:
@@ -387,26 +452,24 @@ static uint64_t direct_req_smc_handler(uint32_t smc_fid,
 					FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	el3_lp_descs = get_el3_lp_array();
-
-	/* Check if the request is destined for a Logical Partition. */
-	for (unsigned int i = 0U; i < MAX_EL3_LP_DESCS_COUNT; i++) {
-		if (el3_lp_descs[i].sp_id == dst_id) {
-			if (!direct_msg_receivable(el3_lp_descs[i].properties, dir_req_funcid)) {
-				return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
-			}
-
-			uint64_t ret = el3_lp_descs[i].direct_req(
-						smc_fid, secure_origin, x1, x2,
-						x3, x4, cookie, handle, flags);
-			if (!direct_msg_validate_lp_resp(src_id, dst_id,
-							 handle)) {
-				panic();
-			}
+	/*
+	 * Check if the request is destined for a Logical Partition. If so, it
+	 * is handled in place without looking up any SP context.
+	 */
+	lp = el3_lp_receiver_get(dst_id);
+	if (lp != NULL) {
+		if ((lp->recv_flags & lp_recv_flag) == 0U) {
+			return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+		}
 
-			/* Message checks out. */
-			return ret;
+		ret = lp->direct_req(smc_fid, secure_origin, x1, x2, x3, x4,
+				     cookie, handle, flags);
+		if (!direct_msg_validate_lp_resp(src_id, dst_id, handle)) {
+			panic();
 		}
+
+		/* Message checks out. */
+		return ret;
 	}
 
 	/*
@@ -1155,23 +1218,15 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 						FFA_ERROR_INVALID_PARAMETER);
 		}
 	} else {
-		struct ffa_partition_info_v1_1 partitions[MAX_SP_LP_PARTITIONS];
+		uint32_t buf_size;
+		uint32_t populated = 0U;
 
 		/*
 		 * Handle the case where the partition descriptors are required,
 		 * check we have the buffers available and populate the
 		 * appropriate structure version.
 		 */
-
-		/* Obtain the v1.1 format of the descriptors. */
-		ret = partition_info_get_handler_v1_1(uuid, partitions,
-						      MAX_SP_LP_PARTITIONS,
-						      &partition_count);
-
-		/* Check if an error occurred during discovery. */
-		if (ret != 0) {
-			goto err;
-		}
+		partition_count = partition_info_get_handler_count_only(uuid);
 
 		/* If we didn't find any matches the UUID is unknown. */
 		if (partition_count == 0) {
@@ -1198,16 +1253,25 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 			goto err_unlock;
 		}
 
-		/* Zero the RX buffer before populating. */
-		(void)memset(mbox->rx_buffer, 0,
-			     mbox->rxtx_page_count * FFA_PAGE_SIZE);
+		buf_size = mbox->rxtx_page_count * FFA_PAGE_SIZE;
 
 		/*
 		 * Depending on the FF-A version of the requesting partition
-		 * we may need to convert to a v1.0 format otherwise we can copy
-		 * directly.
+		 * we may need to convert to a v1.0 format otherwise the
+		 * descriptors are populated in place in the RX buffer.
 		 */
 		if (ffa_version == MAKE_FFA_VERSION(U(1), U(0))) {
+			struct ffa_partition_info_v1_1
+				partitions[MAX_SP_LP_PARTITIONS];
+
+			/* Obtain the v1.1 format of the descriptors. */
+			ret = partition_info_get_handler_v1_1(uuid, partitions,
+						MAX_SP_LP_PARTITIONS,
+						&populated);
+			if (ret != 0) {
+				goto err_unlock;
+			}
+
 			ret = partition_info_populate_v1_0(partitions,
 							   mbox,
 							   partition_count);
@@ -1215,8 +1279,9 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 				goto err_unlock;
 			}
 		} else {
-			uint32_t buf_size = mbox->rxtx_page_count *
-					    FFA_PAGE_SIZE;
+			struct ffa_partition_info_v1_1 *partitions =
+				(struct ffa_partition_info_v1_1 *)
+				mbox->rx_buffer;
 
 			/* Ensure the descriptor will fit in the buffer. */
 			size = sizeof(struct ffa_partition_info_v1_1);
@@ -1224,8 +1289,15 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 				ret = FFA_ERROR_NO_MEMORY;
 				goto err_unlock;
 			}
-			memcpy(mbox->rx_buffer, partitions,
-			       partition_count * size);
+
+			/* Zero the descriptors before populating them. */
+			(void)memset(partitions, 0, partition_count * size);
+			ret = partition_info_get_handler_v1_1(uuid, partitions,
+							      partition_count,
+							      &populated);
+			if (ret != 0) {
+				goto err_unlock;
+			}
 		}
 
 		mbox->state = MAILBOX_STATE_FULL;
@@ -2223,6 +2295,8 @@ static int32_t logical_sp_init(void)
 			      el3_lp_descs[i].sp_id);
 	}
 
+	el3_lp_receivers_init();
+
 	INFO("Logical Secure Partition init completed.\n");
 
 	return rc;
@@ -2350,6 +2424,7 @@ int32_t spmc_setup(void)
 		return ret;
 	}
 	memset(spmc_shmem_obj_state.data, 0, spmc_shmem_obj_state.data_size);
+	stat_spinlock_register(&spmc_shmem_obj_state.lock, "spmc_shmem");
 
 	/* Setup logical SPs. */
 	ret = logical_sp_init();
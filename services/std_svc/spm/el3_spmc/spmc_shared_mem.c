@@ -13,6 +13,7 @@
 #include <lib/spinlock.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
 #include <services/ffa_svc.h>
+#include <services/spmc_svc.h>
 #include "spmc.h"
 #include "spmc_shared_mem.h"
 
@@ -24,12 +25,15 @@
  * @desc_filled:    Size of @desc already received.
  * @in_use:         Number of clients that have called ffa_mem_retrieve_req
  *                  without a matching ffa_mem_relinquish call.
+ * @v1_0_desc_size: Size of the FF-A v1.0 layout of @desc, stored after @desc
+ *                  once a v1.0 client has retrieved it, 0 until then.
  * @desc:           FF-A memory region descriptor passed in ffa_mem_share.
  */
 struct spmc_shmem_obj {
 	size_t desc_size;
 	size_t desc_filled;
 	size_t in_use;
+	size_t v1_0_desc_size;
 	struct ffa_mtd desc;
 };
 
@@ -57,6 +61,18 @@ static size_t spmc_shmem_obj_size(size_t desc_size)
 	return desc_size + offsetof(struct spmc_shmem_obj, desc);
 }
 
+/**
+ * spmc_shmem_obj_footprint - Get the size an object takes in the datastore.
+ * @obj:        Object to get the size of.
+ *
+ * Return: Size of @obj, including the FF-A v1.0 layout of its descriptor.
+ */
+static size_t spmc_shmem_obj_footprint(const struct spmc_shmem_obj *obj)
+{
+	return spmc_shmem_obj_size(obj->desc_size +
+				   round_up(obj->v1_0_desc_size, 16U));
+}
+
 /**
  * spmc_shmem_obj_alloc - Allocate struct spmc_shmem_obj.
  * @state:      Global state.
@@ -106,6 +122,7 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 	obj->desc_size = desc_size;
 	obj->desc_filled = 0;
 	obj->in_use = 0;
+	obj->v1_0_desc_size = 0;
 	state->allocated += obj_size;
 	return obj;
 }
@@ -126,7 +143,7 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 				  struct spmc_shmem_obj *obj)
 {
-	size_t free_size = spmc_shmem_obj_size(obj->desc_size);
+	size_t free_size = spmc_shmem_obj_footprint(obj);
 	uint8_t *shift_dest = (uint8_t *)obj;
 	uint8_t *shift_src = shift_dest + free_size;
 	size_t shift_size = state->allocated - (shift_src - state->data);
@@ -156,7 +173,7 @@ spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 		if (obj->desc.handle == handle) {
 			return obj;
 		}
-		curr += spmc_shmem_obj_size(obj->desc_size);
+		curr += spmc_shmem_obj_footprint(obj);
 	}
 	return NULL;
 }
@@ -178,7 +195,7 @@ spmc_shmem_obj_get_next(struct spmc_shmem_obj_state *state, size_t *offset)
 	if (curr - state->data < state->allocated) {
 		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
 
-		*offset += spmc_shmem_obj_size(obj->desc_size);
+		*offset += spmc_shmem_obj_footprint(obj);
 
 		return obj;
 	}
@@ -519,18 +536,18 @@ spmc_shm_convert_shmem_obj_from_v1_0(struct spmc_shmem_obj *out_obj,
 
 /**
  * spmc_shm_convert_mtd_to_v1_0 - Converts a given v1.1 memory object to
- *                                v1.0 memory object.
- * @out_obj:    The shared memory object to populate the v1.0 descriptor.
+ *                                v1.0 memory transaction descriptor.
+ * @out:        The buffer to populate the v1.0 descriptor.
+ * @out_size:   The size of @out.
  * @orig:       The shared memory object containing the v1.1 descriptor.
  *
  * Return: true if the conversion is successful else false.
  */
 static bool
-spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
+spmc_shm_convert_mtd_to_v1_0(struct ffa_mtd_v1_0 *out, size_t out_size,
 			     struct spmc_shmem_obj *orig)
 {
 	struct ffa_mtd *mtd_orig = &orig->desc;
-	struct ffa_mtd_v1_0 *out = (struct ffa_mtd_v1_0 *) &out_obj->desc;
 	struct ffa_emad_v1_0 *emad_in;
 	struct ffa_emad_v1_0 *emad_array_in;
 	struct ffa_emad_v1_0 *emad_array_out;
@@ -608,7 +625,7 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
 	if ((uintptr_t)((uint8_t *) mrd_in + mrd_size) >
 	     (uintptr_t)((uint8_t *) mtd_orig + orig->desc_size) ||
 	    ((uintptr_t)((uint8_t *) mrd_out + mrd_size) >
-	     (uintptr_t)((uint8_t *) out + out_obj->desc_size))) {
+	     (uintptr_t)((uint8_t *) out + out_size))) {
 		ERROR("%s: Invalid mrd structure.\n", __func__);
 		return false;
 	}
@@ -620,9 +637,76 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
 }
 
 /**
- * spmc_populate_ffa_v1_0_descriptor - Converts a given v1.1 memory object to
- *                                     the v1.0 format and populates the
- *                                     provided buffer.
+ * spmc_shmem_obj_get_v1_0_desc - Get the FF-A v1.0 layout of a memory object.
+ * @state:      Global state.
+ * @obj:        Object containing the v1.1 ffa_memory_region_descriptor.
+ * @ret:        Will be populated with the FF-A error code on failure.
+ *
+ * The descriptor of a memory object does not change once it has been fully
+ * received, so it is converted to the v1.0 format on its first retrieval by a
+ * v1.0 client only, and the result is kept after the v1.1 descriptor for the
+ * following retrievals and fragments. Other objects may move when the v1.0
+ * layout is added, but @obj does not.
+ *
+ * Return: the v1.0 descriptor, or %NULL if it could not be converted.
+ */
+static struct ffa_mtd_v1_0 *
+spmc_shmem_obj_get_v1_0_desc(struct spmc_shmem_obj_state *state,
+			     struct spmc_shmem_obj *obj, uint32_t *ret)
+{
+	struct ffa_mtd_v1_0 *out = (struct ffa_mtd_v1_0 *)
+				   ((uint8_t *)&obj->desc + obj->desc_size);
+	uint8_t *shift_src = (uint8_t *)obj + spmc_shmem_obj_footprint(obj);
+	size_t shift_size = state->allocated - (shift_src - state->data);
+	size_t v1_0_desc_size;
+	size_t extra_size;
+
+	if (obj->v1_0_desc_size != 0U) {
+		state->v1_0_conversions_avoided++;
+		return out;
+	}
+
+	/* Calculate the size that the v1.0 descriptor will require. */
+	v1_0_desc_size = spmc_shm_get_v1_0_descriptor_size(&obj->desc,
+							   obj->desc_size);
+	if (v1_0_desc_size == 0U) {
+		ERROR("%s: cannot determine size of descriptor.\n", __func__);
+		*ret = FFA_ERROR_INVALID_PARAMETER;
+		return NULL;
+	}
+
+	extra_size = round_up(v1_0_desc_size, 16U);
+	if (extra_size > (state->data_size - state->allocated)) {
+		WARN("%s(0x%zx) failed, free 0x%zx\n", __func__,
+		     v1_0_desc_size, state->data_size - state->allocated);
+		*ret = FFA_ERROR_NO_MEMORY;
+		return NULL;
+	}
+
+	/* Make room for the v1.0 descriptor after the v1.1 one. */
+	if (shift_size != 0U) {
+		memmove(shift_src + extra_size, shift_src, shift_size);
+	}
+
+	if (!spmc_shm_convert_mtd_to_v1_0(out, v1_0_desc_size, obj)) {
+		if (shift_size != 0U) {
+			memmove(shift_src, shift_src + extra_size, shift_size);
+		}
+		*ret = FFA_ERROR_INVALID_PARAMETER;
+		return NULL;
+	}
+
+	obj->v1_0_desc_size = v1_0_desc_size;
+	state->allocated += extra_size;
+	state->v1_0_conversions++;
+
+	return out;
+}
+
+/**
+ * spmc_populate_ffa_v1_0_descriptor - Populates the provided buffer with the
+ *                                     v1.0 format of a given v1.1 memory
+ *                                     object.
  * @dst:	    Buffer to populate v1.0 ffa_memory_region_descriptor.
  * @orig_obj:	    Object containing v1.1 ffa_memory_region_descriptor.
  * @buf_size:	    Size of the buffer to populate.
@@ -632,51 +716,32 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
  *                  descriptor.
  *
  * Return: 0 if conversion and population succeeded.
- * Note: This function invalidates the reference to @orig therefore
- * `spmc_shmem_obj_lookup` must be called if further usage is required.
+ * Note: This function may move the objects stored after @orig_obj therefore
+ * `spmc_shmem_obj_lookup` must be called if further usage of them is required.
  */
 static uint32_t
 spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
 				 size_t buf_size, size_t offset,
 				 size_t *copy_size, size_t *v1_0_desc_size)
 {
-		struct spmc_shmem_obj *v1_0_obj;
-
-		/* Calculate the size that the v1.0 descriptor will require. */
-		*v1_0_desc_size = spmc_shm_get_v1_0_descriptor_size(
-					&orig_obj->desc, orig_obj->desc_size);
-
-		if (*v1_0_desc_size == 0) {
-			ERROR("%s: cannot determine size of descriptor.\n",
-			      __func__);
-			return FFA_ERROR_INVALID_PARAMETER;
-		}
+	struct ffa_mtd_v1_0 *v1_0_desc;
+	uint32_t ret;
 
-		/* Get a new obj to store the v1.0 descriptor. */
-		v1_0_obj = spmc_shmem_obj_alloc(&spmc_shmem_obj_state,
-						*v1_0_desc_size);
-
-		if (!v1_0_obj) {
-			return FFA_ERROR_NO_MEMORY;
-		}
-
-		/* Perform the conversion from v1.1 to v1.0. */
-		if (!spmc_shm_convert_mtd_to_v1_0(v1_0_obj, orig_obj)) {
-			spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_0_obj);
-			return FFA_ERROR_INVALID_PARAMETER;
-		}
+	v1_0_desc = spmc_shmem_obj_get_v1_0_desc(&spmc_shmem_obj_state,
+						 orig_obj, &ret);
+	if (v1_0_desc == NULL) {
+		return ret;
+	}
 
-		*copy_size = MIN(v1_0_obj->desc_size - offset, buf_size);
-		memcpy(dst, (uint8_t *) &v1_0_obj->desc + offset, *copy_size);
+	*v1_0_desc_size = orig_obj->v1_0_desc_size;
+	if (offset >= *v1_0_desc_size) {
+		return FFA_ERROR_INVALID_PARAMETER;
+	}
 
-		/*
-		 * We're finished with the v1.0 descriptor for now so free it.
-		 * Note that this will invalidate any references to the v1.1
-		 * descriptor.
-		 */
-		spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_0_obj);
+	*copy_size = MIN(*v1_0_desc_size - offset, buf_size);
+	memcpy(dst, (uint8_t *)v1_0_desc + offset, *copy_size);
 
-		return 0;
+	return 0;
 }
 
 static bool compatible_version(uint32_t ffa_version, uint16_t major,
@@ -1250,7 +1315,7 @@ long spmc_ffa_mem_send(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
 	obj = spmc_shmem_obj_alloc(&spmc_shmem_obj_state, total_length);
 	if (obj == NULL) {
 		ret = FFA_ERROR_NO_MEMORY;
@@ -1262,11 +1327,11 @@ long spmc_ffa_mem_send(uint32_t smc_fid,
 				 ffa_version, handle);
 	spin_unlock(&mbox->lock);
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	return ret;
 
 err_unlock:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1300,7 +1365,7 @@ long spmc_ffa_mem_frag_tx(uint32_t smc_fid,
 	struct spmc_shmem_obj *obj;
 	uint64_t mem_handle = handle_low | (((uint64_t)handle_high) << 32);
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 	if (obj == NULL) {
@@ -1330,11 +1395,11 @@ long spmc_ffa_mem_frag_tx(uint32_t smc_fid,
 				 handle);
 	spin_unlock(&mbox->lock);
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	return ret;
 
 err_unlock:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1472,7 +1537,7 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 		goto err_unlock_mailbox;
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, req->handle);
 	if (obj == NULL) {
@@ -1628,14 +1693,14 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 	/* Set the NS bit in the response if applicable. */
 	spmc_ffa_mem_retrieve_set_ns_bit(resp, sp_ctx);
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	spin_unlock(&mbox->lock);
 
 	SMC_RET8(handle, FFA_MEM_RETRIEVE_RESP, out_desc_size,
 		 copy_size, 0, 0, 0, 0, 0);
 
 err_unlock_all:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 err_unlock_mailbox:
 	spin_unlock(&mbox->lock);
 	return spmc_ffa_error_return(handle, ret);
@@ -1682,7 +1747,7 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 	if (obj == NULL) {
@@ -1751,7 +1816,7 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 	}
 
 	spin_unlock(&mbox->lock);
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 
 	SMC_RET8(handle, FFA_MEM_FRAG_TX, handle_low, handle_high,
 		 copy_size, sender_id, 0, 0, 0);
@@ -1759,7 +1824,7 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 err_unlock_all:
 	spin_unlock(&mbox->lock);
 err_unlock_shmem:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1818,7 +1883,7 @@ int spmc_ffa_mem_relinquish(uint32_t smc_fid,
 		goto err_unlock_mailbox;
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, req->handle);
 	if (obj == NULL) {
@@ -1859,13 +1924,13 @@ int spmc_ffa_mem_relinquish(uint32_t smc_fid,
 	}
 	obj->in_use--;
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	spin_unlock(&mbox->lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
 
 err_unlock_all:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 err_unlock_mailbox:
 	spin_unlock(&mbox->lock);
 	return spmc_ffa_error_return(handle, ret);
@@ -1910,7 +1975,7 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 	if (obj == NULL) {
@@ -1936,11 +2001,26 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 	}
 
 	spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
 
 err_unlock:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
 	return spmc_ffa_error_return(handle, ret);
 }
+
+/**
+ * spmc_shmem_get_stats - Get the FF-A v1.0 descriptor conversion counters.
+ * @conversions:         Populated with the number of descriptors converted
+ *                       to the FF-A v1.0 format.
+ * @conversions_avoided: Populated with the number of FF-A v1.0 retrievals and
+ *                       fragments served from a descriptor converted earlier.
+ */
+void spmc_shmem_get_stats(uint64_t *conversions, uint64_t *conversions_avoided)
+{
+	stat_spin_lock(&spmc_shmem_obj_state.lock);
+	*conversions = spmc_shmem_obj_state.v1_0_conversions;
+	*conversions_avoided = spmc_shmem_obj_state.v1_0_conversions_avoided;
+	stat_spin_unlock(&spmc_shmem_obj_state.lock);
+}
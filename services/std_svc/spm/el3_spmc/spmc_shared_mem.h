@@ -7,6 +7,7 @@
 #ifndef SPMC_SHARED_MEM_H
 #define SPMC_SHARED_MEM_H
 
+#include <lib/spinlock.h>
 #include <services/el3_spmc_ffa_memory.h>
 
 /**
@@ -37,6 +38,11 @@ CASSERT(sizeof(struct ffa_mem_relinquish_descriptor) == 16,
  * @data_size:      The size allocated for the backing store.
  * @allocated:      Number of bytes allocated in @data.
  * @next_handle:    Handle used for next allocated object.
+ * @v1_0_conversions:
+ *                  Number of descriptors converted to the FF-A v1.0 format.
+ * @v1_0_conversions_avoided:
+ *                  Number of FF-A v1.0 retrievals and fragments served from
+ *                  a descriptor converted earlier.
  * @lock:           Lock protecting all state in this file.
  */
 struct spmc_shmem_obj_state {
@@ -44,7 +50,9 @@ struct spmc_shmem_obj_state {
 	size_t data_size;
 	size_t allocated;
 	uint64_t next_handle;
-	spinlock_t lock;
+	uint64_t v1_0_conversions;
+	uint64_t v1_0_conversions_avoided;
+	stat_spinlock_t lock;
 };
 
 extern struct spmc_shmem_obj_state spmc_shmem_obj_state;
@@ -1,56 +1,155 @@
 /*
- * Copyright (c) 2021-2022, ARM Limited. All rights reserved.
+ * Copyright (c) 2021-2025, ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <stdbool.h>
 #include <stdint.h>
+
+#include <arch_helpers.h>
+#include <lib/cassert.h>
+#include <lib/el3_runtime/pubsub_events.h>
 #include <lib/spinlock.h>
+#include <lib/utils.h>
 #include <plat/common/plat_trng.h>
+#include <plat/common/platform.h>
+
+#include "trng_entropy_pool.h"
+
+#include <platform_def.h>
+
+#pragma weak plat_get_entropy_batch
 
 /*
  * # Entropy pool
  * Note that the TRNG Firmware interface can request up to 192 bits of entropy
- * in a single call or three 64bit words per call. We have 4 words in the pool
- * so that when we have 1-63 bits in the pool, and we have a request for
- * 192 bits of entropy, we don't have to throw out the leftover 1-63 bits of
+ * in a single call or three 64bit words per call. We have at least 4 words in
+ * the pool so that when we have 1-63 bits in the pool, and we have a request
+ * for 192 bits of entropy, we don't have to throw out the leftover 1-63 bits of
  * entropy.
+ *
+ * Each CPU owns a pool, which is only ever accessed by that CPU, so requests
+ * served from the pool do not take any lock. Empty pools are refilled with a
+ * batch of words obtained from the entropy source, which is the only resource
+ * shared between CPUs.
+ */
+#ifndef PLAT_TRNG_POOL_WORDS
+#define PLAT_TRNG_POOL_WORDS		8U
+#endif
+
+/*
+ * Number of bits below which the pool of a CPU is topped up when that CPU
+ * enters a power down state. 0 disables the refill on idle.
  */
-#define WORDS_IN_POOL	(4)
-static uint64_t entropy[WORDS_IN_POOL];
-/* index in bits of the first bit of usable entropy */
-static uint32_t entropy_bit_index;
-/* then number of valid bits in the entropy pool */
-static uint32_t entropy_bit_size;
+#ifndef PLAT_TRNG_POOL_LOW_WATERMARK
+#define PLAT_TRNG_POOL_LOW_WATERMARK	192U
+#endif
 
-static spinlock_t trng_pool_lock;
+#define WORDS_IN_POOL		PLAT_TRNG_POOL_WORDS
 
-#define BITS_PER_WORD		(sizeof(entropy[0]) * 8)
+CASSERT(WORDS_IN_POOL >= 4U, assert_trng_pool_too_small);
+
+struct trng_entropy_pool {
+	uint64_t entropy[WORDS_IN_POOL];
+	/* index in bits of the first bit of usable entropy */
+	uint32_t entropy_bit_index;
+	/* then number of valid bits in the entropy pool */
+	uint32_t entropy_bit_size;
+	struct trng_pool_stats stats;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct trng_entropy_pool trng_pools[PLATFORM_CORE_COUNT];
+
+/* Serialises accesses to the entropy source */
+static stat_spinlock_t trng_source_lock;
+
+#define BITS_PER_WORD		(sizeof(uint64_t) * 8)
 #define BITS_IN_POOL		(WORDS_IN_POOL * BITS_PER_WORD)
-#define ENTROPY_MIN_WORD	(entropy_bit_index / BITS_PER_WORD)
-#define ENTROPY_FREE_BIT	(entropy_bit_size + entropy_bit_index)
-#define _ENTROPY_FREE_WORD	(ENTROPY_FREE_BIT / BITS_PER_WORD)
-#define ENTROPY_FREE_INDEX	(_ENTROPY_FREE_WORD % WORDS_IN_POOL)
+#define ENTROPY_MIN_WORD(p)	((p)->entropy_bit_index / BITS_PER_WORD)
+#define ENTROPY_FREE_BIT(p)	((p)->entropy_bit_size + (p)->entropy_bit_index)
+#define _ENTROPY_FREE_WORD(p)	(ENTROPY_FREE_BIT(p) / BITS_PER_WORD)
+#define ENTROPY_FREE_INDEX(p)	(_ENTROPY_FREE_WORD(p) % WORDS_IN_POOL)
 /* ENTROPY_WORD_INDEX(0) includes leftover bits in the lower bits */
-#define ENTROPY_WORD_INDEX(i)	((ENTROPY_MIN_WORD + i) % WORDS_IN_POOL)
+#define ENTROPY_WORD_INDEX(p, i)	((ENTROPY_MIN_WORD(p) + i) % WORDS_IN_POOL)
+
+/*
+ * Default batched read of the entropy source, for platforms that can only
+ * provide a word at a time. Returns the number of words written to out.
+ */
+unsigned int plat_get_entropy_batch(uint64_t *out, unsigned int count)
+{
+	unsigned int i;
+
+	for (i = 0U; i < count; i++) {
+		if (!plat_get_entropy(&out[i])) {
+			break;
+		}
+	}
+
+	return i;
+}
+
+/*
+ * Top up the pool with as many words as it can hold. The words are read from
+ * the entropy source into a staging buffer, so that the source lock is only
+ * held for the duration of a single batched read.
+ * Returns false if the entropy source did not provide any entropy.
+ */
+static bool trng_refill_pool(struct trng_entropy_pool *pool)
+{
+	uint64_t staging[WORDS_IN_POOL];
+	unsigned int count, got, i;
+	uint64_t start;
+
+	count = (BITS_IN_POOL - pool->entropy_bit_size) / BITS_PER_WORD;
+	if (count == 0U) {
+		return true;
+	}
+
+	start = read_cntpct_el0();
+
+	if (!stat_spin_trylock(&trng_source_lock)) {
+		pool->stats.source_contended++;
+		stat_spin_lock(&trng_source_lock);
+	}
+
+	got = plat_get_entropy_batch(staging, count);
+
+	stat_spin_unlock(&trng_source_lock);
+
+	assert(got <= count);
+
+	for (i = 0U; i < got; i++) {
+		pool->entropy[ENTROPY_FREE_INDEX(pool)] = staging[i];
+		pool->entropy_bit_size += BITS_PER_WORD;
+		assert(pool->entropy_bit_size <= BITS_IN_POOL);
+	}
+
+	/* Do not leave copies of the entropy behind */
+	zeromem(staging, sizeof(staging));
+
+	pool->stats.refills++;
+	pool->stats.source_words += got;
+	pool->stats.source_ticks += read_cntpct_el0() - start;
+	if (got < count) {
+		pool->stats.source_failures++;
+	}
+
+	return got != 0U;
+}
 
 /*
  * Fill the entropy pool until we have at least as many bits as requested.
  * Returns true after filling the pool, and false if the entropy source is out
  * of entropy and the pool could not be filled.
- * Assumes locks are taken.
  */
-static bool trng_fill_entropy(uint32_t nbits)
+static bool trng_fill_entropy(struct trng_entropy_pool *pool, uint32_t nbits)
 {
-	while (nbits > entropy_bit_size) {
-		bool valid = plat_get_entropy(&entropy[ENTROPY_FREE_INDEX]);
-
-		if (valid) {
-			entropy_bit_size += BITS_PER_WORD;
-			assert(entropy_bit_size <= BITS_IN_POOL);
-		} else {
+	while (nbits > pool->entropy_bit_size) {
+		if (!trng_refill_pool(pool)) {
 			return false;
 		}
 	}
@@ -58,23 +157,26 @@ static bool trng_fill_entropy(uint32_t nbits)
 }
 
 /*
- * Pack entropy into the out buffer, filling and taking locks as needed.
- * Returns true on success, false on failure.
+ * Pack entropy from the pool of the calling CPU into the out buffer, filling
+ * the pool as needed. Returns true on success, false on failure.
  *
  * Note: out must have enough space for nbits of entropy
  */
 bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 {
-	bool ret = true;
+	struct trng_entropy_pool *pool = &trng_pools[plat_my_core_pos()];
 	uint32_t bits_to_discard = nbits;
-	spin_lock(&trng_pool_lock);
+	uint64_t *entropy = pool->entropy;
+
+	pool->stats.requests++;
 
-	if (!trng_fill_entropy(nbits)) {
-		ret = false;
-		goto out;
+	if (nbits <= pool->entropy_bit_size) {
+		pool->stats.pool_hits++;
+	} else if (!trng_fill_entropy(pool, nbits)) {
+		return false;
 	}
 
-	const unsigned int rshift = entropy_bit_index % BITS_PER_WORD;
+	const unsigned int rshift = pool->entropy_bit_index % BITS_PER_WORD;
 	const unsigned int lshift = BITS_PER_WORD - rshift;
 	const int to_fill = ((nbits + BITS_PER_WORD - 1) / BITS_PER_WORD);
 	int word_i;
@@ -111,7 +213,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 *                   5 4 3 2 1 0 7 6
 		 *                  [e,e,e,e,e,e,e,e]
 		 */
-		out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i)] >> rshift;
+		out[word_i] |= entropy[ENTROPY_WORD_INDEX(pool, word_i)] >> rshift;
 
 		/**
 		 * Discarding the used/packed entropy bits from the respective
@@ -156,7 +258,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * amount of bits only.
 		 */
 		if (bits_to_discard < (BITS_PER_WORD - rshift)) {
-			entropy[ENTROPY_WORD_INDEX(word_i)] &=
+			entropy[ENTROPY_WORD_INDEX(pool, word_i)] &=
 			(~0ULL << ((bits_to_discard+rshift) % BITS_PER_WORD));
 			bits_to_discard = 0;
 		} else {
@@ -167,7 +269,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * will be already zeros from previous operations, and the
 		 * bits_to_discard is updated precisely.
 		 */
-			entropy[ENTROPY_WORD_INDEX(word_i)] = 0;
+			entropy[ENTROPY_WORD_INDEX(pool, word_i)] = 0;
 			bits_to_discard -= (BITS_PER_WORD - rshift);
 		}
 
@@ -178,7 +280,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * the `|=` operation.
 		 */
 		if (lshift != BITS_PER_WORD) {
-			out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i + 1)]
+			out[word_i] |= entropy[ENTROPY_WORD_INDEX(pool, word_i + 1)]
 				<< lshift;
 			/**
 			 * Discarding the remaining packed bits from upperword
@@ -191,7 +293,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * amount of bits only.
 			 */
 			if (bits_to_discard < (BITS_PER_WORD - lshift)) {
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				entropy[ENTROPY_WORD_INDEX(pool, word_i + 1)]  &=
 				(~0ULL << ((bits_to_discard) % BITS_PER_WORD));
 				bits_to_discard = 0;
 			} else {
@@ -204,7 +306,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * there are still some unused valid entropy bits at the
 			 * upper end for future use.
 			 */
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				entropy[ENTROPY_WORD_INDEX(pool, word_i + 1)]  &=
 				(~0ULL << ((BITS_PER_WORD - lshift) % BITS_PER_WORD));
 				bits_to_discard -= (BITS_PER_WORD - lshift);
 		}
@@ -215,22 +317,55 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 
 	out[to_fill - 1] &= mask;
 
-	entropy_bit_index = (entropy_bit_index + nbits) % BITS_IN_POOL;
-	entropy_bit_size -= nbits;
+	pool->entropy_bit_index = (pool->entropy_bit_index + nbits) %
+				  BITS_IN_POOL;
+	pool->entropy_bit_size -= nbits;
+	pool->stats.bits_served += nbits;
+
+	return true;
+}
+
+#if PLAT_TRNG_POOL_LOW_WATERMARK != 0
+/*
+ * A CPU entering a power down state is idle. Refill its pool from there if it
+ * holds less entropy than the low watermark, so that the next requests of that
+ * CPU are served from the pool.
+ */
+static void *trng_entropy_pool_idle_refill(const void *arg)
+{
+	struct trng_entropy_pool *pool = &trng_pools[plat_my_core_pos()];
 
-out:
-	spin_unlock(&trng_pool_lock);
+	if (pool->entropy_bit_size < PLAT_TRNG_POOL_LOW_WATERMARK) {
+		(void)trng_refill_pool(pool);
+	}
 
-	return ret;
+	return (void *)0;
 }
 
-void trng_entropy_pool_setup(void)
+SUBSCRIBE_TO_EVENT(psci_suspend_pwrdown_start, trng_entropy_pool_idle_refill);
+#endif /* PLAT_TRNG_POOL_LOW_WATERMARK != 0 */
+
+/*
+ * Return the statistics of the pool of a CPU. These are updated without any
+ * synchronisation by their owning CPU, so the values read from another CPU may
+ * be slightly out of date.
+ */
+int trng_entropy_pool_get_stats(unsigned int cpu_idx,
+				struct trng_pool_stats *stats)
 {
-	int i;
+	assert(stats != NULL);
 
-	for (i = 0; i < WORDS_IN_POOL; i++) {
-		entropy[i] = 0;
+	if (cpu_idx >= PLATFORM_CORE_COUNT) {
+		return -EINVAL;
 	}
-	entropy_bit_index = 0;
-	entropy_bit_size = 0;
+
+	*stats = trng_pools[cpu_idx].stats;
+
+	return 0;
+}
+
+void trng_entropy_pool_setup(void)
+{
+	zeromem(trng_pools, sizeof(trng_pools));
+	stat_spinlock_register(&trng_source_lock, "trng");
 }
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <mbedtls/gcm.h>
+#include <mbedtls/platform.h>
+#include <mbedtls/sha256.h>
+#include <mbedtls/sha512.h>
+
+/*
+ * Throughput of the mbed TLS SHA-256, SHA-512 and AES-GCM implementations, as
+ * configured for the firmware by default_mbedtls_config.h. Building the tool
+ * with and without TF_MBEDTLS_USE_ARMV8_CRYPTO and TF_MBEDTLS_USE_ARMV8_SHA512
+ * compares the C implementations with the Cryptographic Extension ones.
+ */
+
+#define NELEM(x)		(sizeof(x) / sizeof((x)[0]))
+
+#define GCM_IV_SIZE		12U
+#define GCM_TAG_SIZE		16U
+
+static const size_t default_sizes[] = { 1024U, 64U * 1024U, 1024U * 1024U };
+
+static unsigned int iterations = 16U;
+static uint8_t *src_buf;
+static uint8_t *dst_buf;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static double mib_per_s(uint64_t bytes, uint64_t ns)
+{
+	if (ns == 0U) {
+		return 0.0;
+	}
+
+	return ((double)bytes / (1024.0 * 1024.0)) / ((double)ns / 1e9);
+}
+
+/* Known answers for "abc", so that a broken configuration is not timed */
+static int check_sha(void)
+{
+	static const uint8_t sha256_abc[32] = {
+		0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea,
+		0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+		0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+	};
+	static const uint8_t sha512_abc[64] = {
+		0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba,
+		0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31,
+		0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2,
+		0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a,
+		0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8,
+		0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+		0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e,
+		0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f,
+	};
+	uint8_t out[64];
+
+	if ((mbedtls_sha256((const uint8_t *)"abc", 3U, out, 0) != 0) ||
+	    (memcmp(out, sha256_abc, sizeof(sha256_abc)) != 0)) {
+		fprintf(stderr, "SHA-256 known answer test failed\n");
+		return -1;
+	}
+
+	if ((mbedtls_sha512((const uint8_t *)"abc", 3U, out, 0) != 0) ||
+	    (memcmp(out, sha512_abc, sizeof(sha512_abc)) != 0)) {
+		fprintf(stderr, "SHA-512 known answer test failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+static int bench_sha256(size_t size)
+{
+	uint8_t out[32];
+	uint64_t start, ns;
+	unsigned int it;
+
+	start = now_ns();
+	for (it = 0U; it < iterations; it++) {
+		if (mbedtls_sha256(src_buf, size, out, 0) != 0) {
+			return -1;
+		}
+	}
+	ns = now_ns() - start;
+
+	printf("    sha256       %9.1f MiB/s\n",
+	       mib_per_s((uint64_t)size * iterations, ns));
+
+	return 0;
+}
+
+static int bench_sha512(size_t size)
+{
+	uint8_t out[64];
+	uint64_t start, ns;
+	unsigned int it;
+
+	start = now_ns();
+	for (it = 0U; it < iterations; it++) {
+		if (mbedtls_sha512(src_buf, size, out, 0) != 0) {
+			return -1;
+		}
+	}
+	ns = now_ns() - start;
+
+	printf("    sha512       %9.1f MiB/s\n",
+	       mib_per_s((uint64_t)size * iterations, ns));
+
+	return 0;
+}
+
+/*
+ * Decrypt and authenticate data encrypted beforehand, as the firmware does for
+ * encrypted images, and check the round trip.
+ */
+static int bench_gcm(size_t size, unsigned int key_bits)
+{
+	static const uint8_t key[32] = { 0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae };
+	static const uint8_t iv[GCM_IV_SIZE] = { 0xca, 0xfe, 0xba, 0xbe };
+	mbedtls_gcm_context ctx;
+	uint8_t tag[GCM_TAG_SIZE];
+	uint8_t *cipher_buf;
+	uint64_t start, ns = 0U;
+	unsigned int it;
+	int rc = -1;
+
+	cipher_buf = malloc(size);
+	if (cipher_buf == NULL) {
+		return -1;
+	}
+
+	mbedtls_gcm_init(&ctx);
+
+	if ((mbedtls_gcm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, key,
+				key_bits) != 0) ||
+	    (mbedtls_gcm_crypt_and_tag(&ctx, MBEDTLS_GCM_ENCRYPT, size, iv,
+				       sizeof(iv), NULL, 0U, src_buf,
+				       cipher_buf, sizeof(tag), tag) != 0)) {
+		goto out;
+	}
+
+	for (it = 0U; it < iterations; it++) {
+		start = now_ns();
+		if (mbedtls_gcm_auth_decrypt(&ctx, size, iv, sizeof(iv), NULL,
+					     0U, tag, sizeof(tag), cipher_buf,
+					     dst_buf) != 0) {
+			fprintf(stderr, "AES-%u-GCM tag mismatch\n", key_bits);
+			goto out;
+		}
+		ns += now_ns() - start;
+	}
+
+	if (memcmp(src_buf, dst_buf, size) != 0) {
+		fprintf(stderr, "AES-%u-GCM round trip failed\n", key_bits);
+		goto out;
+	}
+
+	printf("    aes%u-gcm   %9.1f MiB/s\n", key_bits,
+	       mib_per_s((uint64_t)size * iterations, ns));
+	rc = 0;
+
+out:
+	mbedtls_gcm_free(&ctx);
+	free(cipher_buf);
+
+	return rc;
+}
+
+static int run_size(size_t size)
+{
+	printf("%zu bytes:\n", size);
+
+	if ((bench_sha256(size) != 0) || (bench_sha512(size) != 0) ||
+	    (bench_gcm(size, 128U) != 0) || (bench_gcm(size, 256U) != 0)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+static void usage(const char *name)
+{
+	printf("usage: %s [options]\n", name);
+	printf("  -s <bytes>    run one data size only\n");
+	printf("  -i <count>    iterations of each benchmark (default %u)\n",
+	       iterations);
+}
+
+int main(int argc, char *argv[])
+{
+	size_t size = 0U, max_size = 0U;
+	unsigned int i;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:i:h")) != -1) {
+		switch (opt) {
+		case 's':
+			size = strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			iterations = (unsigned int)strtoul(optarg, NULL, 0);
+			if (iterations == 0U) {
+				iterations = 1U;
+			}
+			break;
+		default:
+			usage(argv[0]);
+			return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	/* The firmware configuration leaves the allocator unset */
+	(void)mbedtls_platform_set_calloc_free(calloc, free);
+
+	printf("SHA-256: %s, SHA-512: %s, AES-GCM: %s\n",
+	       TF_MBEDTLS_USE_ARMV8_CRYPTO ? "Crypto Extension" : "C",
+	       TF_MBEDTLS_USE_ARMV8_SHA512 ? "Crypto Extension" : "C",
+	       TF_MBEDTLS_USE_ARMV8_CRYPTO ? "Crypto Extension" : "C");
+
+	if (check_sha() != 0) {
+		return EXIT_FAILURE;
+	}
+
+	max_size = size;
+	for (i = 0U; i < NELEM(default_sizes); i++) {
+		if (default_sizes[i] > max_size) {
+			max_size = default_sizes[i];
+		}
+	}
+
+	src_buf = malloc(max_size);
+	dst_buf = malloc(max_size);
+	if ((src_buf == NULL) || (dst_buf == NULL)) {
+		fprintf(stderr, "cannot allocate %zu bytes\n", max_size);
+		return EXIT_FAILURE;
+	}
+
+	for (i = 0U; i < max_size; i++) {
+		src_buf[i] = (uint8_t)(i * 131U);
+	}
+
+	if (size != 0U) {
+		if (run_size(size) != 0) {
+			return EXIT_FAILURE;
+		}
+	} else {
+		for (i = 0U; i < NELEM(default_sizes); i++) {
+			if (run_size(default_sizes[i]) != 0) {
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	free(src_buf);
+	free(dst_buf);
+
+	return EXIT_SUCCESS;
+}
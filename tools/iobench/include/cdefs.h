@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IOBENCH_CDEFS_H
+#define IOBENCH_CDEFS_H
+
+/*
+ * The io drivers are built against the host C library, which does not provide
+ * the TF-A compiler attribute helpers. Pull them from the firmware tree only.
+ */
+#include "../../../include/lib/libc/cdefs.h"
+
+#endif /* IOBENCH_CDEFS_H */
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PLATFORM_DEF_H
+#define PLATFORM_DEF_H
+
+#include <stdbool.h>
+
+/*
+ * Minimal platform definitions needed to build the io drivers on the host.
+ * The host C library does not provide the TF-A register types.
+ */
+typedef unsigned long u_register_t;
+typedef long register_t;
+
+/* memmap, block, fip and host file devices */
+#define MAX_IO_DEVICES			4
+#define MAX_IO_HANDLES			4
+#define MAX_IO_BLOCK_DEVICES		1
+
+#define PLATFORM_CORE_COUNT		1
+#define PLAT_MAX_PWR_LVL		0
+#define PLAT_MAX_RET_STATE		1
+#define PLAT_MAX_OFF_STATE		2
+
+#define NR_OF_FW_BANKS			1
+#define NR_OF_IMAGES_IN_FW_BANK		1
+
+#endif /* PLATFORM_DEF_H */
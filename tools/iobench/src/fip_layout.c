@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tools_share/firmware_image_package.h>
+
+#include "iobench.h"
+
+/*
+ * Entries get synthetic UUIDs derived from their index, so that they never
+ * collide with the null UUID terminating the ToC.
+ */
+void iob_fip_entry_uuid(unsigned int idx, uuid_t *uuid)
+{
+	(void)memset(uuid, 0, sizeof(*uuid));
+	(void)memcpy(uuid->time_low, "IOB!", sizeof(uuid->time_low));
+	uuid->node[2] = (uint8_t)(idx >> 24);
+	uuid->node[3] = (uint8_t)(idx >> 16);
+	uuid->node[4] = (uint8_t)(idx >> 8);
+	uuid->node[5] = (uint8_t)idx;
+}
+
+/* Payload content, different for every entry and offset within a block */
+uint8_t iob_fip_pattern(unsigned int idx, size_t offset)
+{
+	return (uint8_t)((offset * 31U) + (offset >> 9) + (idx * 7U) + 1U);
+}
+
+static size_t iob_align_up(size_t value, size_t align)
+{
+	return ((value + align - 1U) / align) * align;
+}
+
+int iob_fip_build(const struct iob_layout *layout, struct iob_fip *fip)
+{
+	fip_toc_header_t *header;
+	fip_toc_entry_t *entry;
+	size_t offset, i;
+	unsigned int idx;
+
+	/* Header, then the ToC entries and the null terminating entry */
+	offset = sizeof(*header) + ((layout->count + 1U) * sizeof(*entry));
+
+	fip->size = offset;
+	for (idx = 0U; idx < layout->count; idx++) {
+		fip->size = iob_align_up(fip->size, layout->align) +
+			    layout->skew + layout->size;
+	}
+
+	fip->base = calloc(1U, fip->size);
+	if (fip->base == NULL) {
+		return -ENOMEM;
+	}
+
+	header = (fip_toc_header_t *)fip->base;
+	header->name = TOC_HEADER_NAME;
+	header->serial_number = 1U;
+
+	entry = (fip_toc_entry_t *)(header + 1);
+	for (idx = 0U; idx < layout->count; idx++, entry++) {
+		offset = iob_align_up(offset, layout->align) + layout->skew;
+
+		iob_fip_entry_uuid(idx, &entry->uuid);
+		entry->offset_address = offset;
+		entry->size = layout->size;
+
+		for (i = 0U; i < layout->size; i++) {
+			fip->base[offset + i] = iob_fip_pattern(idx, i);
+		}
+
+		offset += layout->size;
+	}
+
+	return 0;
+}
+
+void iob_fip_free(struct iob_fip *fip)
+{
+	free(fip->base);
+	fip->base = NULL;
+	fip->size = 0U;
+}
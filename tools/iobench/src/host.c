@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <cdefs.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <platform_def.h>
+
+#include <common/debug.h>
+#include <drivers/io/io_block.h>
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_fip.h>
+#include <drivers/io/io_memmap.h>
+#include <drivers/io/io_storage.h>
+#include <lib/utils.h>
+
+#include "iobench.h"
+
+/*
+ * Firmware services the io drivers rely on, provided by the host instead.
+ */
+
+/* Image boundaries, only referenced by the generic headers */
+char __RO_START__[1], __RO_END__[1], __RW_END__[1];
+
+void zeromem(void *mem, u_register_t length)
+{
+	(void)memset(mem, 0, length);
+}
+
+void tf_log(const char *fmt, ...)
+{
+	va_list args;
+
+	/* Skip the log level marker */
+	va_start(args, fmt);
+	(void)vfprintf(stderr, &fmt[1], args);
+	va_end(args);
+}
+
+static const io_dev_connector_t *memmap_dev_con;
+static const io_dev_connector_t *block_dev_con;
+static const io_dev_connector_t *fip_dev_con;
+static const io_dev_connector_t *hostfile_dev_con;
+
+/* Backend the FIP driver reads the package from */
+static uintptr_t backend_dev_handle;
+static uintptr_t backend_image_spec;
+
+static io_block_spec_t memmap_spec;
+static io_block_spec_t block_spec;
+static io_file_spec_t file_spec;
+
+/*
+ * Emulated block device, serving the blocks of an in-memory image. Reads
+ * beyond the end of the image return zeroes, as an unused part of a flash
+ * would.
+ */
+static const uint8_t *block_image;
+static size_t block_image_size;
+static uint8_t block_bounce_buf[IOB_BLOCK_BUF_SIZE] __aligned(IOB_BLOCK_SIZE);
+
+static size_t iob_block_read(int lba, uintptr_t buf, size_t size)
+{
+	size_t offset = (size_t)lba * IOB_BLOCK_SIZE;
+	size_t avail = 0U;
+
+	assert((size % IOB_BLOCK_SIZE) == 0U);
+
+	if (offset < block_image_size) {
+		avail = block_image_size - offset;
+		if (avail > size) {
+			avail = size;
+		}
+		(void)memcpy((void *)buf, &block_image[offset], avail);
+	}
+
+	(void)memset((void *)(buf + avail), 0, size - avail);
+
+	return size;
+}
+
+static io_block_dev_spec_t block_dev_spec = {
+	.buffer = {
+		.offset = (size_t)block_bounce_buf,
+		.length = IOB_BLOCK_BUF_SIZE,
+	},
+	.ops = {
+		.read = iob_block_read,
+	},
+	.block_size = IOB_BLOCK_SIZE,
+};
+
+/* The FIP driver queries the location of the package here */
+int plat_get_image_source(unsigned int image_id __unused,
+			  uintptr_t *dev_handle, uintptr_t *image_spec)
+{
+	if (backend_dev_handle == (uintptr_t)NULL) {
+		return -ENODEV;
+	}
+
+	*dev_handle = backend_dev_handle;
+	*image_spec = backend_image_spec;
+
+	return 0;
+}
+
+void iob_io_init(void)
+{
+	static int registered;
+	int result;
+
+	if (registered != 0) {
+		return;
+	}
+
+	result = register_io_dev_memmap(&memmap_dev_con);
+	assert(result == 0);
+	result = register_io_dev_block(&block_dev_con);
+	assert(result == 0);
+	result = register_io_dev_fip(&fip_dev_con);
+	assert(result == 0);
+	result = register_io_dev_hostfile(&hostfile_dev_con);
+	assert(result == 0);
+	(void)result;
+
+	registered = 1;
+}
+
+const char *iob_backend_name(enum iob_backend backend)
+{
+	static const char * const names[IOB_BACKEND_COUNT] = {
+		[IOB_BACKEND_MEMMAP] = "memmap",
+		[IOB_BACKEND_BLOCK] = "block",
+		[IOB_BACKEND_FILE] = "file",
+	};
+
+	assert(backend < IOB_BACKEND_COUNT);
+
+	return names[backend];
+}
+
+int iob_backend_open(enum iob_backend backend, const void *base, size_t size,
+		     const char *path, uintptr_t *fip_dev)
+{
+	const io_dev_connector_t *dev_con;
+	uintptr_t dev_spec = (uintptr_t)NULL;
+	int result;
+
+	iob_io_init();
+
+	switch (backend) {
+	case IOB_BACKEND_MEMMAP:
+		memmap_spec.offset = (size_t)base;
+		memmap_spec.length = size;
+		dev_con = memmap_dev_con;
+		backend_image_spec = (uintptr_t)&memmap_spec;
+		break;
+	case IOB_BACKEND_BLOCK:
+		/* The block driver works on whole blocks only */
+		block_image = base;
+		block_image_size = size;
+		block_spec.offset = 0U;
+		block_spec.length = (size + IOB_BLOCK_SIZE - 1U) &
+				    ~(size_t)(IOB_BLOCK_SIZE - 1U);
+		dev_con = block_dev_con;
+		dev_spec = (uintptr_t)&block_dev_spec;
+		backend_image_spec = (uintptr_t)&block_spec;
+		break;
+	case IOB_BACKEND_FILE:
+		if (path == NULL) {
+			return -EINVAL;
+		}
+		file_spec.path = path;
+		file_spec.mode = 0U;
+		dev_con = hostfile_dev_con;
+		backend_image_spec = (uintptr_t)&file_spec;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	result = io_dev_open(dev_con, dev_spec, &backend_dev_handle);
+	if (result != 0) {
+		backend_dev_handle = (uintptr_t)NULL;
+		return result;
+	}
+
+	result = io_dev_open(fip_dev_con, (uintptr_t)NULL, fip_dev);
+	if (result == 0) {
+		/* Checks the package header */
+		result = io_dev_init(*fip_dev, 0);
+		if (result != 0) {
+			(void)io_dev_close(*fip_dev);
+		}
+	}
+
+	if (result != 0) {
+		(void)io_dev_close(backend_dev_handle);
+		backend_dev_handle = (uintptr_t)NULL;
+	}
+
+	return result;
+}
+
+void iob_backend_close(uintptr_t fip_dev)
+{
+	(void)io_dev_close(fip_dev);
+	(void)io_dev_close(backend_dev_handle);
+	backend_dev_handle = (uintptr_t)NULL;
+	backend_image_spec = (uintptr_t)NULL;
+}
+
+void iob_backend_get(uintptr_t *dev_handle, uintptr_t *image_spec)
+{
+	*dev_handle = backend_dev_handle;
+	*image_spec = backend_image_spec;
+}
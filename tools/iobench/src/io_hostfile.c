@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <cdefs.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include <platform_def.h>
+
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_storage.h>
+
+#include "iobench.h"
+
+/*
+ * Host file io driver. This is the host counterpart of the semihosting driver:
+ * the specification is an io_file_spec_t naming a file of the host, and every
+ * open file is backed by its own stdio stream so that several files can be
+ * open at the same time.
+ */
+
+/* Report the semihosting type, which is how a host file is reached on FVP */
+static io_type_t device_type_hostfile(void)
+{
+	return IO_TYPE_SEMIHOSTING;
+}
+
+static int hostfile_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
+static int hostfile_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
+			      io_entity_t *entity);
+static int hostfile_file_seek(io_entity_t *entity, int mode,
+			      signed long long offset);
+static int hostfile_file_len(io_entity_t *entity, size_t *length);
+static int hostfile_file_read(io_entity_t *entity, uintptr_t buffer,
+			      size_t length, size_t *length_read);
+static int hostfile_file_close(io_entity_t *entity);
+
+static const io_dev_connector_t hostfile_dev_connector = {
+	.dev_open = hostfile_dev_open
+};
+
+static const io_dev_funcs_t hostfile_dev_funcs = {
+	.type = device_type_hostfile,
+	.open = hostfile_file_open,
+	.seek = hostfile_file_seek,
+	.size = hostfile_file_len,
+	.read = hostfile_file_read,
+	.write = NULL,
+	.close = hostfile_file_close,
+	.dev_init = NULL,	/* NOP */
+	.dev_close = NULL,	/* NOP */
+};
+
+static io_dev_info_t hostfile_dev_info = {
+	.funcs = &hostfile_dev_funcs,
+	.info = (uintptr_t)NULL
+};
+
+static int hostfile_dev_open(const uintptr_t dev_spec __unused,
+			     io_dev_info_t **dev_info)
+{
+	assert(dev_info != NULL);
+	*dev_info = &hostfile_dev_info;
+
+	return 0;
+}
+
+static int hostfile_file_open(io_dev_info_t *dev_info __unused,
+			      const uintptr_t spec, io_entity_t *entity)
+{
+	const io_file_spec_t *file_spec = (const io_file_spec_t *)spec;
+	FILE *file;
+
+	assert(file_spec != NULL);
+	assert(entity != NULL);
+
+	file = fopen(file_spec->path, "rb");
+	if (file == NULL) {
+		return -ENOENT;
+	}
+
+	entity->info = (uintptr_t)file;
+
+	return 0;
+}
+
+static int hostfile_file_seek(io_entity_t *entity, int mode,
+			      signed long long offset)
+{
+	int whence;
+
+	assert(entity != NULL);
+
+	switch (mode) {
+	case IO_SEEK_SET:
+		whence = SEEK_SET;
+		break;
+	case IO_SEEK_END:
+		whence = SEEK_END;
+		break;
+	case IO_SEEK_CUR:
+		whence = SEEK_CUR;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (fseek((FILE *)entity->info, (long)offset, whence) != 0) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int hostfile_file_len(io_entity_t *entity, size_t *length)
+{
+	FILE *file;
+	long pos, end;
+
+	assert(entity != NULL);
+	assert(length != NULL);
+
+	file = (FILE *)entity->info;
+	pos = ftell(file);
+	if ((pos < 0) || (fseek(file, 0L, SEEK_END) != 0)) {
+		return -EIO;
+	}
+
+	end = ftell(file);
+	if ((end < 0) || (fseek(file, pos, SEEK_SET) != 0)) {
+		return -EIO;
+	}
+
+	*length = (size_t)end;
+
+	return 0;
+}
+
+static int hostfile_file_read(io_entity_t *entity, uintptr_t buffer,
+			      size_t length, size_t *length_read)
+{
+	FILE *file;
+
+	assert(entity != NULL);
+	assert(length_read != NULL);
+
+	file = (FILE *)entity->info;
+	*length_read = fread((void *)buffer, 1U, length, file);
+	if ((*length_read != length) && (ferror(file) != 0)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int hostfile_file_close(io_entity_t *entity)
+{
+	assert(entity != NULL);
+
+	if (fclose((FILE *)entity->info) != 0) {
+		return -EIO;
+	}
+
+	entity->info = (uintptr_t)NULL;
+
+	return 0;
+}
+
+int register_io_dev_hostfile(const io_dev_connector_t **dev_con)
+{
+	int result;
+
+	assert(dev_con != NULL);
+
+	result = io_register_device(&hostfile_dev_info);
+	if (result == 0) {
+		*dev_con = &hostfile_dev_connector;
+	}
+
+	return result;
+}
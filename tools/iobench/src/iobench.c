@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "iobench.h"
+
+/*
+ * Benchmark of the io layer on the host: the io_storage, io_fip, io_memmap and
+ * io_block drivers are built unmodified and driven through FIP layouts that
+ * stress the ToC walk, the bulk copy and the unaligned paths respectively.
+ */
+
+static const struct iob_layout layouts[] = {
+	/* Long ToC, where opening the last entries dominates */
+	{ .name = "small", .count = 512U, .size = 2048U, .align = 16U },
+	/* Few large images, where the copy throughput dominates */
+	{ .name = "large", .count = 4U, .size = 16U << 20, .align = 4096U },
+	/* Odd sizes at unaligned offsets, bouncing through the block buffer */
+	{ .name = "unaligned", .count = 64U, .size = 65537U, .align = 1U,
+	  .skew = 3U },
+};
+
+/* Size of the random reads of the seek benchmark */
+#define SEEK_READ_SIZE		4096U
+
+static unsigned int iterations = 3U;
+static size_t chunk_size;
+static uint8_t *read_buf;
+static size_t read_buf_size;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static double mib_per_s(uint64_t bytes, uint64_t ns)
+{
+	if (ns == 0U) {
+		return 0.0;
+	}
+
+	return ((double)bytes / (1024.0 * 1024.0)) / ((double)ns / 1e9);
+}
+
+static int open_entry(uintptr_t fip_dev, unsigned int idx, uintptr_t *handle)
+{
+	io_uuid_spec_t spec;
+
+	iob_fip_entry_uuid(idx, &spec.uuid);
+
+	return io_open(fip_dev, (uintptr_t)&spec, handle);
+}
+
+/* Open and close every entry, the cost being the ToC walk up to the entry */
+static int bench_open(const struct iob_layout *layout, uintptr_t fip_dev)
+{
+	uint64_t start, total = 0U, last = 0U, t;
+	uintptr_t handle;
+	unsigned int it, idx;
+
+	for (it = 0U; it < iterations; it++) {
+		for (idx = 0U; idx < layout->count; idx++) {
+			start = now_ns();
+			if (open_entry(fip_dev, idx, &handle) != 0) {
+				fprintf(stderr, "open of entry %u failed\n",
+					idx);
+				return -1;
+			}
+			t = now_ns() - start;
+			(void)io_close(handle);
+
+			total += t;
+			if (idx == (layout->count - 1U)) {
+				last += t;
+			}
+		}
+	}
+
+	printf("    open       avg %8.2f us  last entry %8.2f us\n",
+	       (double)total / (1000.0 * iterations * layout->count),
+	       (double)last / (1000.0 * iterations));
+
+	return 0;
+}
+
+/* Read every entry in 'chunk_size' pieces and check the payload */
+static int bench_read(const struct iob_layout *layout, uintptr_t fip_dev)
+{
+	uint64_t start, ns = 0U, bytes = 0U;
+	size_t size, done, len, got, i;
+	uintptr_t handle;
+	unsigned int it, idx;
+
+	for (it = 0U; it < iterations; it++) {
+		for (idx = 0U; idx < layout->count; idx++) {
+			if (open_entry(fip_dev, idx, &handle) != 0) {
+				return -1;
+			}
+
+			start = now_ns();
+			(void)io_size(handle, &size);
+			for (done = 0U; done < size; done += got) {
+				len = size - done;
+				if ((chunk_size != 0U) && (len > chunk_size)) {
+					len = chunk_size;
+				}
+				if ((io_read(handle, (uintptr_t)&read_buf[done],
+					     len, &got) != 0) || (got == 0U)) {
+					fprintf(stderr, "read of entry %u failed\n",
+						idx);
+					(void)io_close(handle);
+					return -1;
+				}
+			}
+			ns += now_ns() - start;
+			bytes += size;
+			(void)io_close(handle);
+
+			for (i = 0U; i < size; i++) {
+				if (read_buf[i] != iob_fip_pattern(idx, i)) {
+					fprintf(stderr,
+						"entry %u corrupted at %zu\n",
+						idx, i);
+					return -1;
+				}
+			}
+		}
+	}
+
+	printf("    read       %8.1f MiB/s (%llu bytes, chunk %zu)\n",
+	       mib_per_s(bytes, ns), (unsigned long long)bytes, chunk_size);
+
+	return 0;
+}
+
+/*
+ * The FIP driver does not implement seek, so random access is measured on the
+ * backend image the FIP driver sits on, reading payload bytes at arbitrary
+ * offsets as a FIP read at a non-zero file position would.
+ */
+static int bench_seek(const struct iob_fip *fip)
+{
+	uintptr_t dev_handle, image_spec, handle;
+	uint64_t start, ns;
+	unsigned int ops, i;
+	size_t offset, got;
+
+	if (fip->size <= SEEK_READ_SIZE) {
+		return 0;
+	}
+
+	iob_backend_get(&dev_handle, &image_spec);
+	if (io_open(dev_handle, image_spec, &handle) != 0) {
+		return -1;
+	}
+
+	ops = iterations * 4096U;
+	srand(1U);
+
+	start = now_ns();
+	for (i = 0U; i < ops; i++) {
+		offset = ((size_t)rand() * 4099U) % (fip->size - SEEK_READ_SIZE);
+		if ((io_seek(handle, IO_SEEK_SET, (signed long long)offset) != 0) ||
+		    (io_read(handle, (uintptr_t)read_buf, SEEK_READ_SIZE,
+			     &got) != 0) ||
+		    (memcmp(read_buf, &fip->base[offset], SEEK_READ_SIZE) != 0)) {
+			fprintf(stderr, "seek+read at %zu failed\n", offset);
+			(void)io_close(handle);
+			return -1;
+		}
+	}
+	ns = now_ns() - start;
+
+	(void)io_close(handle);
+
+	printf("    seek+read  %8.0f ops/s (%u x %u bytes)\n",
+	       (double)ops / ((double)ns / 1e9), ops, SEEK_READ_SIZE);
+
+	return 0;
+}
+
+static int write_file(const char *path, const struct iob_fip *fip)
+{
+	FILE *file = fopen(path, "wb");
+	int rc = 0;
+
+	if (file == NULL) {
+		return -1;
+	}
+
+	if (fwrite(fip->base, 1U, fip->size, file) != fip->size) {
+		rc = -1;
+	}
+
+	if (fclose(file) != 0) {
+		rc = -1;
+	}
+
+	return rc;
+}
+
+static int run_layout(const struct iob_layout *layout, unsigned int backends,
+		      const char *path)
+{
+	struct iob_fip fip;
+	uintptr_t fip_dev;
+	unsigned int b;
+	int rc = 0;
+
+	if (iob_fip_build(layout, &fip) != 0) {
+		fprintf(stderr, "cannot allocate %s layout\n", layout->name);
+		return -1;
+	}
+
+	printf("layout %s: %u entries of %zu bytes, FIP %zu bytes\n",
+	       layout->name, layout->count, layout->size, fip.size);
+
+	if (((backends & (1U << IOB_BACKEND_FILE)) != 0U) &&
+	    (write_file(path, &fip) != 0)) {
+		fprintf(stderr, "cannot write %s\n", path);
+		iob_fip_free(&fip);
+		return -1;
+	}
+
+	if (read_buf_size < layout->size) {
+		free(read_buf);
+		read_buf_size = (layout->size > SEEK_READ_SIZE) ?
+				layout->size : SEEK_READ_SIZE;
+		read_buf = malloc(read_buf_size);
+		if (read_buf == NULL) {
+			iob_fip_free(&fip);
+			return -1;
+		}
+	}
+
+	for (b = 0U; (b < IOB_BACKEND_COUNT) && (rc == 0); b++) {
+		if ((backends & (1U << b)) == 0U) {
+			continue;
+		}
+
+		printf("  backend %s\n", iob_backend_name(b));
+		if (iob_backend_open(b, fip.base, fip.size, path,
+				     &fip_dev) != 0) {
+			fprintf(stderr, "cannot open the FIP device\n");
+			rc = -1;
+			break;
+		}
+
+		rc = bench_open(layout, fip_dev);
+		if (rc == 0) {
+			rc = bench_read(layout, fip_dev);
+		}
+		if (rc == 0) {
+			rc = bench_seek(&fip);
+		}
+
+		iob_backend_close(fip_dev);
+	}
+
+	iob_fip_free(&fip);
+
+	return rc;
+}
+
+static void usage(const char *name)
+{
+	unsigned int i;
+
+	printf("usage: %s [options]\n", name);
+	printf("  -l <layout>   run one layout only:");
+	for (i = 0U; i < NELEM(layouts); i++) {
+		printf(" %s", layouts[i].name);
+	}
+	printf("\n");
+	printf("  -b <backend>  run one backend only: memmap block file\n");
+	printf("  -i <count>    iterations of each benchmark (default %u)\n",
+	       iterations);
+	printf("  -c <bytes>    read entries in chunks of this size\n");
+	printf("  -f <path>     file used by the file backend\n");
+	printf("  -o <path>     write the FIP of the selected layout and exit,\n"
+	       "                e.g. to seed the iofuzz corpus\n");
+}
+
+int main(int argc, char *argv[])
+{
+	const char *layout_name = NULL, *out = NULL;
+	char path[] = "/tmp/iobench-XXXXXX";
+	const char *file_path = NULL;
+	unsigned int backends = (1U << IOB_BACKEND_COUNT) - 1U;
+	struct iob_fip fip;
+	unsigned int i, b;
+	int opt, fd, rc = 0;
+
+	while ((opt = getopt(argc, argv, "l:b:i:c:f:o:h")) != -1) {
+		switch (opt) {
+		case 'l':
+			layout_name = optarg;
+			break;
+		case 'b':
+			for (b = 0U; b < IOB_BACKEND_COUNT; b++) {
+				if (strcmp(optarg, iob_backend_name(b)) == 0) {
+					break;
+				}
+			}
+			if (b == IOB_BACKEND_COUNT) {
+				usage(argv[0]);
+				return EXIT_FAILURE;
+			}
+			backends = 1U << b;
+			break;
+		case 'i':
+			iterations = (unsigned int)strtoul(optarg, NULL, 0);
+			if (iterations == 0U) {
+				iterations = 1U;
+			}
+			break;
+		case 'c':
+			chunk_size = strtoul(optarg, NULL, 0);
+			break;
+		case 'f':
+			file_path = optarg;
+			break;
+		case 'o':
+			out = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	for (i = 0U; i < NELEM(layouts); i++) {
+		if ((layout_name != NULL) &&
+		    (strcmp(layout_name, layouts[i].name) != 0)) {
+			continue;
+		}
+
+		if (out != NULL) {
+			if ((iob_fip_build(&layouts[i], &fip) != 0) ||
+			    (write_file(out, &fip) != 0)) {
+				fprintf(stderr, "cannot write %s\n", out);
+				return EXIT_FAILURE;
+			}
+			iob_fip_free(&fip);
+			return EXIT_SUCCESS;
+		}
+
+		if (file_path == NULL) {
+			fd = mkstemp(path);
+			if (fd < 0) {
+				perror("mkstemp");
+				return EXIT_FAILURE;
+			}
+			(void)close(fd);
+			file_path = path;
+		}
+
+		if (run_layout(&layouts[i], backends, file_path) != 0) {
+			rc = -1;
+			break;
+		}
+	}
+
+	if (file_path == path) {
+		(void)unlink(path);
+	}
+
+	free(read_buf);
+
+	if ((layout_name != NULL) && (file_path == NULL) && (out == NULL)) {
+		fprintf(stderr, "unknown layout %s\n", layout_name);
+		return EXIT_FAILURE;
+	}
+
+	return (rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IOBENCH_H
+#define IOBENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_storage.h>
+#include <tools_share/uuid.h>
+
+#define NELEM(x)		(sizeof(x) / sizeof((x)[0]))
+
+/* Block size and bounce buffer size of the emulated block device */
+#define IOB_BLOCK_SIZE		512U
+#define IOB_BLOCK_BUF_SIZE	(64U * 1024U)
+
+/* Backends the FIP can be accessed through */
+enum iob_backend {
+	IOB_BACKEND_MEMMAP,
+	IOB_BACKEND_BLOCK,
+	IOB_BACKEND_FILE,
+	IOB_BACKEND_COUNT
+};
+
+/*
+ * Shape of a generated FIP: 'count' entries of 'size' bytes each. Payloads
+ * start on an 'align' boundary, plus 'skew' bytes to exercise the unaligned
+ * paths of the backends.
+ */
+struct iob_layout {
+	const char *name;
+	unsigned int count;
+	size_t size;
+	size_t align;
+	size_t skew;
+};
+
+/* A FIP image held in host memory */
+struct iob_fip {
+	uint8_t *base;
+	size_t size;
+};
+
+/* Generate a FIP following 'layout', with a verifiable payload per entry */
+int iob_fip_build(const struct iob_layout *layout, struct iob_fip *fip);
+void iob_fip_free(struct iob_fip *fip);
+
+/* UUID and expected payload byte of the entries of a generated FIP */
+void iob_fip_entry_uuid(unsigned int idx, uuid_t *uuid);
+uint8_t iob_fip_pattern(unsigned int idx, size_t offset);
+
+/* Register all the io drivers, once per process */
+void iob_io_init(void);
+
+/*
+ * Open the FIP device on top of 'backend', accessing the image at 'base' in
+ * memory or, for the file backend, at 'path'. On success the FIP device
+ * handle is returned in 'fip_dev', and the backend device and image
+ * specification used by the FIP driver are available through
+ * iob_backend_get().
+ */
+int iob_backend_open(enum iob_backend backend, const void *base, size_t size,
+		     const char *path, uintptr_t *fip_dev);
+void iob_backend_close(uintptr_t fip_dev);
+void iob_backend_get(uintptr_t *dev_handle, uintptr_t *image_spec);
+const char *iob_backend_name(enum iob_backend backend);
+
+/* Host file io driver, see io_hostfile.c */
+int register_io_dev_hostfile(const io_dev_connector_t **dev_con);
+
+#endif /* IOBENCH_H */
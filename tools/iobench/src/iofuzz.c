@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tools_share/firmware_image_package.h>
+
+#include "iobench.h"
+
+/*
+ * Fuzzing entry point for the FIP ToC parsing. The input is used as the
+ * content of a FIP on a memmap backend: the header is checked by the FIP
+ * device initialisation, then the UUIDs found in the input ToC, plus a few
+ * well-known ones which are likely to be absent, are looked up through the
+ * FIP driver and their payloads are read back.
+ *
+ * The package lives in a fixed size region so that the ToC walk always ends
+ * on a null UUID within the backend, as it does in a flash of that size.
+ * Payloads described beyond the end of the region are read as well, the
+ * memmap driver must fail these reads.
+ */
+
+#define FUZZ_REGION_SIZE	(1U << 20)
+#define FUZZ_MAX_ENTRIES	64U
+
+static uint8_t fuzz_region[FUZZ_REGION_SIZE];
+static uint8_t fuzz_payload[FUZZ_REGION_SIZE];
+
+static const uuid_t fuzz_known_uuids[] = {
+	UUID_TRUSTED_BOOT_FIRMWARE_BL2,
+	UUID_EL3_RUNTIME_FIRMWARE_BL31,
+	UUID_NON_TRUSTED_FIRMWARE_BL33,
+};
+
+static void fuzz_entry(uintptr_t fip_dev, const uuid_t *uuid)
+{
+	io_uuid_spec_t spec;
+	uintptr_t handle;
+	size_t size, got;
+
+	spec.uuid = *uuid;
+	if (io_open(fip_dev, (uintptr_t)&spec, &handle) != 0) {
+		return;
+	}
+
+	if ((io_size(handle, &size) == 0) && (size != 0U)) {
+		/* Larger payloads are only read up to the size of the buffer */
+		if (size > sizeof(fuzz_payload)) {
+			size = sizeof(fuzz_payload);
+		}
+
+		(void)io_read(handle, (uintptr_t)fuzz_payload, size, &got);
+	}
+
+	(void)io_close(handle);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+	const fip_toc_entry_t *toc, *entry;
+	static const uuid_t uuid_null;
+	uintptr_t fip_dev;
+	unsigned int i, count;
+
+	/*
+	 * Keep room after the input for a whole null ToC entry, wherever the
+	 * entries end up relative to the end of the input.
+	 */
+	if (size > (FUZZ_REGION_SIZE - (2U * sizeof(fip_toc_entry_t)))) {
+		size = FUZZ_REGION_SIZE - (2U * sizeof(fip_toc_entry_t));
+	}
+
+	(void)memset(fuzz_region, 0, sizeof(fuzz_region));
+	(void)memcpy(fuzz_region, data, size);
+
+	if (iob_backend_open(IOB_BACKEND_MEMMAP, fuzz_region,
+			     sizeof(fuzz_region), NULL, &fip_dev) != 0) {
+		return 0;
+	}
+
+	/* A valid header implies the input holds at least the header */
+	toc = (const fip_toc_entry_t *)(fuzz_region + sizeof(fip_toc_header_t));
+	count = (size - sizeof(fip_toc_header_t)) / sizeof(*toc);
+	if (count > FUZZ_MAX_ENTRIES) {
+		count = FUZZ_MAX_ENTRIES;
+	}
+
+	for (i = 0U; i < count; i++) {
+		entry = &toc[i];
+		if (memcmp(&entry->uuid, &uuid_null, sizeof(uuid_null)) == 0) {
+			break;
+		}
+
+		fuzz_entry(fip_dev, &entry->uuid);
+	}
+
+	/* Lookups of UUIDs the input may not hold, walking the whole ToC */
+	for (i = 0U; i < NELEM(fuzz_known_uuids); i++) {
+		fuzz_entry(fip_dev, &fuzz_known_uuids[i]);
+	}
+
+	iob_backend_close(fip_dev);
+
+	return 0;
+}
+
+#if !LIBFUZZER
+/* Without libFuzzer, replay the inputs given on the command line */
+int main(int argc, char *argv[])
+{
+	static uint8_t input[FUZZ_REGION_SIZE];
+	FILE *file;
+	size_t size;
+	int i;
+
+	if (argc < 2) {
+		printf("usage: %s <input>...\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	for (i = 1; i < argc; i++) {
+		file = fopen(argv[i], "rb");
+		if (file == NULL) {
+			perror(argv[i]);
+			return EXIT_FAILURE;
+		}
+
+		size = fread(input, 1U, sizeof(input), file);
+		(void)fclose(file);
+
+		printf("replaying %s (%zu bytes)\n", argv[i], size);
+		(void)LLVMFuzzerTestOneInput(input, size);
+	}
+
+	return EXIT_SUCCESS;
+}
+#endif /* !LIBFUZZER */